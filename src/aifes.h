@@ -35,16 +35,27 @@ extern "C" {
 
 // Include the datatypes
 #include "basic/base/aimath/aimath_f32.h"
+#include "basic/base/aimath/aimath_q7.h"
+#include "basic/base/aimath/aimath_q15.h"
+#include "basic/base/aimath/aimath_q31.h"
 
 // Include basic datatype independent math functions
 #include "basic/base/aimath/aimath_basic.h"
 
+// Include the debugging tools
+#include "basic/base/aidebug/aidebug_trace.h"
+#include "basic/base/aidebug/aidebug_memory.h"
+
 // ---------------------------- Module base implementations -----------------------
 // ("abstract" super "classes". A hardware optimized implementation can "inherit" from these modules)
 
 // Include the layer base implementations
 #include "basic/base/ailayer/ailayer_dense.h"
+#include "basic/base/ailayer/ailayer_dense_dynamic.h"
+#include "basic/base/ailayer/ailayer_dense_incremental.h"
+#include "basic/base/ailayer/ailayer_dense_stacked.h"
 #include "basic/base/ailayer/ailayer_input.h"
+#include "basic/base/ailayer/ailayer_normalize.h"
 #include "basic/base/ailayer/ailayer_relu.h"
 #include "basic/base/ailayer/ailayer_leaky_relu.h"
 #include "basic/base/ailayer/ailayer_elu.h"
@@ -56,20 +67,28 @@ extern "C" {
 // Include the loss base implementations
 #include "basic/base/ailoss/ailoss_mse.h"
 #include "basic/base/ailoss/ailoss_crossentropy.h"
+#include "basic/base/ailoss/ailoss_distillation.h"
 
 // Include the optimizer base implementations
 #include "basic/base/aiopti/aiopti_sgd.h"
 #include "basic/base/aiopti/aiopti_adam.h"
+#include "basic/base/aifeature/aifeature_mfcc.h"
 
 // ---------------------------- Module default implementations -----------------------
 // (Fallback functions if no hardware optimized implementation available)
 
 // Include the math in default implementation
 #include "basic/default/aimath/aimath_f32_default.h"
+#include "basic/default/aimath/aimath_q7_default.h"
+#include "basic/default/aimath/aimath_q15_default.h"
 
 // Include the layers in default implementation
 #include "basic/default/ailayer/ailayer_dense_default.h"
+#include "basic/default/ailayer/ailayer_dense_dynamic_default.h"
+#include "basic/default/ailayer/ailayer_dense_incremental_default.h"
+#include "basic/default/ailayer/ailayer_dense_stacked_default.h"
 #include "basic/default/ailayer/ailayer_input_default.h"
+#include "basic/default/ailayer/ailayer_normalize_default.h"
 #include "basic/default/ailayer/ailayer_relu_default.h"
 #include "basic/default/ailayer/ailayer_leaky_relu_default.h"
 #include "basic/default/ailayer/ailayer_elu_default.h"
@@ -81,10 +100,12 @@ extern "C" {
 // Include the losses in default implementation
 #include "basic/default/ailoss/ailoss_mse_default.h"
 #include "basic/default/ailoss/ailoss_crossentropy_default.h"
+#include "basic/default/ailoss/ailoss_distillation_default.h"
 
 // Include the optimizers in default implementation
 #include "basic/default/aiopti/aiopti_sgd_default.h"
 #include "basic/default/aiopti/aiopti_adam_default.h"
+#include "basic/default/aifeature/aifeature_mfcc_default.h"
 
 // ---------------------------- CMSIS implementations -----------------------
 // ATTENTION!
@@ -106,7 +127,35 @@ extern "C" {
 
 // Include the algorithmic
 #include "basic/base/aialgo/aialgo_sequential_inference.h"
+#include "basic/base/aialgo/aialgo_inference_cache.h"
 #include "basic/base/aialgo/aialgo_sequential_training.h"
+#include "basic/base/aialgo/aialgo_full_batch.h"
+#include "basic/base/aialgo/aialgo_replay.h"
+#include "basic/base/aialgo/aialgo_cost_model.h"
+#include "basic/base/aialgo/aialgo_early_exit.h"
+
+// ---------------------------- POSIX implementations -----------------------
+// ATTENTION!
+// If you want to use the multi-threaded algorithms on a POSIX host (Linux, macOS, ...), you need to uncomment the define of AIFES_WITH_POSIX
+
+//#define AIFES_WITH_POSIX
+
+#ifdef AIFES_WITH_POSIX
+
+// Include the math in posix implementation
+#include "basic/posix/aimath/aimath_f32_posix.h"
+
+// Include the algorithmic in posix implementation
+#include "basic/posix/aialgo/aialgo_pipeline.h"
+#include "basic/posix/aialgo/aialgo_data_parallel.h"
+
+// Include the inference server
+#include "basic/posix/aiserve/aiserve.h"
+
+// Include the hyperparameter tuning
+#include "basic/posix/aitune/aitune.h"
+
+#endif /* AIFES_WITH_POSIX */
 
 #ifdef __cplusplus
 } // End extern "C"
@@ -0,0 +1,261 @@
+/**
+ * \file basic/base/aialgo/aialgo_cost_model.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aialgo_cost_model.h for documentation.
+ * \details
+ */
+
+#include "basic/base/aialgo/aialgo_cost_model.h"
+
+#include "basic/default/aimath/aimath_f32_default.h"
+
+#include <stdio.h>
+
+// Cost of layers without a calc_cost implementation: One operation per result element
+static void aialgo_generic_layer_cost(const ailayer_t *layer, aicore_layercost_t *cost)
+{
+	cost->ops = aimath_tensor_elements(&(layer->result));
+	cost->special_ops = 0;
+	cost->bytes_read = (layer->input_layer != 0 && layer->input_layer != layer) ? aimath_sizeof_tensor_data(&(layer->input_layer->result)) : 0;
+	cost->bytes_written = aimath_sizeof_tensor_data(&(layer->result));
+	cost->parameter_bytes = (layer->sizeof_paramem != 0) ? layer->sizeof_paramem(layer) : 0;
+	cost->bytes_read += cost->parameter_bytes;
+	cost->activation_bytes = aimath_sizeof_tensor_data(&(layer->result));
+	return;
+}
+
+static void aialgo_calc_layer_cost(ailayer_t *layer, aicore_layercost_t *cost)
+{
+	layer->calc_result_shape(layer);
+	if(layer->layer_type != 0 && layer->layer_type->calc_cost != 0){
+		layer->layer_type->calc_cost(layer, cost);
+	} else {
+		aialgo_generic_layer_cost(layer, cost);
+	}
+	return;
+}
+
+void aialgo_estimate_cost(aimodel_t *model, aicore_layercost_t *layer_costs, aicore_layercost_t *total_cost)
+{
+	uint16_t i;
+	ailayer_t *layer_ptr = model->input_layer;
+	aicore_layercost_t cost;
+
+	total_cost->ops = 0;
+	total_cost->special_ops = 0;
+	total_cost->bytes_read = 0;
+	total_cost->bytes_written = 0;
+	total_cost->parameter_bytes = 0;
+	total_cost->activation_bytes = 0;
+
+	for(i = 0; i < model->layer_count; i++)
+	{
+		aialgo_calc_layer_cost(layer_ptr, &cost);
+
+		total_cost->ops += cost.ops;
+		total_cost->special_ops += cost.special_ops;
+		total_cost->bytes_read += cost.bytes_read;
+		total_cost->bytes_written += cost.bytes_written;
+		total_cost->parameter_bytes += cost.parameter_bytes;
+		total_cost->activation_bytes += cost.activation_bytes;
+
+		if(layer_costs != 0){
+			layer_costs[i] = cost;
+		}
+
+		layer_ptr = layer_ptr->output_layer;
+	}
+	return;
+}
+
+float aialgo_arithmetic_intensity(const aicore_layercost_t *cost)
+{
+	uint32_t bytes = cost->bytes_read + cost->bytes_written;
+
+	if(bytes == 0){
+		return 0.0f;
+	}
+	return (float) (cost->ops + cost->special_ops) / (float) bytes;
+}
+
+float aialgo_predict_layer_latency_us(const aicore_layercost_t *cost, const aialgo_cost_calibration_t *calibration)
+{
+	float compute_ns, memory_ns;
+
+	compute_ns = (float) cost->ops * calibration->ns_per_op + (float) cost->special_ops * calibration->ns_per_special_op;
+	memory_ns = (float) (cost->bytes_read + cost->bytes_written) * calibration->ns_per_byte;
+
+	return ((compute_ns > memory_ns ? compute_ns : memory_ns) + calibration->ns_per_layer) / 1000.0f;
+}
+
+float aialgo_predict_latency_us(aimodel_t *model, const aialgo_cost_calibration_t *calibration)
+{
+	uint16_t i;
+	ailayer_t *layer_ptr = model->input_layer;
+	aicore_layercost_t cost;
+	float latency = 0.0f;
+
+	for(i = 0; i < model->layer_count; i++)
+	{
+		aialgo_calc_layer_cost(layer_ptr, &cost);
+		latency += aialgo_predict_layer_latency_us(&cost, calibration);
+
+		layer_ptr = layer_ptr->output_layer;
+	}
+	return latency;
+}
+
+void aialgo_print_cost_model(aimodel_t *model, const aialgo_cost_calibration_t *calibration, int (*print)(const char *format, ...))
+{
+	uint16_t i;
+	ailayer_t *layer_ptr = model->input_layer;
+	aicore_layercost_t cost, total_cost;
+	float latency, total_latency = 0.0f;
+	float compute_ns, memory_ns;
+	const char *name;
+
+	total_cost.ops = 0;
+	total_cost.special_ops = 0;
+	total_cost.bytes_read = 0;
+	total_cost.bytes_written = 0;
+	total_cost.parameter_bytes = 0;
+	total_cost.activation_bytes = 0;
+
+	print("Cost model:\n");
+	for(i = 0; i < model->layer_count; i++)
+	{
+		aialgo_calc_layer_cost(layer_ptr, &cost);
+		name = (layer_ptr->layer_type != 0 && layer_ptr->layer_type->name != 0) ? layer_ptr->layer_type->name : "Layer";
+
+		print("%4d: %s <ops: %lu; special ops: %lu; read: %lu B; written: %lu B; params: %lu B; activations: %lu B; intensity: %.3f ops/B",
+			  i + 1, name, (unsigned long) cost.ops, (unsigned long) cost.special_ops,
+			  (unsigned long) cost.bytes_read, (unsigned long) cost.bytes_written,
+			  (unsigned long) cost.parameter_bytes, (unsigned long) cost.activation_bytes,
+			  aialgo_arithmetic_intensity(&cost));
+		if(calibration != 0){
+			compute_ns = (float) cost.ops * calibration->ns_per_op + (float) cost.special_ops * calibration->ns_per_special_op;
+			memory_ns = (float) (cost.bytes_read + cost.bytes_written) * calibration->ns_per_byte;
+			latency = aialgo_predict_layer_latency_us(&cost, calibration);
+			total_latency += latency;
+			print("; latency: %.2f us (%s bound)", latency, compute_ns >= memory_ns ? "compute" : "memory");
+		}
+		print(">\n");
+
+		total_cost.ops += cost.ops;
+		total_cost.special_ops += cost.special_ops;
+		total_cost.bytes_read += cost.bytes_read;
+		total_cost.bytes_written += cost.bytes_written;
+		total_cost.parameter_bytes += cost.parameter_bytes;
+		total_cost.activation_bytes += cost.activation_bytes;
+
+		layer_ptr = layer_ptr->output_layer;
+	}
+
+	print("Total: <ops: %lu; special ops: %lu; read: %lu B; written: %lu B; params: %lu B; activations: %lu B; intensity: %.3f ops/B",
+		  (unsigned long) total_cost.ops, (unsigned long) total_cost.special_ops,
+		  (unsigned long) total_cost.bytes_read, (unsigned long) total_cost.bytes_written,
+		  (unsigned long) total_cost.parameter_bytes, (unsigned long) total_cost.activation_bytes,
+		  aialgo_arithmetic_intensity(&total_cost));
+	if(calibration != 0){
+		print("; latency: %.2f us", total_latency);
+	}
+	print(">\n");
+	return;
+}
+
+void aialgo_calibrate_cost_model_f32(aialgo_cost_calibration_t *calibration, uint64_t (*clock_us)(void), uint16_t repetitions)
+{
+	uint16_t i, r;
+	uint64_t start, duration;
+	float sigmoid_ns;
+
+	float x_data[1*8];
+	uint16_t x_shape[2] = {1, 8};
+	aitensor_t x = AITENSOR_2D_F32(x_shape, x_data);
+
+	float w_data[8*8];
+	uint16_t w_shape[2] = {8, 8};
+	aitensor_t w = AITENSOR_2D_F32(w_shape, w_data);
+
+	float b_data[1*8];
+	aitensor_t b = AITENSOR_2D_F32(x_shape, b_data);
+
+	float result_data[1*8];
+	aitensor_t result = AITENSOR_2D_F32(x_shape, result_data);
+
+	// The weights memory is split into two halves for the copy benchmark
+	uint16_t half_shape[2] = {1, 32};
+	aitensor_t copy_from = AITENSOR_2D_F32(half_shape, w_data);
+	aitensor_t copy_to = AITENSOR_2D_F32(half_shape, &w_data[32]);
+
+	uint16_t single_shape[2] = {1, 1};
+	aitensor_t single_x = AITENSOR_2D_F32(single_shape, x_data);
+	aitensor_t single_result = AITENSOR_2D_F32(single_shape, result_data);
+
+	if(repetitions == 0){
+		repetitions = 1;
+	}
+
+	for(i = 0; i < 8; i++){
+		x_data[i] = 0.1f * (float) i - 0.4f;
+		b_data[i] = 0.01f * (float) i;
+	}
+	for(i = 0; i < 64; i++){
+		w_data[i] = 0.02f * (float) (i % 16) - 0.15f;
+	}
+
+	// Basic operations: 2*K*M + M operations per linear transformation
+	start = clock_us();
+	for(r = 0; r < repetitions; r++){
+		aimath_f32_default_linear(&x, &w, &b, &result);
+	}
+	duration = clock_us() - start;
+	calibration->ns_per_op = (float) duration * 1000.0f / ((float) repetitions * (2.0f * 8.0f * 8.0f + 8.0f));
+
+	// Special operations: 2 operations and 2 special operations per element (see ailayer_sigmoid_calc_cost())
+	start = clock_us();
+	for(r = 0; r < repetitions; r++){
+		aimath_f32_default_sigmoid(&x, &result);
+	}
+	duration = clock_us() - start;
+	sigmoid_ns = (float) duration * 1000.0f / ((float) repetitions * 8.0f);
+	calibration->ns_per_special_op = (sigmoid_ns - 2.0f * calibration->ns_per_op) / 2.0f;
+	if(calibration->ns_per_special_op < calibration->ns_per_op){
+		calibration->ns_per_special_op = calibration->ns_per_op;
+	}
+
+	// Memory: Every copied byte is read and written once
+	start = clock_us();
+	for(r = 0; r < repetitions; r++){
+		aimath_f32_default_copy_tensor(&copy_from, &copy_to);
+	}
+	duration = clock_us() - start;
+	calibration->ns_per_byte = (float) duration * 1000.0f / ((float) repetitions * 2.0f * 32.0f * sizeof(float));
+
+	// Layer overhead: Element wise function on a single element
+	start = clock_us();
+	for(r = 0; r < repetitions; r++){
+		aimath_f32_default_relu(&single_x, &single_result);
+	}
+	duration = clock_us() - start;
+	calibration->ns_per_layer = (float) duration * 1000.0f / (float) repetitions;
+
+	return;
+}
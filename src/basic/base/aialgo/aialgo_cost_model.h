@@ -0,0 +1,133 @@
+/**
+ * \file basic/base/aialgo/aialgo_cost_model.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Static cost model and latency estimation of models
+ * \details The cost of a forward pass (operations, memory traffic, parameter and activation sizes) is calculated
+ * from the layer shapes without executing the model. Together with a calibration of the target platform, the latency
+ * of an inference can be estimated with a roofline model before the model is deployed.
+ *
+ * The per layer cost is provided by the layer types (see aicore_layertype.calc_cost).
+ *
+ * Example:
+ * \code{.c}
+ * aialgo_cost_calibration_t calibration;
+ *
+ * // Run this on the target device once and store the result
+ * aialgo_calibrate_cost_model_f32(&calibration, clock_us, 100);
+ *
+ * aialgo_compile_model(&model);
+ * aialgo_print_cost_model(&model, &calibration, printf);
+ * \endcode
+ */
+
+#ifndef AIALGO_COST_MODEL
+#define AIALGO_COST_MODEL
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+typedef struct aialgo_cost_calibration  aialgo_cost_calibration_t;
+
+/** @brief Calibration table of a platform for the latency estimation
+ *
+ * The values can be measured on the target device with aialgo_calibrate_cost_model_f32()
+ * or can be set manually (for example from the datasheet of the processor).
+ */
+struct aialgo_cost_calibration {
+	float ns_per_op; /**< Time for a basic arithmetic operation (add, multiply, compare) in nanoseconds. */
+	float ns_per_special_op; /**< Time for an expensive operation (exp, division, square root) in nanoseconds. */
+	float ns_per_byte; /**< Time to read or write one byte of memory in nanoseconds. */
+	float ns_per_layer; /**< Constant overhead of a layer (function calls, loop setup) in nanoseconds. */
+};
+
+/** @brief Calculate the static cost of a forward pass for all layers of the model
+ *
+ * The result shapes of the layers are calculated before. If a layer type does not provide a cost function,
+ * one operation per result element is assumed.
+ *
+ * @param *model        The compiled model (the input layer shape has to be set)
+ * @param *layer_costs  Array with model->layer_count elements for the cost of every layer (may be 0 if not needed)
+ * @param *total_cost   The summed up cost of the whole model is written here
+ */
+void aialgo_estimate_cost(aimodel_t *model, aicore_layercost_t *layer_costs, aicore_layercost_t *total_cost);
+
+/** @brief Calculate the arithmetic intensity (operations per transferred byte) of a cost
+ *
+ * @param *cost The cost of a layer or model
+ * @return      Operations per byte (0 if no memory is transferred)
+ */
+float aialgo_arithmetic_intensity(const aicore_layercost_t *cost);
+
+/** @brief Estimate the execution time for the given cost with a roofline model
+ *
+ * \f[
+ *  t = max(t_{compute}, t_{memory}) + t_{layer}
+ * \f]
+ *
+ * with \f$ t_{compute} = ops \cdot t_{op} + special\_ops \cdot t_{special\_op} \f$ and
+ * \f$ t_{memory} = (bytes\_read + bytes\_written) \cdot t_{byte} \f$.
+ *
+ * @param *cost         The cost of a single layer
+ * @param *calibration  Calibration table of the target platform
+ * @return              Estimated time in microseconds
+ */
+float aialgo_predict_layer_latency_us(const aicore_layercost_t *cost, const aialgo_cost_calibration_t *calibration);
+
+/** @brief Estimate the latency of a forward pass of the model
+ *
+ * The latency is the sum of the roofline estimations of every layer (see aialgo_predict_layer_latency_us()).
+ *
+ * @param *model        The compiled model (the input layer shape has to be set)
+ * @param *calibration  Calibration table of the target platform
+ * @return              Estimated time in microseconds
+ */
+float aialgo_predict_latency_us(aimodel_t *model, const aialgo_cost_calibration_t *calibration);
+
+/** @brief Print the cost of every layer and the whole model
+ *
+ * Prints the operations, memory traffic, parameter and activation sizes and the arithmetic intensity.
+ * If a calibration table is given, the estimated latency and whether the layer is compute or memory bound is printed too.
+ *
+ * @param *model        The compiled model (the input layer shape has to be set)
+ * @param *calibration  Calibration table of the target platform (may be 0)
+ * @param *print        A function for printing (for example printf)
+ */
+void aialgo_print_cost_model(aimodel_t *model, const aialgo_cost_calibration_t *calibration, int (*print)(const char *format, ...));
+
+/** @brief Measure the calibration table for F32 models on the current platform
+ *
+ * Small benchmarks of the F32 default math functions are executed and timed with the given clock:
+ * * ns_per_op: Matrix multiplication with bias (aimath_f32_default_linear())
+ * * ns_per_special_op: Sigmoid (aimath_f32_default_sigmoid())
+ * * ns_per_byte: Tensor copy (aimath_f32_default_copy_tensor())
+ * * ns_per_layer: ReLU on a single element (aimath_f32_default_relu())
+ *
+ * The benchmarks use less than 1 kB of stack memory.
+ *
+ * @param *calibration  The measured values are written here
+ * @param *clock_us     Function that returns a monotonic time in microseconds (for example micros() on Arduino)
+ * @param repetitions   Number of repetitions of each benchmark (increase it for clocks with a low resolution)
+ */
+void aialgo_calibrate_cost_model_f32(aialgo_cost_calibration_t *calibration, uint64_t (*clock_us)(void), uint16_t repetitions);
+
+#endif // AIALGO_COST_MODEL
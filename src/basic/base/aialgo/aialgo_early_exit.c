@@ -0,0 +1,260 @@
+/**
+ * \file basic/base/aialgo/aialgo_early_exit.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aialgo_early_exit.h for documentation.
+ * \details
+ */
+
+#include "basic/base/aialgo/aialgo_early_exit.h"
+#include "basic/base/aialgo/aialgo_sequential_inference.h"
+#include "basic/base/aialgo/aialgo_sequential_training.h"
+#include "basic/base/aidebug/aidebug_trace.h"
+#include "basic/default/aimath/aimath_f32_default.h"
+
+#include <string.h>
+
+static float aialgo_early_exit_confidence_f32(const aitensor_t *output)
+{
+	float confidence;
+
+	aimath_f32_default_max(output, &confidence);
+	return confidence;
+}
+
+aitensor_t *aialgo_forward_model_early_exit_f32(aimodel_t *model, aialgo_early_exit_t *exits, uint16_t exits_count, aitensor_t *input_data, uint16_t *exit_index)
+{
+	uint16_t i, k = 0;
+	ailayer_t *layer_ptr = model->input_layer;
+	aitensor_t *head_output;
+
+	model->input_layer->result.data = input_data->data;
+	model->input_layer->result.tensor_params = input_data->tensor_params;
+	for(i = 0; i < model->layer_count; i++)
+	{
+		AIDEBUG_TRACE_BEGIN(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "forward", i);
+		layer_ptr->forward(layer_ptr);
+		AIDEBUG_TRACE_END(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "forward", i);
+
+		// Evaluate the heads of this layer
+		while(k < exits_count && exits[k].attach_layer == layer_ptr)
+		{
+			AIDEBUG_TRACE_BEGIN("Early exit", "forward", k);
+			head_output = aialgo_forward_model(exits[k].head, &(layer_ptr->result));
+			AIDEBUG_TRACE_END("Early exit", "forward", k);
+			if(aialgo_early_exit_confidence_f32(head_output) >= exits[k].threshold)
+			{
+				*exit_index = k;
+				return head_output;
+			}
+			k++;
+		}
+
+		layer_ptr = layer_ptr->output_layer;
+	}
+	*exit_index = exits_count;
+	return &(model->output_layer->result);
+}
+
+aitensor_t *aialgo_inference_model_early_exit_f32(aimodel_t *model, aialgo_early_exit_t *exits, uint16_t exits_count, aitensor_t *input_data, aitensor_t *output_data)
+{
+	uint32_t i;
+	uint16_t exit_index;
+
+	uint16_t input_batch_shape[input_data->dim];
+	aitensor_t input_batch = {
+	    .dtype = input_data->dtype,
+        .shape = input_batch_shape,
+        .dim = input_data->dim,
+        .tensor_params = input_data->tensor_params
+	};
+	aitensor_t *output_batch;
+
+	uint32_t input_multiplier = 1;
+	for(i = input_data->dim - 1; i > 0; i--)
+	{
+		input_multiplier *= input_data->shape[i];
+		input_batch_shape[i] = input_data->shape[i];
+	}
+	input_batch_shape[0] = 1;
+
+	uint32_t output_multiplier = 1;
+	for(i = output_data->dim - 1; i > 0; i--)
+	{
+		output_multiplier *= output_data->shape[i];
+	}
+
+	for(i = 0; i < input_data->shape[0]; i++)
+	{
+		input_batch.data = input_data->data + i * input_multiplier * input_data->dtype->size;
+
+		output_batch = aialgo_forward_model_early_exit_f32(model, exits, exits_count, &input_batch, &exit_index);
+		if(exit_index < exits_count){
+			exits[exit_index].exit_count++;
+		}
+
+		memcpy(output_data->data + i * output_multiplier * output_data->dtype->size,
+			   output_batch->data,
+			   aimath_sizeof_tensor_data(output_batch));
+	}
+	return output_data;
+}
+
+// Scale the gradients of the head with the loss weight (equal to a weighted head loss)
+static void aialgo_early_exit_weight_gradients_f32(aialgo_early_exit_t *exit)
+{
+	uint16_t i, j;
+	ailayer_t *layer_ptr = exit->head->input_layer;
+
+	for(i = 0; i < exit->head->layer_count; i++)
+	{
+		for(j = 0; j < layer_ptr->trainable_params_count; j++){
+			aimath_f32_default_scalar_mul(&(exit->loss_weight), layer_ptr->gradients[j], layer_ptr->gradients[j]);
+		}
+		layer_ptr = layer_ptr->output_layer;
+	}
+	return;
+}
+
+// Add the weighted deltas of the head input to the deltas of the attach layer result
+static void aialgo_early_exit_add_deltas_f32(aialgo_early_exit_t *exit, aitensor_t *deltas)
+{
+	aitensor_t *head_deltas = &(exit->head->input_layer->output_layer->deltas);
+
+	float temp_deltas_data[aimath_tensor_elements(head_deltas)];
+	aitensor_t temp_deltas = {
+		.dtype = head_deltas->dtype,
+		.dim = head_deltas->dim,
+		.shape = head_deltas->shape,
+		.tensor_params = head_deltas->tensor_params,
+		.data = temp_deltas_data
+	};
+
+	// deltas += loss_weight * head_deltas
+	aimath_f32_default_scalar_mul(&(exit->loss_weight), head_deltas, &temp_deltas);
+	aimath_f32_default_tensor_add(deltas, &temp_deltas, deltas);
+	return;
+}
+
+// Backward pass of the model with the deltas of the heads added to the deltas of the attach layers
+static void aialgo_backward_model_early_exit_f32(aimodel_t *model, aialgo_early_exit_t *exits, uint16_t exits_count, aitensor_t *target_data)
+{
+	uint16_t i, k;
+	ailayer_t *layer_ptr;
+
+	// The heads first, because the backward pass of the model overrides the results of the attach layers
+	for(k = 0; k < exits_count; k++)
+	{
+		AIDEBUG_TRACE_BEGIN("Early exit", "backward", k);
+		exits[k].head->loss->calc_delta(exits[k].head->loss, target_data);
+		layer_ptr = exits[k].head->output_layer;
+		for(i = 0; i < exits[k].head->layer_count - 1; i++)
+		{
+			layer_ptr->backward(layer_ptr);
+			layer_ptr = layer_ptr->input_layer;
+		}
+		AIDEBUG_TRACE_END("Early exit", "backward", k);
+	}
+
+	model->loss->calc_delta(model->loss, target_data);
+	layer_ptr = model->output_layer;
+	k = exits_count;
+	for(i = 0; i < model->layer_count; i++)
+	{
+		// Add the deltas of the heads on the result of this layer
+		while(k > 0 && exits[k - 1].attach_layer == layer_ptr)
+		{
+			k--;
+			aialgo_early_exit_add_deltas_f32(&(exits[k]), &(layer_ptr->output_layer->deltas));
+		}
+
+		AIDEBUG_TRACE_BEGIN(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "backward", model->layer_count - 1 - i);
+		layer_ptr->backward(layer_ptr);
+		AIDEBUG_TRACE_END(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "backward", model->layer_count - 1 - i);
+		layer_ptr = layer_ptr->input_layer;
+	}
+	return;
+}
+
+void aialgo_train_model_early_exit_f32(aimodel_t *model, aialgo_early_exit_t *exits, uint16_t exits_count, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size)
+{
+	uint32_t i;
+	uint16_t k;
+
+	aitensor_t input_batch;
+	uint16_t input_batch_shape[input_tensor->dim];
+	input_batch.dtype = input_tensor->dtype;
+	input_batch.dim = input_tensor->dim;
+	input_batch.shape = input_batch_shape;
+	input_batch.tensor_params = input_tensor->tensor_params;
+	aitensor_t target_batch;
+	uint16_t target_batch_shape[target_tensor->dim];
+	target_batch.dtype = target_tensor->dtype;
+	target_batch.dim = target_tensor->dim;
+	target_batch.shape = target_batch_shape;
+	target_batch.tensor_params = target_tensor->tensor_params;
+
+	uint32_t input_multiplier = 1;
+	for(i = input_tensor->dim - 1; i > 0; i--)
+	{
+		input_multiplier *= input_tensor->shape[i];
+		input_batch_shape[i] = input_tensor->shape[i];
+	}
+	input_multiplier *= input_tensor->dtype->size;
+	input_batch_shape[0] = 1;
+	uint32_t target_multiplier = 1;
+	for(i = target_tensor->dim - 1; i > 0; i--)
+	{
+		target_multiplier *= target_tensor->shape[i];
+		target_batch_shape[i] = target_tensor->shape[i];
+	}
+	target_multiplier *= target_tensor->dtype->size;
+	target_batch_shape[0] = 1;
+
+	uint32_t batch_count = (uint32_t) (input_tensor->shape[0] / batch_size);
+	uint32_t batch;
+	for(batch = 0; batch < batch_count; batch++)
+	{
+		aialgo_zero_gradients_model(model, optimizer);
+		for(k = 0; k < exits_count; k++)
+		{
+			aialgo_zero_gradients_model(exits[k].head, optimizer);
+		}
+		for(i = 0; i < batch_size; i++)
+		{
+			input_batch.data = input_tensor->data + batch * input_multiplier * batch_size + i * input_multiplier;
+			target_batch.data = target_tensor->data + batch * target_multiplier * batch_size + i * target_multiplier;
+
+			// The results of all layers are kept in the training memory, so the heads can be calculated afterwards
+			aialgo_forward_model(model, &input_batch);
+			for(k = 0; k < exits_count; k++)
+			{
+				aialgo_forward_model(exits[k].head, &(exits[k].attach_layer->result));
+			}
+			aialgo_backward_model_early_exit_f32(model, exits, exits_count, &target_batch);
+		}
+		aialgo_update_params_model(model, optimizer);
+		for(k = 0; k < exits_count; k++)
+		{
+			aialgo_early_exit_weight_gradients_f32(&(exits[k]));
+			aialgo_update_params_model(exits[k].head, optimizer);
+		}
+	}
+	return;
+}
@@ -0,0 +1,121 @@
+/**
+ * \file basic/base/aialgo/aialgo_early_exit.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Early-exit (cascade) inference and training with classifier heads on intermediate layers
+ * \details Small classifier heads (separate models, for example a Dense layer with a Softmax activation) can be
+ * attached to the results of intermediate layers of a sequential model. In the forward pass the heads are
+ * evaluated after their layers and the inference stops as soon as the confidence of a head (the maximum of its
+ * output, the softmax probability of the predicted class) reaches its threshold. Easy inputs leave the model early
+ * and only the hard inputs run through the full network.
+ *
+ * The heads must have the same output shape as the main model. Each head is a compiled model with an input layer of
+ * the result shape of the attach layer and its own parameter, inference and training memory.
+ *
+ * In the training, the losses of the heads are added to the loss of the main model, weighted with
+ * aialgo_early_exit.loss_weight. The deltas of the heads are backpropagated into the shared layers.
+ *
+ * Example:
+ * \code{.c}
+ * aialgo_early_exit_t exits[] = {
+ *     {.attach_layer = hidden_layer_1, .head = &head_model_1, .threshold = 0.9f, .loss_weight = 0.3f}
+ * };
+ *
+ * aialgo_train_model_early_exit_f32(&model, exits, 1, &input_tensor, &target_tensor, optimizer, batch_size);
+ * ...
+ * aialgo_inference_model_early_exit_f32(&model, exits, 1, &input_tensor, &output_tensor);
+ * \endcode
+ */
+
+#ifndef AIALGO_EARLY_EXIT
+#define AIALGO_EARLY_EXIT
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+typedef struct aialgo_early_exit  aialgo_early_exit_t;
+
+/** @brief Classifier head on an intermediate layer of a model
+ *
+ * The exits of a model have to be ordered like their attach layers (from the input to the output).
+ */
+struct aialgo_early_exit {
+	ailayer_t *attach_layer; /**< Layer of the main model whose result is the input of the head. */
+	aimodel_t *head; /**< Compiled head model with the same output shape as the main model. */
+	float threshold; /**< Confidence (maximum output value of the head) to stop the inference. */
+	float loss_weight; /**< Weight of the head loss in the training. */
+	uint32_t exit_count; /**< Number of samples that left the model at this head (statistics). */
+};
+
+/** @brief Perform a forward pass on the model that stops at the first confident head
+ *
+ * After each layer the heads attached to it are evaluated. If the maximum value of the head output is
+ * greater or equal to the threshold of the head, the forward pass stops and the head output is returned.
+ *
+ * @param *model        The model
+ * @param *exits        Array of the early exits of the model
+ * @param exits_count   Number of early exits
+ * @param *input_data   Input data tensor of the same shape as the input_layer shape
+ * @param *exit_index   Index of the exit that was taken (exits_count if the full model was calculated)
+ * @return              Pointer to the output data of the forward pass (the result tensor of a head or the output layer)
+ */
+aitensor_t *aialgo_forward_model_early_exit_f32(aimodel_t *model, aialgo_early_exit_t *exits, uint16_t exits_count, aitensor_t *input_data, uint16_t *exit_index);
+
+/** @brief Perform an inference on the model with early exits
+ *
+ * Like aialgo_inference_model(), but every sample may leave the model at a confident head
+ * (see aialgo_forward_model_early_exit_f32()). The exit statistics of the heads (aialgo_early_exit.exit_count) are
+ * updated.
+ *
+ * The inference memory of the model and of all heads has to be scheduled before.
+ *
+ * @param *model        The model
+ * @param *exits        Array of the early exits of the model
+ * @param exits_count   Number of early exits
+ * @param *input_data   Input data tensor with the same shape as the input_layer (except the batch dimension)
+ * @param *output_data  Empty tensor for the results of the inference with the size of your outputs
+ * @return              Pointer to the output_data tensor with the results
+ */
+aitensor_t *aialgo_inference_model_early_exit_f32(aimodel_t *model, aialgo_early_exit_t *exits, uint16_t exits_count, aitensor_t *input_data, aitensor_t *output_data);
+
+/** @brief Perform the training of the model and the heads with the joint loss
+ *
+ * @f[
+ *  L = L_{model} + \sum_k w_k \cdot L_{head,k}
+ * @f]
+ *
+ * Like aialgo_train_model(), but the heads are calculated and backpropagated in every step. The deltas of the
+ * heads are added to the deltas of the attach layers, so the shared layers learn features for the early exits.
+ *
+ * The training memory of the model and of all heads has to be scheduled and initialized with the same optimizer.
+ *
+ * @param *model            The model
+ * @param *exits            Array of the early exits of the model
+ * @param exits_count       Number of early exits
+ * @param *input_tensor     The training data
+ * @param *target_tensor    The labels of the training data (used for the model and the heads)
+ * @param *optimizer        The optimizer that is used for the training
+ * @param batch_size        Size of a batch / Number of input vectors
+ */
+void aialgo_train_model_early_exit_f32(aimodel_t *model, aialgo_early_exit_t *exits, uint16_t exits_count, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size);
+
+#endif // AIALGO_EARLY_EXIT
@@ -0,0 +1,493 @@
+/**
+ * \file basic/base/aialgo/aialgo_full_batch.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aialgo_full_batch.h for documentation.
+ * \details
+ */
+
+#include "basic/base/aialgo/aialgo_full_batch.h"
+#include "basic/base/aialgo/aialgo_sequential_inference.h"
+#include "basic/base/aialgo/aialgo_sequential_training.h"
+#include "basic/base/aidebug/aidebug_trace.h"
+#include "basic/base/ailoss/ailoss_mse.h"
+
+#include <string.h>
+#include <math.h>
+
+// Armijo constant of the line search
+#define AIALGO_FULL_BATCH_ARMIJO            1e-4f
+#define AIALGO_FULL_BATCH_MAX_LINE_SEARCH   30
+#define AIALGO_FULL_BATCH_MAX_DAMPING       1e10f
+
+static uint32_t aialgo_full_batch_param_count(aimodel_t *model)
+{
+	uint16_t i, j;
+	uint32_t count = 0;
+	ailayer_t *layer_ptr = model->input_layer;
+
+	for(i = 0; i < model->layer_count; i++)
+	{
+		for(j = 0; j < layer_ptr->trainable_params_count; j++){
+			count += aimath_tensor_elements(layer_ptr->trainable_params[j]);
+		}
+		layer_ptr = layer_ptr->output_layer;
+	}
+	return count;
+}
+
+// Copies all trainable parameters (or their gradients) into one vector
+static void aialgo_full_batch_gather(aimodel_t *model, float *vector, uint8_t gradients)
+{
+	uint16_t i, j;
+	uint32_t elements;
+	ailayer_t *layer_ptr = model->input_layer;
+
+	for(i = 0; i < model->layer_count; i++)
+	{
+		for(j = 0; j < layer_ptr->trainable_params_count; j++){
+			elements = aimath_tensor_elements(layer_ptr->trainable_params[j]);
+			memcpy(vector, gradients ? layer_ptr->gradients[j]->data : layer_ptr->trainable_params[j]->data, elements * sizeof(float));
+			vector += elements;
+		}
+		layer_ptr = layer_ptr->output_layer;
+	}
+	return;
+}
+
+// Sets the trainable parameters to base + alpha * direction (direction may be 0)
+static void aialgo_full_batch_set_params(aimodel_t *model, const float *base, float alpha, const float *direction)
+{
+	uint16_t i, j;
+	uint32_t k, elements;
+	float *params;
+	ailayer_t *layer_ptr = model->input_layer;
+
+	for(i = 0; i < model->layer_count; i++)
+	{
+		for(j = 0; j < layer_ptr->trainable_params_count; j++){
+			elements = aimath_tensor_elements(layer_ptr->trainable_params[j]);
+			params = (float *) layer_ptr->trainable_params[j]->data;
+			for(k = 0; k < elements; k++)
+			{
+				params[k] = direction != 0 ? base[k] + alpha * direction[k] : base[k];
+			}
+			base += elements;
+			if(direction != 0){
+				direction += elements;
+			}
+		}
+		layer_ptr = layer_ptr->output_layer;
+	}
+	return;
+}
+
+static void aialgo_full_batch_zero_gradients(aimodel_t *model)
+{
+	uint16_t i, j;
+	ailayer_t *layer_ptr = model->input_layer;
+
+	for(i = 0; i < model->layer_count; i++)
+	{
+		for(j = 0; j < layer_ptr->trainable_params_count; j++){
+			memset(layer_ptr->gradients[j]->data, 0, aimath_sizeof_tensor_data(layer_ptr->gradients[j]));
+		}
+		layer_ptr = layer_ptr->output_layer;
+	}
+	return;
+}
+
+// Backward pass through the layers with the deltas that are already set in the loss
+static void aialgo_full_batch_backward_layers(aimodel_t *model)
+{
+	uint16_t i;
+	ailayer_t *layer_ptr = model->output_layer;
+
+	for(i = 0; i < model->layer_count; i++)
+	{
+		layer_ptr->backward(layer_ptr);
+		layer_ptr = layer_ptr->input_layer;
+	}
+	return;
+}
+
+static void aialgo_full_batch_sample(aitensor_t *batch, uint16_t *batch_shape, const aitensor_t *tensor, uint32_t index)
+{
+	uint16_t i;
+	uint32_t multiplier = 1;
+
+	batch->dtype = tensor->dtype;
+	batch->dim = tensor->dim;
+	batch->shape = batch_shape;
+	batch->tensor_params = tensor->tensor_params;
+	for(i = tensor->dim - 1; i > 0; i--)
+	{
+		multiplier *= tensor->shape[i];
+		batch_shape[i] = tensor->shape[i];
+	}
+	batch_shape[0] = 1;
+	batch->data = tensor->data + index * multiplier * tensor->dtype->size;
+	return;
+}
+
+// Loss over all samples and (if gradient is not 0) the sum of the gradients
+static float aialgo_full_batch_evaluate(aimodel_t *model, aialgo_full_batch_t *fit, aitensor_t *input_tensor, aitensor_t *target_tensor, float *gradient)
+{
+	uint32_t i;
+	float loss, sample_loss;
+	aitensor_t input_batch, target_batch;
+	uint16_t input_batch_shape[input_tensor->dim];
+	uint16_t target_batch_shape[target_tensor->dim];
+
+	if(gradient != 0){
+		aialgo_full_batch_zero_gradients(model);
+	}
+	loss = 0.0f;
+	for(i = 0; i < input_tensor->shape[0]; i++)
+	{
+		aialgo_full_batch_sample(&input_batch, input_batch_shape, input_tensor, i);
+		aialgo_full_batch_sample(&target_batch, target_batch_shape, target_tensor, i);
+
+		aialgo_forward_model(model, &input_batch);
+		model->loss->calc_loss(model->loss, &target_batch, &sample_loss);
+		loss += sample_loss;
+		if(gradient != 0){
+			aialgo_backward_model(model, &target_batch);
+		}
+	}
+	if(gradient != 0){
+		aialgo_full_batch_gather(model, gradient, TRUE);
+	}
+	fit->evaluations++;
+	return loss;
+}
+
+static float aialgo_full_batch_dot(const float *a, const float *b, uint32_t count)
+{
+	uint32_t i;
+	float sum = 0.0f;
+
+	for(i = 0; i < count; i++)
+	{
+		sum += a[i] * b[i];
+	}
+	return sum;
+}
+
+uint32_t aialgo_sizeof_full_batch_memory(aimodel_t *model, const aialgo_full_batch_t *fit)
+{
+	uint32_t params = aialgo_full_batch_param_count(model);
+
+	if(fit->method == AIALGO_FULL_BATCH_LEVENBERG_MARQUARDT){
+		// J^T J, J^T r, step, parameters, Jacobian row
+		return (params * params + 4 * params) * sizeof(float);
+	}
+	if(fit->history_size == 0){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("L-BFGS requires a history size of at least 1.\n");
+#endif
+		return 0;
+	}
+	// Parameters, gradient, new gradient, direction, s and y history, rho and alpha
+	return ((2 * fit->history_size + 4) * params + 2 * fit->history_size) * sizeof(float);
+}
+
+static void aialgo_full_batch_lbfgs(aimodel_t *model, aialgo_full_batch_t *fit, aitensor_t *input_tensor, aitensor_t *target_tensor,
+									float *memory, uint32_t params)
+{
+	uint32_t k;
+	uint16_t h, index, count = 0, newest = 0;
+	uint16_t m = fit->history_size;
+	float *x = memory;
+	float *g = x + params;
+	float *g_new = g + params;
+	float *d = g_new + params;
+	float *s = d + params;
+	float *y = s + m * params;
+	float *rho = y + m * params;
+	float *alpha = rho + m;
+	float loss, loss_new, slope, step, beta, gamma, sy;
+	uint8_t line_search;
+
+	aialgo_full_batch_gather(model, x, FALSE);
+	loss = aialgo_full_batch_evaluate(model, fit, input_tensor, target_tensor, g);
+
+	for(fit->iterations = 0; fit->iterations < fit->max_iterations; fit->iterations++)
+	{
+		if(loss <= fit->loss_tolerance || sqrtf(aialgo_full_batch_dot(g, g, params)) <= fit->gradient_tolerance){
+			break;
+		}
+		AIDEBUG_TRACE_BEGIN("L-BFGS", "train", fit->iterations);
+
+		// Two-loop recursion: d = -H * g
+		for(k = 0; k < params; k++) d[k] = -g[k];
+		for(h = 0; h < count; h++)
+		{
+			index = (newest + m - h) % m;
+			alpha[index] = rho[index] * aialgo_full_batch_dot(&s[index * params], d, params);
+			for(k = 0; k < params; k++) d[k] -= alpha[index] * y[index * params + k];
+		}
+		if(count > 0){
+			gamma = 1.0f / (rho[newest] * aialgo_full_batch_dot(&y[newest * params], &y[newest * params], params));
+			for(k = 0; k < params; k++) d[k] *= gamma;
+		}
+		for(h = count; h > 0; h--)
+		{
+			index = (newest + m - h + 1) % m;
+			beta = rho[index] * aialgo_full_batch_dot(&y[index * params], d, params);
+			for(k = 0; k < params; k++) d[k] += (alpha[index] - beta) * s[index * params + k];
+		}
+
+		slope = aialgo_full_batch_dot(g, d, params);
+		if(slope >= 0.0f){
+			// No descent direction: restart with the steepest descent
+			count = 0;
+			for(k = 0; k < params; k++) d[k] = -g[k];
+			slope = aialgo_full_batch_dot(g, d, params);
+		}
+
+		// Backtracking line search (the first step is scaled without curvature information)
+		step = count > 0 ? 1.0f : 1.0f / sqrtf(-slope);
+		for(line_search = 0; line_search < AIALGO_FULL_BATCH_MAX_LINE_SEARCH; line_search++)
+		{
+			aialgo_full_batch_set_params(model, x, step, d);
+			loss_new = aialgo_full_batch_evaluate(model, fit, input_tensor, target_tensor, g_new);
+			if(loss_new <= loss + AIALGO_FULL_BATCH_ARMIJO * step * slope){
+				break;
+			}
+			step *= 0.5f;
+		}
+		AIDEBUG_TRACE_END("L-BFGS", "train", fit->iterations);
+		if(line_search == AIALGO_FULL_BATCH_MAX_LINE_SEARCH){
+			// No improvement possible
+			aialgo_full_batch_set_params(model, x, 0.0f, 0);
+			break;
+		}
+
+		// Update the history with s = x_new - x and y = g_new - g (only with positive curvature)
+		sy = 0.0f;
+		for(k = 0; k < params; k++)
+		{
+			sy += step * d[k] * (g_new[k] - g[k]);
+		}
+		if(sy > 1e-10f){
+			index = (newest + 1) % m;
+			for(k = 0; k < params; k++)
+			{
+				s[index * params + k] = step * d[k];
+				y[index * params + k] = g_new[k] - g[k];
+			}
+			rho[index] = 1.0f / sy;
+			newest = index;
+			if(count < m) count++;
+		}
+		for(k = 0; k < params; k++)
+		{
+			x[k] += step * d[k];
+			g[k] = g_new[k];
+		}
+		loss = loss_new;
+	}
+	fit->loss = loss;
+	return;
+}
+
+// Solves A * x = b for a symmetric positive definite matrix A (A is overwritten by the Cholesky factor)
+static uint8_t aialgo_full_batch_cholesky_solve(float *A, const float *b, float *x, uint32_t n)
+{
+	uint32_t i, j, k;
+	float sum;
+
+	for(j = 0; j < n; j++)
+	{
+		sum = A[j * n + j];
+		for(k = 0; k < j; k++) sum -= A[j * n + k] * A[j * n + k];
+		if(sum <= 0.0f){
+			return 1;
+		}
+		A[j * n + j] = sqrtf(sum);
+		for(i = j + 1; i < n; i++)
+		{
+			sum = A[i * n + j];
+			for(k = 0; k < j; k++) sum -= A[i * n + k] * A[j * n + k];
+			A[i * n + j] = sum / A[j * n + j];
+		}
+	}
+	// L * z = b and L^T * x = z
+	for(i = 0; i < n; i++)
+	{
+		sum = b[i];
+		for(k = 0; k < i; k++) sum -= A[i * n + k] * x[k];
+		x[i] = sum / A[i * n + i];
+	}
+	for(i = n; i > 0; i--)
+	{
+		sum = x[i - 1];
+		for(k = i; k < n; k++) sum -= A[k * n + i - 1] * x[k];
+		x[i - 1] = sum / A[(i - 1) * n + i - 1];
+	}
+	return 0;
+}
+
+static void aialgo_full_batch_levenberg_marquardt(aimodel_t *model, aialgo_full_batch_t *fit, aitensor_t *input_tensor, aitensor_t *target_tensor,
+												  float *memory, uint32_t params)
+{
+	uint32_t i, k, l, o;
+	float *JtJ = memory;
+	float *Jtr = JtJ + params * params;
+	float *step = Jtr + params;
+	float *x = step + params;
+	float *row = x + params;
+	aitensor_t *deltas = &(model->loss->connection_layer.deltas);
+	uint32_t outputs = aimath_tensor_elements(&(model->output_layer->result));
+	float *deltas_data;
+	float residuals[outputs];
+	float lambda = fit->damping > 0.0f ? fit->damping : 0.001f;
+	float loss, loss_new, diagonal;
+	aitensor_t input_batch, target_batch;
+	uint16_t input_batch_shape[input_tensor->dim];
+	uint16_t target_batch_shape[target_tensor->dim];
+
+	aialgo_full_batch_gather(model, x, FALSE);
+	loss = aialgo_full_batch_evaluate(model, fit, input_tensor, target_tensor, row);
+
+	for(fit->iterations = 0; fit->iterations < fit->max_iterations; fit->iterations++)
+	{
+		if(loss <= fit->loss_tolerance || sqrtf(aialgo_full_batch_dot(row, row, params)) <= fit->gradient_tolerance){
+			break;
+		}
+		AIDEBUG_TRACE_BEGIN("Levenberg-Marquardt", "train", fit->iterations);
+
+		// Accumulate J^T J and J^T r row by row (one backward pass per output and sample)
+		memset(JtJ, 0, (params * params + params) * sizeof(float));
+		for(i = 0; i < input_tensor->shape[0]; i++)
+		{
+			aialgo_full_batch_sample(&input_batch, input_batch_shape, input_tensor, i);
+			aialgo_full_batch_sample(&target_batch, target_batch_shape, target_tensor, i);
+
+			aialgo_forward_model(model, &input_batch);
+			model->loss->calc_delta(model->loss, &target_batch);
+			deltas_data = (float *) deltas->data;
+			memcpy(residuals, deltas_data, outputs * sizeof(float));
+
+			for(o = 0; o < outputs; o++)
+			{
+				// Row of the Jacobian: Gradient of output o
+				memset(deltas_data, 0, outputs * sizeof(float));
+				deltas_data[o] = 1.0f;
+				aialgo_full_batch_zero_gradients(model);
+				aialgo_full_batch_backward_layers(model);
+				aialgo_full_batch_gather(model, row, TRUE);
+
+				for(k = 0; k < params; k++)
+				{
+					if(row[k] == 0.0f) continue;
+					for(l = 0; l <= k; l++)
+					{
+						JtJ[k * params + l] += row[k] * row[l];
+					}
+					Jtr[k] += row[k] * residuals[o];
+				}
+			}
+		}
+
+		// Keep a copy of J^T J in the (unused) upper triangle and its diagonal in the row buffer, because the
+		// lower triangle is overwritten by the Cholesky factorization
+		for(k = 0; k < params; k++)
+		{
+			for(l = 0; l < k; l++)
+			{
+				JtJ[l * params + k] = JtJ[k * params + l];
+			}
+			row[k] = JtJ[k * params + k];
+		}
+
+		// Try steps with increasing damping until the loss decreases: (J^T J + lambda * diag(J^T J)) * step = -J^T r
+		while(lambda < AIALGO_FULL_BATCH_MAX_DAMPING)
+		{
+			for(k = 0; k < params; k++)
+			{
+				for(l = 0; l < k; l++)
+				{
+					JtJ[k * params + l] = JtJ[l * params + k];
+				}
+				diagonal = row[k];
+				JtJ[k * params + k] = diagonal + lambda * (diagonal > 0.0f ? diagonal : 1.0f);
+				step[k] = -Jtr[k];
+			}
+			if(aialgo_full_batch_cholesky_solve(JtJ, step, step, params) == 0){
+				aialgo_full_batch_set_params(model, x, 1.0f, step);
+				loss_new = aialgo_full_batch_evaluate(model, fit, input_tensor, target_tensor, 0);
+			} else {
+				loss_new = loss;
+			}
+
+			if(loss_new < loss){
+				lambda = lambda * 0.1f > 1e-7f ? lambda * 0.1f : 1e-7f;
+				break;
+			}
+			lambda *= 10.0f;
+		}
+		AIDEBUG_TRACE_END("Levenberg-Marquardt", "train", fit->iterations);
+		if(lambda >= AIALGO_FULL_BATCH_MAX_DAMPING){
+			// No improvement possible
+			aialgo_full_batch_set_params(model, x, 0.0f, 0);
+			break;
+		}
+
+		for(k = 0; k < params; k++) x[k] += step[k];
+		loss = aialgo_full_batch_evaluate(model, fit, input_tensor, target_tensor, row);
+	}
+	fit->loss = loss;
+	return;
+}
+
+uint8_t aialgo_fit_full_batch_f32(aimodel_t *model, aialgo_full_batch_t *fit, aitensor_t *input_tensor, aitensor_t *target_tensor,
+								  void *memory_ptr, uint32_t memory_size)
+{
+	uint32_t params = aialgo_full_batch_param_count(model);
+
+	if(fit->method != AIALGO_FULL_BATCH_LEVENBERG_MARQUARDT && fit->history_size == 0){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("L-BFGS requires a history size of at least 1.\n");
+#endif
+		return 1;
+	}
+	if(memory_size < aialgo_sizeof_full_batch_memory(model, fit)){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("The memory for the full batch training is too small.\n");
+#endif
+		return 1;
+	}
+	if(fit->method == AIALGO_FULL_BATCH_LEVENBERG_MARQUARDT && model->loss->loss_type != ailoss_mse_type){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("Levenberg-Marquardt requires the MSE loss.\n");
+#endif
+		return 1;
+	}
+
+	fit->iterations = 0;
+	fit->evaluations = 0;
+	if(fit->method == AIALGO_FULL_BATCH_LEVENBERG_MARQUARDT){
+		aialgo_full_batch_levenberg_marquardt(model, fit, input_tensor, target_tensor, (float *) memory_ptr, params);
+	} else {
+		aialgo_full_batch_lbfgs(model, fit, input_tensor, target_tensor, (float *) memory_ptr, params);
+	}
+	return 0;
+}
@@ -0,0 +1,128 @@
+/**
+ * \file basic/base/aialgo/aialgo_full_batch.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Full batch training with L-BFGS or Levenberg-Marquardt for small models
+ * \details For small models and data sets (like the XOR example or calibration networks), quasi-Newton methods on the
+ * whole data set need far less iterations than SGD or Adam. Every iteration uses the loss and the gradient of the
+ * complete training data set (the sum over all samples).
+ *
+ * **L-BFGS** approximates the inverse Hessian with the last history_size parameter and gradient changes and uses a
+ * backtracking line search (Armijo condition). It works with every loss.
+ *
+ * **Levenberg-Marquardt** solves the damped Gauss-Newton equations
+ * @f[
+ *  (J^T J + \lambda \cdot diag(J^T J)) \cdot \Delta p = - J^T r
+ * @f]
+ * with the residuals r and the Jacobian J of all outputs of all samples. The Jacobian is calculated row by row with the
+ * backward pass of the model (one backward pass per output and sample) and directly accumulated into
+ * \f$ J^T J \f$, so only \f$ P^2 \f$ values are stored for P trainable parameters. It requires the
+ * \link ailoss_mse.h MSE loss \endlink.
+ *
+ * The model must be compiled and have the parameter memory and the training memory assigned (the gradients of the
+ * layers are used). The optimizer that was used to schedule the training memory is not needed, so a
+ * \link aiopti_sgd.h SGD optimizer \endlink without momentum is sufficient. Only \link aimath_f32.h F32 \endlink
+ * models are supported.
+ *
+ * Example:
+ * \code{.c}
+ * aialgo_full_batch_t fit = {
+ *     .method = AIALGO_FULL_BATCH_LBFGS,
+ *     .history_size = 5,
+ *     .max_iterations = 50,
+ *     .loss_tolerance = 0.001f,
+ *     .gradient_tolerance = 1e-6f
+ * };
+ *
+ * uint32_t memory_size = aialgo_sizeof_full_batch_memory(&model, &fit);
+ * void *memory_ptr = malloc(memory_size);
+ *
+ * aialgo_fit_full_batch_f32(&model, &fit, &input_tensor, &target_tensor, memory_ptr, memory_size);
+ * \endcode
+ */
+
+#ifndef AIALGO_FULL_BATCH
+#define AIALGO_FULL_BATCH
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+#define AIALGO_FULL_BATCH_LBFGS                 0 /**< Limited memory BFGS with backtracking line search. */
+#define AIALGO_FULL_BATCH_LEVENBERG_MARQUARDT   1 /**< Levenberg-Marquardt (only for the MSE loss). */
+
+typedef struct aialgo_full_batch  aialgo_full_batch_t;
+
+/** @brief Configuration and results of a full batch training
+ *
+ */
+struct aialgo_full_batch {
+	/** @name Configuration
+	 * @brief Required configuration parameters
+	 */
+	///@{
+	uint8_t method; /**< AIALGO_FULL_BATCH_LBFGS or AIALGO_FULL_BATCH_LEVENBERG_MARQUARDT. */
+	uint16_t history_size; /**< L-BFGS: Number of stored parameter and gradient changes (at least 1, for example 5). */
+	uint16_t max_iterations; /**< Maximum number of iterations. */
+	float loss_tolerance; /**< The training stops if the loss (sum over all samples) is lower. */
+	float gradient_tolerance; /**< The training stops if the norm of the gradient is lower. */
+	float damping; /**< Levenberg-Marquardt: Initial damping factor lambda (0 for the default of 0.001). */
+	///@}
+
+	/** @name Results
+	 * @brief Set by aialgo_fit_full_batch_f32()
+	 */
+	///@{
+	uint16_t iterations; /**< Number of performed iterations. */
+	uint32_t evaluations; /**< Number of full batch evaluations of the loss (forward passes over the data set). */
+	float loss; /**< Final loss (sum over all samples). */
+	///@}
+};
+
+/** @brief Calculate the memory size for the full batch training
+ *
+ * L-BFGS: \f$ (2 \cdot history\_size + 4) \cdot P + 2 \cdot history\_size \f$ floats,
+ * Levenberg-Marquardt: \f$ P^2 + 4 \cdot P \f$ floats (P: Number of trainable parameters).
+ *
+ * @param *model    The model (parameter memory must be assigned)
+ * @param *fit      The configuration
+ * @return          Required memory size in bytes (0 for an invalid configuration)
+ */
+uint32_t aialgo_sizeof_full_batch_memory(aimodel_t *model, const aialgo_full_batch_t *fit);
+
+/** @brief Train the model on the full data set with L-BFGS or Levenberg-Marquardt
+ *
+ * The training stops after max_iterations iterations, if the loss is lower than loss_tolerance, if the norm of the
+ * gradient is lower than gradient_tolerance or if no further improvement is possible.
+ * The number of iterations and the final loss are written to the configuration structure.
+ *
+ * @param *model        The model
+ * @param *fit          The configuration, the results are written to it
+ * @param *input_tensor Tensor with the training data (all samples)
+ * @param *target_tensor Tensor with the target data (all samples)
+ * @param *memory_ptr   Pointer to the memory block
+ * @param memory_size   Size of the memory block (see aialgo_sizeof_full_batch_memory())
+ * @return              0 if successful
+ */
+uint8_t aialgo_fit_full_batch_f32(aimodel_t *model, aialgo_full_batch_t *fit, aitensor_t *input_tensor, aitensor_t *target_tensor,
+								  void *memory_ptr, uint32_t memory_size);
+
+#endif // AIALGO_FULL_BATCH
@@ -0,0 +1,268 @@
+/**
+ * \file basic/base/aialgo/aialgo_inference_cache.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aialgo_inference_cache.h for documentation.
+ * \details
+ */
+
+#include "basic/base/aialgo/aialgo_inference_cache.h"
+#include "basic/base/aialgo/aialgo_sequential_inference.h"
+#include "basic/base/aimath/aimath_f32.h"
+#include "basic/base/aimath/aimath_q15.h"
+
+#include <string.h>
+#include <math.h>
+
+// Header of a cache entry, followed by the key and the output (data and tensor_params)
+typedef struct aialgo_inference_cache_entry {
+	uint32_t hash;
+	uint32_t last_used; // 0 for an empty entry
+} aialgo_inference_cache_entry_t;
+
+static uint8_t aialgo_inference_cache_is_quantized(aimodel_t *model, aialgo_inference_cache_t *cache)
+{
+	return cache->quantization_step > 0.0f && model->input_layer->result.dtype == aif32;
+}
+
+// FNV-1a hash
+static uint32_t aialgo_inference_cache_hash(const uint8_t *key, uint32_t size)
+{
+	uint32_t i;
+	uint32_t hash = 2166136261u;
+
+	for(i = 0; i < size; i++)
+	{
+		hash ^= key[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+static void aialgo_inference_cache_make_key(aimodel_t *model, aialgo_inference_cache_t *cache, const aitensor_t *sample, uint8_t *key)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(sample);
+	int32_t *key_int;
+	float *sample_data;
+
+	if(aialgo_inference_cache_is_quantized(model, cache))
+	{
+		key_int = (int32_t *) key;
+		sample_data = (float *) sample->data;
+		for(i = 0; i < elements; i++)
+		{
+			key_int[i] = (int32_t) floorf(sample_data[i] / cache->quantization_step + 0.5f);
+		}
+	}
+	else
+	{
+		memcpy(key, sample->data, aimath_sizeof_tensor_data(sample));
+		if(sample->tensor_params != 0)
+		{
+			memcpy(key + aimath_sizeof_tensor_data(sample), sample->tensor_params, aimath_sizeof_tensor_params(sample));
+		}
+	}
+	return;
+}
+
+// Size of the key of one sample
+static uint32_t aialgo_inference_cache_sizeof_key(aimodel_t *model, aialgo_inference_cache_t *cache, const aitensor_t *input_sample)
+{
+	if(aialgo_inference_cache_is_quantized(model, cache)){
+		return aimath_tensor_elements(input_sample) * sizeof(int32_t);
+	} else {
+		return aimath_sizeof_tensor_data(input_sample) + aimath_sizeof_tensor_params(input_sample);
+	}
+}
+
+// Tensor of the layer result with shape[0] = 1 (one sample); only for size calculations, data is not set
+static aitensor_t aialgo_inference_cache_sample_tensor(const aitensor_t *tensor, uint16_t *sample_shape)
+{
+	uint8_t i;
+	aitensor_t sample = {
+		.dtype = tensor->dtype,
+		.dim = tensor->dim,
+		.shape = sample_shape,
+		.tensor_params = tensor->tensor_params,
+		.data = 0
+	};
+
+	for(i = 1; i < tensor->dim; i++)
+	{
+		sample_shape[i] = tensor->shape[i];
+	}
+	sample_shape[0] = 1;
+	return sample;
+}
+
+uint32_t aialgo_sizeof_inference_cache_entry(aimodel_t *model, aialgo_inference_cache_t *cache)
+{
+	uint32_t size;
+	uint16_t input_shape[model->input_layer->result.dim];
+	uint16_t output_shape[model->output_layer->result.dim];
+	aitensor_t input = aialgo_inference_cache_sample_tensor(&(model->input_layer->result), input_shape);
+	aitensor_t output = aialgo_inference_cache_sample_tensor(&(model->output_layer->result), output_shape);
+
+	size = sizeof(aialgo_inference_cache_entry_t);
+	size += aialgo_inference_cache_sizeof_key(model, cache, &input);
+	size += aimath_sizeof_tensor_data(&output) + aimath_sizeof_tensor_params(&output);
+
+	// Keep the entries 4 byte aligned
+	return (size + 3) & ~((uint32_t) 3);
+}
+
+uint8_t aialgo_init_inference_cache(aialgo_inference_cache_t *cache, aimodel_t *model, void *memory_ptr, uint32_t memory_size)
+{
+	uint16_t input_shape[model->input_layer->result.dim];
+	uint16_t output_shape[model->output_layer->result.dim];
+	aitensor_t input = aialgo_inference_cache_sample_tensor(&(model->input_layer->result), input_shape);
+	aitensor_t output = aialgo_inference_cache_sample_tensor(&(model->output_layer->result), output_shape);
+
+	cache->memory = memory_ptr;
+	cache->entry_size = aialgo_sizeof_inference_cache_entry(model, cache);
+	cache->entry_count = memory_size / cache->entry_size;
+	cache->key_size = aialgo_inference_cache_sizeof_key(model, cache, &input);
+	cache->output_size = aimath_sizeof_tensor_data(&output) + aimath_sizeof_tensor_params(&output);
+	cache->hits = 0;
+	cache->misses = 0;
+
+	aialgo_clear_inference_cache(cache);
+
+	if(cache->entry_count == 0){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("The memory of the inference cache is too small for one entry.\n");
+#endif
+		return 1;
+	}
+	return 0;
+}
+
+void aialgo_clear_inference_cache(aialgo_inference_cache_t *cache)
+{
+	uint32_t i;
+
+	for(i = 0; i < cache->entry_count; i++)
+	{
+		((aialgo_inference_cache_entry_t *) (cache->memory + i * cache->entry_size))->last_used = 0;
+	}
+	cache->use_counter = 0;
+	return;
+}
+
+aitensor_t *aialgo_inference_model_cached(aimodel_t *model, aialgo_inference_cache_t *cache, aitensor_t *input_data, aitensor_t *output_data)
+{
+	uint32_t i, j;
+	uint32_t hash;
+	aialgo_inference_cache_entry_t *entry, *victim;
+	uint8_t *entry_output;
+	aitensor_t *output_batch;
+
+	if(!cache->enabled || cache->entry_count == 0)
+	{
+		return aialgo_inference_model(model, input_data, output_data);
+	}
+
+	uint8_t key[cache->key_size];
+	uint16_t input_batch_shape[input_data->dim];
+	aitensor_t input_batch = {
+	    .dtype = input_data->dtype,
+        .shape = input_batch_shape,
+        .dim = input_data->dim,
+        .tensor_params = input_data->tensor_params
+	};
+	uint16_t output_sample_shape[model->output_layer->result.dim];
+	aitensor_t output_sample = aialgo_inference_cache_sample_tensor(&(model->output_layer->result), output_sample_shape);
+	uint32_t output_data_size = aimath_sizeof_tensor_data(&output_sample);
+	uint32_t output_params_size = aimath_sizeof_tensor_params(&output_sample);
+	aimath_q15_params_t output_sample_q15_params;
+
+	uint32_t input_multiplier = 1;
+	for(i = input_data->dim - 1; i > 0; i--)
+	{
+		input_multiplier *= input_data->shape[i];
+		input_batch_shape[i] = input_data->shape[i];
+	}
+	input_batch_shape[0] = 1;
+
+	for(i = 0; i < input_data->shape[0]; i++)
+	{
+		input_batch.data = input_data->data + i * input_multiplier * input_data->dtype->size;
+
+		if(cache->use_counter == UINT32_MAX){
+			// Restart the usage counter (instead of an overflow)
+			aialgo_clear_inference_cache(cache);
+		}
+
+		aialgo_inference_cache_make_key(model, cache, &input_batch, key);
+		hash = aialgo_inference_cache_hash(key, cache->key_size);
+
+		// Search the entry and the least recently used entry for the replacement
+		victim = 0;
+		for(j = 0; j < cache->entry_count; j++)
+		{
+			entry = (aialgo_inference_cache_entry_t *) (cache->memory + j * cache->entry_size);
+			if(entry->last_used != 0 && entry->hash == hash && memcmp((uint8_t *) (entry + 1), key, cache->key_size) == 0)
+			{
+				break;
+			}
+			if(victim == 0 || entry->last_used < victim->last_used)
+			{
+				victim = entry;
+			}
+		}
+
+		if(j < cache->entry_count)
+		{
+			// Hit
+			cache->hits++;
+		}
+		else
+		{
+			// Miss: Infer the sample and store the output
+			cache->misses++;
+			output_batch = aialgo_forward_model(model, &input_batch);
+
+			entry = victim;
+			entry->hash = hash;
+			memcpy((uint8_t *) (entry + 1), key, cache->key_size);
+			entry_output = (uint8_t *) (entry + 1) + cache->key_size;
+			memcpy(entry_output, output_batch->data, output_data_size);
+			if(output_params_size != 0){
+				memcpy(entry_output + output_data_size, output_batch->tensor_params, output_params_size);
+			}
+		}
+		entry->last_used = ++cache->use_counter;
+
+		entry_output = (uint8_t *) (entry + 1) + cache->key_size;
+		if(output_data->dtype == aiq15){
+			// Every sample has its own shift, copy it to the common shift of the batch
+			memcpy(&output_sample_q15_params, entry_output + output_data_size, sizeof(aimath_q15_params_t));
+			output_sample.data = entry_output;
+			output_sample.tensor_params = &output_sample_q15_params;
+			aialgo_copy_q15_sample(&output_sample, output_data, i, aimath_tensor_elements(&output_sample));
+			continue;
+		}
+		memcpy(output_data->data + i * output_data_size, entry_output, output_data_size);
+		if(output_params_size != 0){
+			memcpy(output_data->tensor_params, entry_output + output_data_size, output_params_size);
+		}
+	}
+	return output_data;
+}
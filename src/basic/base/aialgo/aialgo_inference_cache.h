@@ -0,0 +1,136 @@
+/**
+ * \file basic/base/aialgo/aialgo_inference_cache.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Memoization cache for the results of the inference
+ * \details For control loops with discretised or repeating sensor states the same inputs are often inferred again.
+ * The inference cache stores the outputs of the last inputs in a fixed memory budget and returns the stored outputs
+ * if the same (or for F32 with a quantization step, a similar) input is inferred again, so the network is skipped.
+ *
+ * Every input sample is converted to a key (the raw input bytes with the tensor_params or, if
+ * aialgo_inference_cache.quantization_step is set for F32 inputs, the rounded multiples of the step size) and hashed.
+ * On a miss the model is inferred and the output is stored in the least recently used entry.
+ *
+ * The cache belongs to one model and has to be cleared (aialgo_clear_inference_cache()) when the parameters of the
+ * model change.
+ *
+ * Example:
+ * \code{.c}
+ * aialgo_inference_cache_t cache = {
+ *     .quantization_step = 0.01f,
+ *     .enabled = TRUE
+ * };
+ * uint8_t cache_memory[512];
+ *
+ * aialgo_init_inference_cache(&cache, &model, cache_memory, sizeof(cache_memory));
+ *
+ * aialgo_inference_model_cached(&model, &cache, &input_tensor, &output_tensor);
+ * printf("hits: %lu; misses: %lu\n", cache.hits, cache.misses);
+ * \endcode
+ */
+
+#ifndef AIALGO_INFERENCE_CACHE
+#define AIALGO_INFERENCE_CACHE
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+typedef struct aialgo_inference_cache  aialgo_inference_cache_t;
+
+/** @brief Inference cache of a model
+ *
+ * The configuration fields have to be set by the user, the other fields are set by aialgo_init_inference_cache().
+ */
+struct aialgo_inference_cache {
+	/** @name Configuration
+	 */
+	///@{
+	float quantization_step; /**< Step size for the quantization of F32 inputs in the key (0 for exact keys). */
+	uint8_t enabled; /**< FALSE to bypass the cache (the model is inferred every time). */
+	///@}
+
+	/** @name Cache state
+	 */
+	///@{
+	void *memory; /**< Memory of the cache entries. */
+	uint32_t entry_count; /**< Number of entries that fit into the memory budget. */
+	uint32_t entry_size; /**< Size of one entry in bytes. */
+	uint32_t key_size; /**< Size of the key of an entry in bytes. */
+	uint32_t output_size; /**< Size of the output data and tensor_params of an entry in bytes. */
+	uint32_t use_counter; /**< Counter for the least recently used replacement. */
+	///@}
+
+	/** @name Statistics
+	 */
+	///@{
+	uint32_t hits; /**< Number of samples that were found in the cache. */
+	uint32_t misses; /**< Number of samples that were inferred and stored in the cache. */
+	///@}
+};
+
+/** @brief Calculate the memory size of one cache entry for the model
+ *
+ * @param *model    The compiled model
+ * @param *cache    The cache with the configuration fields set
+ * @return          Size of one entry in bytes
+ */
+uint32_t aialgo_sizeof_inference_cache_entry(aimodel_t *model, aialgo_inference_cache_t *cache);
+
+/** @brief Initialize the inference cache for the model with the given memory budget
+ *
+ * The number of entries is the memory size divided by aialgo_sizeof_inference_cache_entry().
+ * The statistics are set to zero.
+ *
+ * @param *cache        The cache with the configuration fields set
+ * @param *model        The compiled model
+ * @param *memory_ptr   Memory for the cache entries (should be 4 byte aligned)
+ * @param memory_size   Size of the memory (memory budget) in bytes
+ * @return              0 if successful, 1 if the memory is too small for one entry
+ */
+uint8_t aialgo_init_inference_cache(aialgo_inference_cache_t *cache, aimodel_t *model, void *memory_ptr, uint32_t memory_size);
+
+/** @brief Remove all entries from the cache
+ *
+ * Call this function after the parameters of the model have changed. The statistics are not changed.
+ *
+ * @param *cache    The cache to clear
+ */
+void aialgo_clear_inference_cache(aialgo_inference_cache_t *cache);
+
+/** @brief Perform an inference with the result cache
+ *
+ * Like aialgo_inference_model(), but for every input sample the cache is searched first. On a hit the stored
+ * output is copied to output_data, on a miss the model is inferred and the output is stored in the cache.
+ * If the cache is disabled (aialgo_inference_cache.enabled is FALSE), aialgo_inference_model() is called directly.
+ * \link aimath_q15.h Q15 \endlink outputs are stored with one common shift for all samples, like in aialgo_inference_model().
+ *
+ * The inference memory of the model has to be scheduled before.
+ *
+ * @param *model        The model
+ * @param *cache        The initialized cache of the model
+ * @param *input_data   Input data tensor with the same shape as the input_layer (except the batch dimension)
+ * @param *output_data  Empty tensor for the results of the inference with the size of your outputs
+ * @return              Pointer to the output_data tensor with the results
+ */
+aitensor_t *aialgo_inference_model_cached(aimodel_t *model, aialgo_inference_cache_t *cache, aitensor_t *input_data, aitensor_t *output_data);
+
+#endif // AIALGO_INFERENCE_CACHE
@@ -0,0 +1,265 @@
+/**
+ * \file basic/base/aialgo/aialgo_replay.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aialgo_replay.h for documentation.
+ * \details
+ */
+
+#include "basic/base/aialgo/aialgo_replay.h"
+#include "basic/base/aialgo/aialgo_sequential_inference.h"
+#include "basic/base/aialgo/aialgo_sequential_training.h"
+#include "basic/base/aidebug/aidebug_trace.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+// Round up to a multiple of 4 bytes for the alignment of the stored data
+#define AIALGO_REPLAY_ALIGN(x)  (((x) + 3) & ~((uint32_t) 3))
+
+static uint8_t aialgo_replay_is_compressed(const aialgo_replay_buffer_t *buffer)
+{
+	return buffer->storage_dtype != 0 && buffer->storage_dtype != buffer->sample_dtype;
+}
+
+static const aitensor_t *aialgo_replay_sample_source(const aialgo_replay_buffer_t *buffer, aimodel_t *model)
+{
+	return buffer->feature_layer != 0 ? &(buffer->feature_layer->result) : &(model->input_layer->result);
+}
+
+static void aialgo_replay_calc_sizes(aialgo_replay_buffer_t *buffer, aimodel_t *model)
+{
+	const aitensor_t *source = aialgo_replay_sample_source(buffer, model);
+	const aitensor_t *output = &(model->output_layer->result);
+
+	buffer->sample_dtype = source->dtype;
+	buffer->sample_elements = aimath_tensor_elements(source) / source->shape[0];
+	buffer->target_size = AIALGO_REPLAY_ALIGN(aimath_tensor_elements(output) / output->shape[0] * aimath_sizeof_dtype(output->dtype));
+	if(aialgo_replay_is_compressed(buffer)){
+		buffer->params_size = AIALGO_REPLAY_ALIGN(buffer->storage_dtype->tensor_params_size);
+		buffer->slot_size = buffer->params_size + AIALGO_REPLAY_ALIGN(buffer->sample_elements * aimath_sizeof_dtype(buffer->storage_dtype))
+							+ buffer->target_size;
+	} else {
+		buffer->params_size = 0;
+		buffer->slot_size = AIALGO_REPLAY_ALIGN(buffer->sample_elements * aimath_sizeof_dtype(buffer->sample_dtype)) + buffer->target_size;
+	}
+	return;
+}
+
+// Uniform random number in [0, n) (rand() may only provide 15 bits)
+static uint32_t aialgo_replay_random(uint32_t n)
+{
+	uint32_t r = ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+	return r % n;
+}
+
+uint32_t aialgo_sizeof_replay_buffer_memory(aialgo_replay_buffer_t *buffer, aimodel_t *model)
+{
+	uint32_t memory;
+
+	aialgo_replay_calc_sizes(buffer, model);
+	memory = buffer->capacity * buffer->slot_size;
+	if(aialgo_replay_is_compressed(buffer)){
+		memory += AIALGO_REPLAY_ALIGN(buffer->sample_elements * aimath_sizeof_dtype(buffer->sample_dtype));
+	}
+	return memory;
+}
+
+uint8_t aialgo_init_replay_buffer(aialgo_replay_buffer_t *buffer, aimodel_t *model, void *memory_ptr, uint32_t memory_size)
+{
+	if(memory_size < aialgo_sizeof_replay_buffer_memory(buffer, model)){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("The memory for the replay buffer is too small.\n");
+#endif
+		return 1;
+	}
+	if(aialgo_replay_is_compressed(buffer) && (buffer->quantize == 0 || buffer->dequantize == 0)){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("The replay buffer needs quantize and dequantize functions for the storage data type.\n");
+#endif
+		return 1;
+	}
+
+	buffer->slots = (uint8_t *) memory_ptr;
+	buffer->scratch = aialgo_replay_is_compressed(buffer) ? memory_ptr + buffer->capacity * buffer->slot_size : 0;
+	aialgo_reset_replay_buffer(buffer);
+	return 0;
+}
+
+void aialgo_reset_replay_buffer(aialgo_replay_buffer_t *buffer)
+{
+	buffer->sample_count = 0;
+	buffer->seen_count = 0;
+	return;
+}
+
+// Reservoir sampling: the n-th seen sample replaces a random stored sample with probability capacity / n
+static void aialgo_replay_offer(aialgo_replay_buffer_t *buffer, const aitensor_t *sample, const aitensor_t *target)
+{
+	uint32_t slot;
+	uint8_t *slot_ptr;
+	aitensor_t stored;
+
+	buffer->seen_count++;
+	if(buffer->sample_count < buffer->capacity){
+		slot = buffer->sample_count++;
+	} else {
+		slot = aialgo_replay_random(buffer->seen_count);
+		if(slot >= buffer->capacity){
+			return;
+		}
+	}
+
+	slot_ptr = buffer->slots + slot * buffer->slot_size;
+	if(aialgo_replay_is_compressed(buffer)){
+		stored.dtype = buffer->storage_dtype;
+		stored.dim = sample->dim;
+		stored.shape = sample->shape;
+		stored.tensor_params = slot_ptr;
+		stored.data = slot_ptr + buffer->params_size;
+		buffer->quantize(sample, &stored);
+	} else {
+		memcpy(slot_ptr, sample->data, buffer->sample_elements * aimath_sizeof_dtype(buffer->sample_dtype));
+	}
+	memcpy(slot_ptr + buffer->slot_size - buffer->target_size, target->data, aimath_sizeof_tensor_data(target));
+	return;
+}
+
+// Writes the stored sample into the data of the given sample tensor (or sets the data pointer to it)
+static void aialgo_replay_load(aialgo_replay_buffer_t *buffer, uint32_t slot, aitensor_t *sample, aitensor_t *target, uint8_t copy)
+{
+	uint8_t *slot_ptr = buffer->slots + slot * buffer->slot_size;
+	aitensor_t stored;
+
+	if(aialgo_replay_is_compressed(buffer)){
+		stored.dtype = buffer->storage_dtype;
+		stored.dim = sample->dim;
+		stored.shape = sample->shape;
+		stored.tensor_params = slot_ptr;
+		stored.data = slot_ptr + buffer->params_size;
+		if(!copy){
+			sample->data = buffer->scratch;
+		}
+		buffer->dequantize(&stored, sample);
+	} else if(copy){
+		memcpy(sample->data, slot_ptr, buffer->sample_elements * aimath_sizeof_dtype(buffer->sample_dtype));
+	} else {
+		sample->data = slot_ptr;
+	}
+	target->data = slot_ptr + buffer->slot_size - buffer->target_size;
+	return;
+}
+
+// Forward and backward pass of a replayed sample
+static void aialgo_replay_train_sample(aimodel_t *model, aialgo_replay_buffer_t *buffer, aitensor_t *target_batch)
+{
+	uint32_t slot = aialgo_replay_random(buffer->sample_count);
+	ailayer_t *layer_ptr;
+	aitensor_t sample;
+
+	if(buffer->feature_layer == 0){
+		sample = model->input_layer->result;
+		aialgo_replay_load(buffer, slot, &sample, target_batch, FALSE);
+		aialgo_forward_model(model, &sample);
+		aialgo_backward_model(model, target_batch);
+		return;
+	}
+
+	// Only the layers after the feature layer
+	aialgo_replay_load(buffer, slot, &(buffer->feature_layer->result), target_batch, TRUE);
+	for(layer_ptr = buffer->feature_layer->output_layer; ; layer_ptr = layer_ptr->output_layer)
+	{
+		layer_ptr->forward(layer_ptr);
+		if(layer_ptr == model->output_layer) break;
+	}
+	model->loss->calc_delta(model->loss, target_batch);
+	for(layer_ptr = model->output_layer; layer_ptr != buffer->feature_layer; layer_ptr = layer_ptr->input_layer)
+	{
+		layer_ptr->backward(layer_ptr);
+	}
+	return;
+}
+
+void aialgo_train_model_with_replay(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer,
+									uint32_t batch_size, aialgo_replay_buffer_t *buffer)
+{
+	uint32_t i;
+	uint16_t r;
+
+	aitensor_t input_batch;
+	uint16_t input_batch_shape[input_tensor->dim];
+	input_batch.dtype = input_tensor->dtype;
+	input_batch.dim = input_tensor->dim;
+	input_batch.shape = input_batch_shape;
+	input_batch.tensor_params = input_tensor->tensor_params;
+	aitensor_t target_batch;
+	uint16_t target_batch_shape[target_tensor->dim];
+	target_batch.dtype = target_tensor->dtype;
+	target_batch.dim = target_tensor->dim;
+	target_batch.shape = target_batch_shape;
+	target_batch.tensor_params = target_tensor->tensor_params;
+
+	uint32_t input_multiplier = 1;
+	for(i = input_tensor->dim - 1; i > 0; i--)
+	{
+		input_multiplier *= input_tensor->shape[i];
+		input_batch_shape[i] = input_tensor->shape[i];
+	}
+	input_multiplier *= input_tensor->dtype->size;
+	input_batch_shape[0] = 1;
+	uint32_t target_multiplier = 1;
+	for(i = target_tensor->dim - 1; i > 0; i--)
+	{
+		target_multiplier *= target_tensor->shape[i];
+		target_batch_shape[i] = target_tensor->shape[i];
+	}
+	target_multiplier *= target_tensor->dtype->size;
+	target_batch_shape[0] = 1;
+
+	uint32_t batch_count = (uint32_t) (input_tensor->shape[0] / batch_size);
+	uint32_t batch;
+	for(batch = 0; batch < batch_count; batch++)
+	{
+		AIDEBUG_TRACE_BEGIN("Batch", "train", batch);
+		aialgo_zero_gradients_model(model, optimizer);
+
+		// Replayed samples first, so that the new samples of this batch can't be replayed in the same batch
+		if(buffer->sample_count > 0){
+			AIDEBUG_TRACE_BEGIN("Replay", "train", buffer->replay_count);
+			for(r = 0; r < buffer->replay_count; r++)
+			{
+				aialgo_replay_train_sample(model, buffer, &target_batch);
+			}
+			AIDEBUG_TRACE_END("Replay", "train", buffer->replay_count);
+		}
+
+		for(i = 0; i < batch_size; i++)
+		{
+			input_batch.data = input_tensor->data + batch * input_multiplier * batch_size + i * input_multiplier;
+			target_batch.data = target_tensor->data + batch * target_multiplier * batch_size + i * target_multiplier;
+
+			aialgo_forward_model(model, &input_batch);
+			aialgo_replay_offer(buffer, buffer->feature_layer != 0 ? &(buffer->feature_layer->result) : &input_batch, &target_batch);
+			aialgo_backward_model(model, &target_batch);
+		}
+		aialgo_update_params_model(model, optimizer);
+		AIDEBUG_TRACE_END("Batch", "train", batch);
+	}
+	return;
+}
@@ -0,0 +1,155 @@
+/**
+ * \file basic/base/aialgo/aialgo_replay.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Bounded replay buffer for continual learning on the device
+ * \details A model that is trained only with new data forgets what it learned from older data (catastrophic
+ * forgetting). The replay buffer keeps a fixed number of previously seen samples and mixes them into every training
+ * batch.
+ *
+ * The samples are selected with reservoir sampling: every sample that was seen so far has the same probability to
+ * be in the buffer, independent of the number of seen samples. The RAM is bounded by the capacity of the buffer and
+ * the additional compute per batch by the number of replayed samples (replay_count).
+ *
+ * To save memory, the samples can be stored compressed (for example as \link aimath_q7.h Q7 \endlink with own
+ * quantization parameters per sample) and / or as the results of an intermediate layer (feature_layer) instead of
+ * the raw inputs. In the latter case the replayed samples only train the layers after the feature layer, which is
+ * intended for models with a fixed (pretrained) feature extractor.
+ *
+ * Example:
+ * \code{.c}
+ * aialgo_replay_buffer_t replay = {
+ *     .capacity = 200,
+ *     .replay_count = 4,
+ *     .storage_dtype = aiq7,
+ *     .quantize = aimath_q7_default_quantize_f32,
+ *     .dequantize = aimath_q7_default_dequantize_f32,
+ *     .feature_layer = 0
+ * };
+ *
+ * uint32_t replay_memory_size = aialgo_sizeof_replay_buffer_memory(&replay, &model);
+ * void *replay_memory = malloc(replay_memory_size);
+ * aialgo_init_replay_buffer(&replay, &model, replay_memory, replay_memory_size);
+ *
+ * // For every new chunk of training data
+ * aialgo_train_model_with_replay(&model, &input_tensor, &target_tensor, optimizer, batch_size, &replay);
+ * \endcode
+ */
+
+#ifndef AIALGO_REPLAY
+#define AIALGO_REPLAY
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+typedef struct aialgo_replay_buffer  aialgo_replay_buffer_t;
+
+/** @brief Configuration and state of a replay buffer
+ *
+ */
+struct aialgo_replay_buffer {
+	/** @name Configuration
+	 * @brief Required configuration parameters
+	 */
+	///@{
+	uint32_t capacity; /**< Maximum number of stored samples (memory budget). */
+	uint16_t replay_count; /**< Number of replayed samples that are added to every batch (compute budget). */
+	ailayer_t *feature_layer; /**< Store the results of this layer instead of the inputs of the model (0 for the raw inputs). */
+
+	/** @brief Data type of the stored samples (0 to store the samples in their own data type)
+	 *
+	 * If the data type differs from the data type of the samples, the quantize and dequantize functions are required.
+	 */
+	const aimath_dtype_t *storage_dtype;
+
+	/** @brief Optional math function: Conversion of a sample into the storage data type
+	 *
+	 * The quantization parameters are written to the tensor_params of the result.
+	 * For example aimath_q7_default_quantize_f32().
+	 */
+	void (*quantize)(const aitensor_t *x, aitensor_t *result);
+
+	/** @brief Optional math function: Conversion of a stored sample back into the data type of the samples
+	 *
+	 * For example aimath_q7_default_dequantize_f32().
+	 */
+	void (*dequantize)(const aitensor_t *x, aitensor_t *result);
+	///@}
+
+	/** @name Variables for internal use only
+	 */
+	///@{
+	uint32_t sample_count; /**< Number of stored samples. */
+	uint32_t seen_count; /**< Number of samples that were offered to the buffer so far. */
+	uint32_t sample_elements; /**< Number of elements of one stored input (or feature) sample. */
+	uint32_t target_size; /**< Size of one stored target sample in bytes. */
+	uint32_t slot_size; /**< Size of one slot (quantization parameters, sample and target) in bytes. */
+	uint32_t params_size; /**< Size of the quantization parameters in a slot in bytes. */
+	const aimath_dtype_t *sample_dtype; /**< Data type of the samples (inputs or results of the feature layer). */
+	uint8_t *slots; /**< Memory of the stored samples. */
+	void *scratch; /**< Buffer for a converted sample (only with a different storage data type). */
+	///@}
+};
+
+/** @brief Calculate the memory size for the replay buffer
+ *
+ * The model must be compiled, so that the shapes of the layers are known.
+ *
+ * @param *buffer   The replay buffer configuration
+ * @param *model    The model
+ * @return          Required memory size in bytes
+ */
+uint32_t aialgo_sizeof_replay_buffer_memory(aialgo_replay_buffer_t *buffer, aimodel_t *model);
+
+/** @brief Assign the memory to the replay buffer and clear it
+ *
+ * @param *buffer       The replay buffer
+ * @param *model        The model
+ * @param *memory_ptr   Pointer to the memory block
+ * @param memory_size   Size of the memory block (see aialgo_sizeof_replay_buffer_memory())
+ * @return              0 if successful
+ */
+uint8_t aialgo_init_replay_buffer(aialgo_replay_buffer_t *buffer, aimodel_t *model, void *memory_ptr, uint32_t memory_size);
+
+/** @brief Remove all samples from the replay buffer
+ *
+ * @param *buffer   The replay buffer
+ */
+void aialgo_reset_replay_buffer(aialgo_replay_buffer_t *buffer);
+
+/** @brief Perform one training epoch on the new data and mix stored samples into every batch
+ *
+ * Like aialgo_train_model(), but every batch additionally contains replay_count randomly selected samples from the
+ * replay buffer. After the forward pass, every new sample is offered to the replay buffer (reservoir sampling).
+ * If a feature layer is set, the replayed samples are only propagated through the layers after the feature layer.
+ *
+ * @param *model            The model
+ * @param *input_tensor     The new training data
+ * @param *target_tensor    The target data / labels of the new training data
+ * @param *optimizer        The optimizer that is used for training
+ * @param batch_size        Number of new samples in a batch
+ * @param *buffer           The replay buffer
+ */
+void aialgo_train_model_with_replay(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer,
+									uint32_t batch_size, aialgo_replay_buffer_t *buffer);
+
+#endif // AIALGO_REPLAY
@@ -23,8 +23,13 @@
  */
 
 #include "basic/base/aialgo/aialgo_sequential_inference.h"
+#include "basic/base/aidebug/aidebug_trace.h"
+#include "basic/base/aidebug/aidebug_memory.h"
 
 #include "basic/default/aimath/aimath_f32_default.h"
+#include "basic/default/aimath/aimath_q15_default.h"
+#include "basic/base/ailayer/ailayer_softmax.h"
+#include "basic/base/ailayer/ailayer_normalize.h"
 
 #include <stdio.h>
 #include <float.h>
@@ -98,6 +103,7 @@ void aialgo_distribute_parameter_memory(aimodel_t *model, void *memory_ptr, uint
 
 		layer_ptr = layer_ptr->output_layer;
 	}
+	AIDEBUG_MEMORY_REGION(AIDEBUG_MEMORY_PARAMETER, memory_ptr, memory_size, address_counter, FALSE);
 	return;
 }
 
@@ -107,6 +113,8 @@ uint8_t aialgo_schedule_inference_memory(aimodel_t *model, void *memory_ptr, uin
 	uint16_t i;
 	ailayer_t *layer_ptr = model->input_layer;
 
+	AIDEBUG_MEMORY_REGION(AIDEBUG_MEMORY_INFERENCE, memory_ptr, memory_size, aialgo_sizeof_inference_memory(model), TRUE);
+
 	// Init result tensor with shape and memory
 	for(i = 0; i < model->layer_count; i++)
 	{
@@ -128,7 +136,11 @@ aitensor_t *aialgo_forward_model(aimodel_t *model, aitensor_t *input_data)
 	model->input_layer->result.tensor_params = input_data->tensor_params;
 	for(i = 0; i < model->layer_count; i++)
 	{
+		AIDEBUG_TRACE_BEGIN(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "forward", i);
+		AIDEBUG_MEMORY_STACK_BEGIN();
 		layer_ptr->forward(layer_ptr);
+		AIDEBUG_MEMORY_STACK_END(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "forward", i);
+		AIDEBUG_TRACE_END(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "forward", i);
 
 		// Print intermediate results
 		//print_aitensor(&layer_ptr->result);
@@ -138,6 +150,30 @@ aitensor_t *aialgo_forward_model(aimodel_t *model, aitensor_t *input_data)
 	return &(model->output_layer->result);
 }
 
+// The samples are stored with the smallest shift of all samples so far (the widest range),
+// the already copied samples are requantized if the shift gets smaller.
+void aialgo_copy_q15_sample(const aitensor_t *sample, aitensor_t *output_data, uint32_t index, uint32_t sample_elements)
+{
+	int16_t sample_shift = ((aimath_q15_params_t *) sample->tensor_params)->shift;
+	aimath_q15_params_t *output_params = (aimath_q15_params_t *) output_data->tensor_params;
+	aimath_q15_params_t new_params = {.shift = sample_shift};
+	uint16_t previous_shape[1] = {index * sample_elements};
+	uint16_t slot_shape[1] = {sample_elements};
+	aitensor_t previous = {aiq15, 1, previous_shape, output_params, output_data->data};
+	aitensor_t requantized = {aiq15, 1, previous_shape, &new_params, output_data->data};
+	aitensor_t slot = {aiq15, 1, slot_shape, output_params, output_data->data + index * sample_elements * sizeof(int16_t)};
+
+	if(index == 0){
+		output_params->shift = sample_shift;
+	} else if(sample_shift < output_params->shift){
+		// In place, the values only get smaller
+		aimath_q15_default_requantize(&previous, &requantized);
+		output_params->shift = sample_shift;
+	}
+	aimath_q15_default_requantize(sample, &slot);
+	return;
+}
+
 aitensor_t *aialgo_inference_model(aimodel_t *model, aitensor_t *input_data, aitensor_t *output_data)
 {
 	uint32_t i, j;
@@ -171,6 +207,11 @@ aitensor_t *aialgo_inference_model(aimodel_t *model, aitensor_t *input_data, ait
 
 		output_batch = aialgo_forward_model(model, &input_batch);
 
+		if(output_batch->dtype == aiq15){
+			aialgo_copy_q15_sample(output_batch, output_data, i, output_multiplier);
+			continue;
+		}
+
 		// ToDo: Copy tensor
 		for(j = 0; j < aimath_tensor_elements(output_batch); j++)
 		{
@@ -179,10 +220,103 @@ aitensor_t *aialgo_inference_model(aimodel_t *model, aitensor_t *input_data, ait
               aimath_tensor_elements(output_batch) * input_data->dtype->size);
 		}
 	}
-	memcpy(output_data->tensor_params, output_batch->tensor_params, output_batch->dtype->tensor_params_size);
+	if(output_batch->dtype != aiq15 && output_data->tensor_params != 0){
+		memcpy(output_data->tensor_params, output_batch->tensor_params, output_batch->dtype->tensor_params_size);
+	}
 	return output_data;
 }
 
+aitensor_t *aialgo_forward_model_logits(aimodel_t *model, aitensor_t *input_data)
+{
+	uint16_t i;
+	uint16_t layer_count = model->layer_count;
+	ailayer_t *layer_ptr = model->input_layer;
+
+	// Skip a trailing softmax layer
+	if(model->output_layer->layer_type == ailayer_softmax_type && layer_count > 1){
+		layer_count--;
+	}
+
+	model->input_layer->result.data = input_data->data;
+	model->input_layer->result.tensor_params = input_data->tensor_params;
+	for(i = 0; i < layer_count; i++)
+	{
+		AIDEBUG_TRACE_BEGIN(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "forward", i);
+		layer_ptr->forward(layer_ptr);
+		AIDEBUG_TRACE_END(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "forward", i);
+
+		if(i < layer_count - 1){
+			layer_ptr = layer_ptr->output_layer;
+		}
+	}
+	return &(layer_ptr->result);
+}
+
+void aialgo_inference_model_top_k_f32(aimodel_t *model, aitensor_t *input_data, uint16_t k, uint16_t *indices, float *probabilities)
+{
+	uint32_t i;
+
+	uint16_t input_batch_shape[input_data->dim];
+	aitensor_t input_batch = {
+	    .dtype = input_data->dtype,
+        .shape = input_batch_shape,
+        .dim = input_data->dim,
+        .tensor_params = input_data->tensor_params
+	};
+	aitensor_t *logits;
+
+	if(k == 0) return;
+
+	uint32_t input_multiplier = 1;
+	for(i = input_data->dim - 1; i > 0; i--)
+	{
+		input_multiplier *= input_data->shape[i];
+		input_batch_shape[i] = input_data->shape[i];
+	}
+	input_batch_shape[0] = 1;
+
+	for(i = 0; i < input_data->shape[0]; i++)
+	{
+		input_batch.data = input_data->data + i * input_multiplier * input_data->dtype->size;
+
+		logits = aialgo_forward_model_logits(model, &input_batch);
+
+		aimath_f32_default_top_k(logits, k, &indices[i * k]);
+		if(probabilities != 0){
+			aimath_f32_default_softmax_selected(logits, k, &indices[i * k], &probabilities[i * k]);
+		}
+	}
+	return;
+}
+
+uint16_t aialgo_fold_normalize_layers(aimodel_t *model)
+{
+	uint16_t folded = 0;
+	ailayer_t *layer_ptr = model->input_layer;
+	ailayer_normalize_t *normalize_layer;
+	ailayer_dense_t *dense_layer;
+
+	while(layer_ptr != model->output_layer)
+	{
+		if(layer_ptr->layer_type == ailayer_normalize_type && layer_ptr->output_layer->layer_type == ailayer_dense_type){
+			normalize_layer = (ailayer_normalize_t *) layer_ptr->layer_configuration;
+			dense_layer = (ailayer_dense_t *) layer_ptr->output_layer->layer_configuration;
+
+			// W' = diag(scale) * W; b' = b + offset * W
+			normalize_layer->fold_scale_offset(&(normalize_layer->scale), &(normalize_layer->offset),
+												&(dense_layer->weights), &(dense_layer->bias));
+
+			// Remove the Normalize layer from the chain
+			layer_ptr->input_layer->output_layer = layer_ptr->output_layer;
+			layer_ptr->output_layer->input_layer = layer_ptr->input_layer;
+			model->layer_count--;
+			folded++;
+		}
+		layer_ptr = layer_ptr->output_layer;
+	}
+	return folded;
+}
+
 uint8_t aialgo_compile_model(aimodel_t *model)
 {
 	ailayer_t *layer_ptr = model->input_layer;
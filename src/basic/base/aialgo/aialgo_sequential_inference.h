@@ -95,6 +95,9 @@ aitensor_t *aialgo_forward_model(aimodel_t *model, aitensor_t *input_data);
  * (for example with aialgo_schedule_inference_memory() or aialgo_schedule_training_memory()) before
  * calling this function.
  *
+ * \link aimath_q15.h Q15 \endlink results are stored with one common shift for all samples (the smallest shift of
+ * the single samples), because the shift of the output layer is chosen for every sample separately.
+ *
  * Example:
  * \code{.c}
  * float input_data[] = {0.0f, 1.0f};
@@ -127,6 +130,83 @@ aitensor_t *aialgo_forward_model(aimodel_t *model, aitensor_t *input_data);
  */
 aitensor_t *aialgo_inference_model(aimodel_t *model, aitensor_t *input_data, aitensor_t *output_data);
 
+/** @brief Copy one \link aimath_q15.h Q15 \endlink sample into a batch tensor with one common shift
+ *
+ * The Q15 kernels choose the shift of every sample separately. The batch is stored with the smallest shift of
+ * the samples copied so far, the previous samples (index 0 to index - 1) are requantized in place if the shift gets smaller.
+ * Used by aialgo_inference_model() and other functions that assemble a batch from single samples.
+ *
+ * @param *sample          Q15 tensor of the single sample
+ * @param *output_data     Q15 batch tensor (with tensor_params) that receives the sample
+ * @param index            Position of the sample in the batch
+ * @param sample_elements  Number of elements of one sample
+ */
+void aialgo_copy_q15_sample(const aitensor_t *sample, aitensor_t *output_data, uint32_t index, uint32_t sample_elements);
+
+/** @brief Perform a forward pass on the model without a trailing Softmax layer
+ *
+ * If the output layer of the model is a \link ailayer_softmax.h Softmax layer \endlink, the forward pass stops
+ * before it and returns the logits (the result of the layer before). Otherwise it is the same as aialgo_forward_model().
+ * The model itself is not changed, so it can still be trained with the Softmax layer.
+ *
+ * @param *model         The model
+ * @param *input_data    Input data tensor of the same shape as the input_layer shape
+ * @return               Pointer to the logits (the result tensor of the last calculated layer)
+ */
+aitensor_t *aialgo_forward_model_logits(aimodel_t *model, aitensor_t *input_data);
+
+/** @brief Perform an inference that only returns the k most probable classes
+ *
+ * For applications that only need the predicted class (or the k best ones), a trailing Softmax layer is skipped
+ * (see aialgo_forward_model_logits()) and the classes are selected on the logits. Because the softmax is monotonic,
+ * the selected classes are the same as with the Softmax layer, but the exponential functions and divisions are saved.
+ *
+ * If probabilities are requested, the softmax probabilities of the selected classes are calculated
+ * (one exponential function per class and k divisions).
+ *
+ * Example:
+ * \code{.c}
+ * uint16_t predicted_class;
+ *
+ * aialgo_inference_model_top_k_f32(&model, &input_tensor, 1, &predicted_class, 0);
+ * \endcode
+ *
+ * @param *model            The model
+ * @param *input_data       Input data tensor with the same shape as the input_layer (except the batch dimension)
+ * @param k                 Number of classes per sample
+ * @param *indices          Array for the indices of the classes (batch size * k elements, sorted by probability)
+ * @param *probabilities    Array for the probabilities of the classes (batch size * k elements) or 0 if not needed
+ */
+void aialgo_inference_model_top_k_f32(aimodel_t *model, aitensor_t *input_data, uint16_t k, uint16_t *indices, float *probabilities);
+
+/** @brief Fold the Normalize layers of the model into the following Dense layers
+ *
+ * Every \link ailayer_normalize.h Normalize layer \endlink that is directly followed by a
+ * \link ailayer_dense.h Dense layer \endlink is merged into the weights and bias of the Dense layer and removed
+ * from the model:
+ * @f[
+ *  (x \circ scale + offset) \cdot W + b = x \cdot W' + b'
+ * @f]
+ * The model calculates the same results afterwards, but the normalization costs nothing at runtime, so the raw inputs
+ * (for example sensor values) can be given directly to aialgo_forward_model().
+ *
+ * Call this function after the training (or after loading the parameters) and before
+ * aialgo_sizeof_inference_memory() and aialgo_schedule_inference_memory(), because the number of layers changes.
+ * The weights and bias of the Dense layers are changed in place, so the model should not be trained afterwards.
+ *
+ * Example:
+ * \code{.c}
+ * aialgo_fold_normalize_layers(&model);
+ *
+ * memory_size = aialgo_sizeof_inference_memory(&model);
+ * aialgo_schedule_inference_memory(&model, memory_ptr, memory_size);
+ * \endcode
+ *
+ * @param *model     The model
+ * @return           Number of folded Normalize layers
+ */
+uint16_t aialgo_fold_normalize_layers(aimodel_t *model);
+
 /** @brief Initialize the model structure
 *
 * Counts the number of layers and trainable parameters in a model as preparation for inference or training.
@@ -24,37 +24,58 @@
 
 #include "basic/base/aialgo/aialgo_sequential_training.h"
 #include "basic/base/aialgo/aialgo_sequential_inference.h"
+#include "basic/base/aidebug/aidebug_trace.h"
+#include "basic/base/aidebug/aidebug_memory.h"
+#include "basic/base/aiopti/aiopti_sgd.h"
 
 // ToDo: Remove dependency
 #include "basic/default/aimath/aimath_f32_default.h"
 
-uint32_t aialgo_sizeof_training_memory(aimodel_t *model, aiopti_t *optimizer)
+/** @brief Check if the layer writes its result over the result of the input layer during training
+ *
+ * The result of the model input layer points to the user data and can not be overwritten.
+ */
+static uint8_t aialgo_result_in_place(const aimodel_t *model, const ailayer_t *layer)
+{
+	return layer != model->input_layer && layer->input_layer != model->input_layer && layer->result_in_place;
+}
+
+// Layers without gradients in the fused SGD training calculate the update in ailayer.backward_sgd
+static uint8_t aialgo_needs_gradients(const ailayer_t *layer, uint8_t fused_sgd)
+{
+	return !fused_sgd || layer->backward_sgd == 0;
+}
+
+static uint32_t aialgo_sizeof_training_memory_internal(aimodel_t *model, aiopti_t *optimizer, uint8_t fused_sgd)
 {
 	uint16_t i, j;
 	ailayer_t *layer_ptr = model->input_layer;
 	uint32_t memory = 0;
 
+	// Every block is aligned, so that the tensor structs in the training and optimization memory are aligned
 	for(i = 0; i < model->layer_count; i++)
 	{
-		// Result memory
+		// Result memory (not needed if the layer overwrites the result of its input layer)
 		layer_ptr->calc_result_shape(layer_ptr);
-		memory += aimath_sizeof_tensor_data(&(layer_ptr->result));
+		if(!aialgo_result_in_place(model, layer_ptr)){
+			memory += AIMATH_ALIGN_SIZE(aimath_sizeof_tensor_data(&(layer_ptr->result)));
+		}
 
 		// Memory for the qantization parameter of the deltas
 		if(layer_ptr->output_layer->deltas.dtype != 0){
-            memory += layer_ptr->output_layer->deltas.dtype->tensor_params_size;
+            memory += AIMATH_ALIGN_SIZE(layer_ptr->output_layer->deltas.dtype->tensor_params_size);
 		}
 
 		// Trainingmemory e.g. for gradients
-		if(layer_ptr->sizeof_trainmem != 0)
+		if(layer_ptr->sizeof_trainmem != 0 && aialgo_needs_gradients(layer_ptr, fused_sgd))
 		{
-			memory += layer_ptr->sizeof_trainmem(layer_ptr);
+			memory += AIMATH_ALIGN_SIZE(layer_ptr->sizeof_trainmem(layer_ptr));
 		}
 
 		// optimization memory (e.g. first or second momentum)
-		if(optimizer->sizeof_optimem != 0){
+		if(optimizer->sizeof_optimem != 0 && aialgo_needs_gradients(layer_ptr, fused_sgd)){
 			for(j = 0; j < layer_ptr->trainable_params_count; j++){
-				memory += optimizer->sizeof_optimem(optimizer, layer_ptr->trainable_params[j]);
+				memory += AIMATH_ALIGN_SIZE(optimizer->sizeof_optimem(optimizer, layer_ptr->trainable_params[j]));
 			}
 		}
 
@@ -63,42 +84,49 @@ uint32_t aialgo_sizeof_training_memory(aimodel_t *model, aiopti_t *optimizer)
 	return memory;
 }
 
-uint8_t aialgo_schedule_training_memory(aimodel_t *model, aiopti_t *optimizer, void *memory_ptr, uint32_t memory_size)
+static uint8_t aialgo_schedule_training_memory_internal(aimodel_t *model, aiopti_t *optimizer, void *memory_ptr, uint32_t memory_size, uint8_t fused_sgd)
 {
 	uint16_t i, j;
 	uint32_t address_counter = 0;
 	ailayer_t *layer_ptr = model->input_layer;
 
+	AIDEBUG_MEMORY_REGION(AIDEBUG_MEMORY_TRAINING, memory_ptr, memory_size, aialgo_sizeof_training_memory_internal(model, optimizer, fused_sgd), TRUE);
+
 	for(i = 0; i < model->layer_count; i++)
 	{
 		// Result memory = deltas memory
 		layer_ptr->calc_result_shape(layer_ptr);
-		layer_ptr->result.data = memory_ptr + address_counter;
+		if(aialgo_result_in_place(model, layer_ptr)){
+			// Shares the memory with the result of the input layer
+			layer_ptr->result.data = layer_ptr->input_layer->result.data;
+		} else {
+			layer_ptr->result.data = memory_ptr + address_counter;
+			address_counter += AIMATH_ALIGN_SIZE(aimath_sizeof_tensor_data(&(layer_ptr->result)));
+		}
 
 		layer_ptr->output_layer->deltas.dtype = layer_ptr->result.dtype;
 		layer_ptr->output_layer->deltas.dim = layer_ptr->result.dim;
 		layer_ptr->output_layer->deltas.shape = layer_ptr->result.shape;
-		layer_ptr->output_layer->deltas.data = memory_ptr + address_counter;
-		address_counter += aimath_sizeof_tensor_data(&(layer_ptr->result));
+		layer_ptr->output_layer->deltas.data = layer_ptr->result.data;
 
 		// Memory for the qantization parameter of the deltas
 		if(layer_ptr->output_layer->deltas.dtype != 0){
             layer_ptr->output_layer->deltas.tensor_params = memory_ptr + address_counter;
-            address_counter += layer_ptr->output_layer->deltas.dtype->tensor_params_size;
+            address_counter += AIMATH_ALIGN_SIZE(layer_ptr->output_layer->deltas.dtype->tensor_params_size);
 		}
 
 		// Training memory e.g. for gradients
-		if(layer_ptr->sizeof_trainmem != 0)
+		if(layer_ptr->sizeof_trainmem != 0 && aialgo_needs_gradients(layer_ptr, fused_sgd))
 		{
 			layer_ptr->set_trainmem(layer_ptr, memory_ptr + address_counter);
-			address_counter += layer_ptr->sizeof_trainmem(layer_ptr);
+			address_counter += AIMATH_ALIGN_SIZE(layer_ptr->sizeof_trainmem(layer_ptr));
 		}
 
 		// optimization memory (e.g. first or second momentum)
-		if(optimizer->sizeof_optimem != 0){
+		if(optimizer->sizeof_optimem != 0 && aialgo_needs_gradients(layer_ptr, fused_sgd)){
 			for(j = 0; j < layer_ptr->trainable_params_count; j++){
 				layer_ptr->optimem[j] = memory_ptr + address_counter;
-				address_counter += optimizer->sizeof_optimem(optimizer, layer_ptr->trainable_params[j]);
+				address_counter += AIMATH_ALIGN_SIZE(optimizer->sizeof_optimem(optimizer, layer_ptr->trainable_params[j]));
 			}
 		}
 
@@ -108,6 +136,41 @@ uint8_t aialgo_schedule_training_memory(aimodel_t *model, aiopti_t *optimizer, v
 	return 0;
 }
 
+// The fused update implements the SGD optimizer without momentum
+static uint8_t aialgo_check_fused_sgd_optimizer(const aiopti_t *optimizer)
+{
+	if(optimizer->optimizer_type != aiopti_sgd_type || optimizer->sizeof_optimem != aiopti_sgd_sizeof_optimem_without_momentum){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("The fused SGD training requires the SGD optimizer without momentum.\n");
+#endif
+		return FALSE;
+	}
+	return TRUE;
+}
+
+uint32_t aialgo_sizeof_training_memory(aimodel_t *model, aiopti_t *optimizer)
+{
+	return aialgo_sizeof_training_memory_internal(model, optimizer, FALSE);
+}
+
+uint8_t aialgo_schedule_training_memory(aimodel_t *model, aiopti_t *optimizer, void *memory_ptr, uint32_t memory_size)
+{
+	return aialgo_schedule_training_memory_internal(model, optimizer, memory_ptr, memory_size, FALSE);
+}
+
+uint32_t aialgo_sizeof_training_memory_fused_sgd(aimodel_t *model, aiopti_t *optimizer)
+{
+	return aialgo_sizeof_training_memory_internal(model, optimizer, TRUE);
+}
+
+uint8_t aialgo_schedule_training_memory_fused_sgd(aimodel_t *model, aiopti_t *optimizer, void *memory_ptr, uint32_t memory_size)
+{
+	if(!aialgo_check_fused_sgd_optimizer(optimizer)){
+		return 1;
+	}
+	return aialgo_schedule_training_memory_internal(model, optimizer, memory_ptr, memory_size, TRUE);
+}
+
 void aialgo_init_model_for_training(aimodel_t *model, aiopti_t *optimizer)
 {
 	uint16_t i, j;
@@ -126,12 +189,25 @@ void aialgo_init_model_for_training(aimodel_t *model, aiopti_t *optimizer)
 	return;
 }
 
-void aialgo_backward_model(aimodel_t *model, aitensor_t *target_data)
+// Backward pass, with the loss of the sample written to loss_result if not NULL
+static void aialgo_backward_model_internal(aimodel_t *model, aitensor_t *target_data, void *loss_result)
 {
 	uint16_t i;
 	ailayer_t *layer_ptr = model->output_layer;
 
-	model->loss->calc_delta(model->loss, target_data);
+	AIDEBUG_TRACE_BEGIN("Loss", "backward", AIDEBUG_TRACE_NO_ARG);
+	AIDEBUG_MEMORY_STACK_BEGIN();
+	if(loss_result == 0){
+		model->loss->calc_delta(model->loss, target_data);
+	} else if(model->loss->calc_delta_and_loss != 0){
+		model->loss->calc_delta_and_loss(model->loss, target_data, loss_result);
+	} else {
+		// Loss before the deltas, because the deltas may override the predictions
+		model->loss->calc_loss(model->loss, target_data, loss_result);
+		model->loss->calc_delta(model->loss, target_data);
+	}
+	AIDEBUG_MEMORY_STACK_END("Loss", "backward", AIDEBUG_TRACE_NO_ARG);
+	AIDEBUG_TRACE_END("Loss", "backward", AIDEBUG_TRACE_NO_ARG);
 	for(i = 0; i < model->layer_count; i++)
 	{
 #ifdef DEBUG_CHECKS
@@ -140,15 +216,33 @@ void aialgo_backward_model(aimodel_t *model, aitensor_t *target_data)
             return;
 	    }
 #endif
+		AIDEBUG_TRACE_BEGIN(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "backward", model->layer_count - 1 - i);
+		AIDEBUG_MEMORY_STACK_BEGIN();
 		layer_ptr->backward(layer_ptr);
+		AIDEBUG_MEMORY_STACK_END(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "backward", model->layer_count - 1 - i);
+		AIDEBUG_TRACE_END(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "backward", model->layer_count - 1 - i);
 		layer_ptr = layer_ptr->input_layer;
 	}
 	return;
 }
 
-void aialgo_train_model(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size)
+void aialgo_backward_model(aimodel_t *model, aitensor_t *target_data)
+{
+	aialgo_backward_model_internal(model, target_data, 0);
+	return;
+}
+
+void aialgo_backward_model_with_loss(aimodel_t *model, aitensor_t *target_data, void *loss_result)
+{
+	aialgo_backward_model_internal(model, target_data, loss_result);
+	return;
+}
+
+// Training epoch, with the mean loss of the trained samples written to loss if not NULL
+static void aialgo_train_model_internal(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size, float *loss)
 {
 	uint32_t i;
+	float sample_loss;
 
 	aitensor_t input_batch;
 	uint16_t input_batch_shape[input_tensor->dim];
@@ -184,20 +278,126 @@ void aialgo_train_model(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *
 	uint32_t batch;
 	for(batch = 0; batch < batch_count; batch++)
 	{
+		AIDEBUG_TRACE_BEGIN("Batch", "train", batch);
 		aialgo_zero_gradients_model(model, optimizer);
 		for(i = 0; i < batch_size; i++)
 		{
+			AIDEBUG_TRACE_BEGIN("Load sample", "data", i);
 			input_batch.data = input_tensor->data + batch * input_multiplier * batch_size + i * input_multiplier;
 			target_batch.data = target_tensor->data + batch * target_multiplier * batch_size + i * target_multiplier;
+			AIDEBUG_TRACE_END("Load sample", "data", i);
 
 
 			//printf("Input batch [%d, %d, %d, %d]:\n", input_batch_shape[0], input_batch_shape[1], input_batch_shape[2], input_batch_shape[3]);
 			//print_aitensor(&input_batch);
 
 			aialgo_forward_model(model, &input_batch);
-			aialgo_backward_model(model, &target_batch);
+			if(loss != 0){
+				aialgo_backward_model_internal(model, &target_batch, &sample_loss);
+				*loss += sample_loss;
+			} else {
+				aialgo_backward_model_internal(model, &target_batch, 0);
+			}
 		}
 		aialgo_update_params_model(model, optimizer);
+		AIDEBUG_TRACE_END("Batch", "train", batch);
+	}
+	if(loss != 0 && batch_count > 0){
+		*loss /= (float) (batch_count * batch_size);
+	}
+	return;
+}
+
+void aialgo_train_model(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size)
+{
+	aialgo_train_model_internal(model, input_tensor, target_tensor, optimizer, batch_size, 0);
+	return;
+}
+
+void aialgo_train_model_with_loss_f32(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size, float *loss)
+{
+	*loss = 0.0f;
+	aialgo_train_model_internal(model, input_tensor, target_tensor, optimizer, batch_size, loss);
+	return;
+}
+
+void aialgo_backward_model_fused_sgd(aimodel_t *model, aitensor_t *target_data, aiopti_t *optimizer)
+{
+	uint16_t i, j;
+	ailayer_t *layer_ptr = model->output_layer;
+
+	AIDEBUG_TRACE_BEGIN("Loss", "backward", AIDEBUG_TRACE_NO_ARG);
+	model->loss->calc_delta(model->loss, target_data);
+	AIDEBUG_TRACE_END("Loss", "backward", AIDEBUG_TRACE_NO_ARG);
+	for(i = 0; i < model->layer_count; i++)
+	{
+		AIDEBUG_TRACE_BEGIN(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "backward", model->layer_count - 1 - i);
+		if(layer_ptr->backward_sgd != 0){
+			// Deltas and parameter update in one pass
+			layer_ptr->backward_sgd(layer_ptr, optimizer->learning_rate);
+		} else {
+			// Layers without fused update (e.g. other data types) use their gradients and the optimizer
+			for(j = 0; j < layer_ptr->trainable_params_count; j++){
+				optimizer->zero_gradients(optimizer, layer_ptr->gradients[j]);
+			}
+			layer_ptr->backward(layer_ptr);
+			for(j = 0; j < layer_ptr->trainable_params_count; j++){
+				optimizer->update_params(optimizer, layer_ptr->trainable_params[j], layer_ptr->gradients[j], layer_ptr->optimem[j]);
+			}
+		}
+		AIDEBUG_TRACE_END(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "backward", model->layer_count - 1 - i);
+		layer_ptr = layer_ptr->input_layer;
+	}
+	return;
+}
+
+void aialgo_train_model_fused_sgd(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer)
+{
+	uint32_t i;
+
+	if(!aialgo_check_fused_sgd_optimizer(optimizer)){
+		return;
+	}
+
+	aitensor_t input_batch;
+	uint16_t input_batch_shape[input_tensor->dim];
+	input_batch.dtype = input_tensor->dtype;
+	input_batch.dim = input_tensor->dim;
+	input_batch.shape = input_batch_shape;
+	input_batch.tensor_params = input_tensor->tensor_params;
+	aitensor_t target_batch;
+	uint16_t target_batch_shape[target_tensor->dim];
+	target_batch.dtype = target_tensor->dtype;
+	target_batch.dim = target_tensor->dim;
+	target_batch.shape = target_batch_shape;
+	target_batch.tensor_params = target_tensor->tensor_params;
+
+	uint32_t input_multiplier = 1;
+	for(i = input_tensor->dim - 1; i > 0; i--)
+	{
+		input_multiplier *= input_tensor->shape[i];
+		input_batch_shape[i] = input_tensor->shape[i];
+	}
+	input_multiplier *= input_tensor->dtype->size;
+	input_batch_shape[0] = 1;
+	uint32_t target_multiplier = 1;
+	for(i = target_tensor->dim - 1; i > 0; i--)
+	{
+		target_multiplier *= target_tensor->shape[i];
+		target_batch_shape[i] = target_tensor->shape[i];
+	}
+	target_multiplier *= target_tensor->dtype->size;
+	target_batch_shape[0] = 1;
+
+	for(i = 0; i < input_tensor->shape[0]; i++)
+	{
+		AIDEBUG_TRACE_BEGIN("Sample", "train", i);
+		input_batch.data = input_tensor->data + i * input_multiplier;
+		target_batch.data = target_tensor->data + i * target_multiplier;
+
+		aialgo_forward_model(model, &input_batch);
+		aialgo_backward_model_fused_sgd(model, &target_batch, optimizer);
+		AIDEBUG_TRACE_END("Sample", "train", i);
 	}
 	return;
 }
@@ -276,7 +476,11 @@ void aialgo_update_params_model(aimodel_t *model, aiopti_t *optimizer)
 	for(i = 0; i < model->layer_count; i++)
 	{
 		for(j = 0; j < layer_ptr->trainable_params_count; j++){
+			AIDEBUG_TRACE_BEGIN(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "optimizer", i);
+			AIDEBUG_MEMORY_STACK_BEGIN();
 			optimizer->update_params(optimizer, layer_ptr->trainable_params[j], layer_ptr->gradients[j], layer_ptr->optimem[j]);
+			AIDEBUG_MEMORY_STACK_END(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "optimizer", i);
+			AIDEBUG_TRACE_END(AIDEBUG_TRACE_LAYER_NAME(layer_ptr), "optimizer", i);
 		}
 		layer_ptr = layer_ptr->output_layer;
 	}
@@ -57,6 +57,33 @@ uint32_t aialgo_sizeof_training_memory(aimodel_t *model, aiopti_t *optimizer);
  */
 uint8_t aialgo_schedule_training_memory(aimodel_t *model, aiopti_t *optimizer, void *memory_ptr, uint32_t memory_size);
 
+/** @brief Calculate the memory requirements for the fused SGD training
+ *
+ * Like aialgo_sizeof_training_memory(), but without the gradients of the layers that support the fused backward pass
+ * with parameter update (ailayer.backward_sgd, for example the F32 Dense layer). For a F32 MLP this removes one
+ * weight sized buffer per layer.
+ *
+ * Use aialgo_schedule_training_memory_fused_sgd() to set the memory to the model.
+ *
+ * @param *model        The model
+ * @param *optimizer    The SGD optimizer (without momentum) that is used for training
+ * @return              Required memory size in bytes
+ */
+uint32_t aialgo_sizeof_training_memory_fused_sgd(aimodel_t *model, aiopti_t *optimizer);
+
+/** @brief Assign the memory for the fused SGD training
+ *
+ * The required memory size can be calculated with aialgo_sizeof_training_memory_fused_sgd().
+ * The model can only be trained with aialgo_train_model_fused_sgd() afterwards.
+ *
+ * @param *model        The model
+ * @param *optimizer    The SGD optimizer (without momentum) that is used for training
+ * @param *memory_ptr   Pointer to the memory block
+ * @param memory_size   Size of the memory block (for error checking)
+ * @return              0 if successful, 1 if the optimizer is not supported
+ */
+uint8_t aialgo_schedule_training_memory_fused_sgd(aimodel_t *model, aiopti_t *optimizer, void *memory_ptr, uint32_t memory_size);
+
 /** @brief Initialize the optimization memory of the model layers
  *
  * @param *model     The model
@@ -71,6 +98,18 @@ void aialgo_init_model_for_training(aimodel_t *model, aiopti_t *optimizer);
  */
 void aialgo_backward_model(aimodel_t *model, aitensor_t *target_data);
 
+/** @brief Perform the backward pass and calculate the loss of the current predictions
+ *
+ * Like aialgo_backward_model(), but the loss on the target data is written to the result scalar.
+ * The loss is calculated together with the deltas (ailoss.calc_delta_and_loss) or with ailoss.calc_loss before the deltas,
+ * so no additional forward pass is needed.
+ *
+ * @param *model         The model
+ * @param *target_data   The tensor containing the target data / labels
+ * @param *loss_result   Scalar in which the loss is written (aiscalar of the loss data type)
+ */
+void aialgo_backward_model_with_loss(aimodel_t *model, aitensor_t *target_data, void *loss_result);
+
 /** @brief Perform one training epoch on all data batches of the dataset using backpropagation
  *
  * Make shure to initialize the model (aialgo_compile_model()) and schedule the training memory
@@ -106,6 +145,78 @@ void aialgo_backward_model(aimodel_t *model, aitensor_t *target_data);
  */
 void aialgo_train_model(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size);
 
+/** @brief Perform one training epoch like aialgo_train_model() and return the running mean loss in \link aimath_f32.h F32 \endlink data type
+ *
+ * The loss of every sample is taken from the backward pass (see aialgo_backward_model_with_loss()), so the loss
+ * monitoring needs no additional forward passes. Because the parameters change during the epoch, the result differs
+ * slightly from the loss after the epoch. In contrast to aialgo_calc_loss_model_f32(), which returns the sum, the result
+ * is the mean over the trained samples.
+ *
+ * Example:
+ * \code{.c}
+ * float loss;
+ * for(i = 0; i < epochs; i++)
+ * {
+ *     aialgo_train_model_with_loss_f32(&model, &input_tensor, &target_tensor, optimizer, batch_size, &loss);
+ *     printf("Epoch %5d: loss: %f\n", i, loss);
+ * }
+ * \endcode
+ *
+ * @param *model            The model
+ * @param *input_tensor     The tensor containing the input data
+ * @param *target_tensor    The tensor containing the target data / labels
+ * @param *optimizer        The optimizer that is used for training
+ * @param batch_size        Size of a batch / Number of input vektors
+ * @param *loss             Mean loss of the trained samples (output)
+ */
+void aialgo_train_model_with_loss_f32(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size, float *loss);
+
+/** @brief Perform the backward pass with parameter update in the layers
+ *
+ * Calculates the deltas of the loss and runs the backward pass through the model. Layers that support it
+ * (ailayer.backward_sgd) calculate their deltas with the old parameters and update the parameters in the same pass.
+ * The other layers calculate their gradients and are updated right after their backward pass.
+ *
+ * @param *model         The model
+ * @param *target_data   The tensor containing the target data / labels
+ * @param *optimizer     The SGD optimizer (without momentum)
+ */
+void aialgo_backward_model_fused_sgd(aimodel_t *model, aitensor_t *target_data, aiopti_t *optimizer);
+
+/** @brief Perform one training epoch with SGD and a parameter update after every sample (batch size 1), fused into the backward pass
+ *
+ * Gives the same results as aialgo_train_model() with batch size 1 and the SGD optimizer without momentum, but
+ * there are no separate passes to zero the gradients and to update the parameters and the gradient memory of the
+ * Dense layers is not needed.
+ *
+ * Schedule the training memory with aialgo_schedule_training_memory_fused_sgd() before calling this function.
+ *
+ * Example:
+ * \code{.c}
+ * aiopti_sgd_f32_t sgd = {
+ *     .learning_rate = 0.01f,
+ *     .momentum = 0.0f
+ * };
+ * aiopti_t *optimizer = aiopti_sgd_f32_default(&sgd);
+ *
+ * uint32_t memory_size = aialgo_sizeof_training_memory_fused_sgd(&model, optimizer);
+ * void *memory_ptr = malloc(memory_size);
+ * aialgo_schedule_training_memory_fused_sgd(&model, optimizer, memory_ptr, memory_size);
+ * aialgo_init_model_for_training(&model, optimizer);
+ *
+ * for(i = 0; i < epochs; i++)
+ * {
+ *     aialgo_train_model_fused_sgd(&model, &input_tensor, &target_tensor, optimizer);
+ * }
+ * \endcode
+ *
+ * @param *model            The model
+ * @param *input_tensor     The tensor containing the input data
+ * @param *target_tensor    The tensor containing the target data / labels
+ * @param *optimizer        The SGD optimizer (without momentum)
+ */
+void aialgo_train_model_fused_sgd(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer);
+
 /** @brief Calculate the loss in \link aimath_f32.h F32 \endlink data type
  *
  * @param *model         The model
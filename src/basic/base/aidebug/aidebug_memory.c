@@ -0,0 +1,203 @@
+/**
+ * \file basic/base/aidebug/aidebug_memory.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aidebug_memory.h for documentation.
+ * \details
+ */
+
+#include "basic/base/aidebug/aidebug_memory.h"
+#include "basic/base/aidebug/aidebug_trace.h"
+
+#include <string.h>
+
+#if defined(__GNUC__)
+#define AIDEBUG_NOINLINE    __attribute__((noinline))
+#else
+#define AIDEBUG_NOINLINE
+#endif
+
+static const char *aidebug_memory_region_names[AIDEBUG_MEMORY_REGION_COUNT] = {"Parameter", "Inference", "Training"};
+
+static aidebug_memory_region_t aidebug_memory_regions[AIDEBUG_MEMORY_REGION_COUNT];
+
+static aidebug_memory_stack_t aidebug_memory_stack;
+
+// Painted stack area of the calling thread
+static AIDEBUG_THREAD_LOCAL volatile uint8_t *aidebug_memory_stack_low = 0;
+static AIDEBUG_THREAD_LOCAL volatile uint8_t *aidebug_memory_stack_top = 0;
+
+void aidebug_memory_record_region(uint8_t region, void *memory, uint32_t size, uint32_t scheduled, uint8_t paint)
+{
+	aidebug_memory_region_t *r = &aidebug_memory_regions[region];
+
+	// A new memory block resets the measurement
+	if(r->memory != (const uint8_t *) memory || r->size != size){
+		r->scheduled = 0;
+		r->high_water = 0;
+	}
+	r->memory = (const uint8_t *) memory;
+	r->size = size;
+	if(scheduled > r->scheduled){
+		r->scheduled = scheduled;
+	}
+	r->painted = paint;
+
+	if(paint){
+		memset(memory, AIDEBUG_MEMORY_PATTERN, size);
+	} else if(scheduled > r->high_water){
+		r->high_water = scheduled;
+	}
+	return;
+}
+
+void aidebug_memory_update_regions(void)
+{
+	uint8_t i;
+	uint32_t offset;
+	aidebug_memory_region_t *r;
+
+	for(i = 0; i < AIDEBUG_MEMORY_REGION_COUNT; i++){
+		r = &aidebug_memory_regions[i];
+		if(!r->painted || r->memory == 0){
+			continue;
+		}
+		// Search the highest byte that does not contain the pattern anymore
+		for(offset = r->size; offset > r->high_water; offset--){
+			if(r->memory[offset - 1] != AIDEBUG_MEMORY_PATTERN){
+				r->high_water = offset;
+				break;
+			}
+		}
+	}
+	return;
+}
+
+const aidebug_memory_region_t *aidebug_memory_get_region(uint8_t region)
+{
+	return &aidebug_memory_regions[region];
+}
+
+void aidebug_memory_set_stack_depth(uint32_t depth)
+{
+	aidebug_memory_stack.depth = depth;
+	return;
+}
+
+// Not inlined, so the frame of this function starts at the same address as the frame of the measured function
+AIDEBUG_NOINLINE void aidebug_memory_paint_stack(void)
+{
+	uint32_t i, depth = aidebug_memory_stack.depth;
+
+	if(depth == 0){
+		return;
+	}
+	{
+		volatile uint8_t area[depth];
+
+		for(i = 0; i < depth; i++){
+			area[i] = AIDEBUG_MEMORY_PATTERN;
+		}
+		aidebug_memory_stack_low = area;
+#if defined(__GNUC__)
+		aidebug_memory_stack_top = (volatile uint8_t *) __builtin_frame_address(0);
+#else
+		aidebug_memory_stack_top = area + depth;
+#endif
+	}
+	return;
+}
+
+uint32_t aidebug_memory_measure_stack(const char *name, const char *category, int32_t index)
+{
+	volatile uint8_t *ptr = aidebug_memory_stack_low;
+	uint32_t used;
+
+	if(aidebug_memory_stack.depth == 0 || ptr == 0){
+		return 0;
+	}
+
+	// Search the deepest byte that does not contain the pattern anymore
+	while(ptr < aidebug_memory_stack_top && *ptr == AIDEBUG_MEMORY_PATTERN){
+		ptr++;
+	}
+	used = (uint32_t) (aidebug_memory_stack_top - ptr);
+
+	if(ptr == aidebug_memory_stack_low){
+		aidebug_memory_stack.overflow = TRUE;
+	}
+	if(used > aidebug_memory_stack.peak){
+		aidebug_memory_stack.peak = used;
+		aidebug_memory_stack.worst_name = name;
+		aidebug_memory_stack.worst_category = category;
+		aidebug_memory_stack.worst_index = index;
+	}
+	aidebug_memory_stack_low = 0;
+	return used;
+}
+
+const aidebug_memory_stack_t *aidebug_memory_get_stack(void)
+{
+	return &aidebug_memory_stack;
+}
+
+void aidebug_memory_reset_stack(void)
+{
+	aidebug_memory_stack.peak = 0;
+	aidebug_memory_stack.overflow = FALSE;
+	aidebug_memory_stack.worst_name = 0;
+	aidebug_memory_stack.worst_category = 0;
+	aidebug_memory_stack.worst_index = 0;
+	return;
+}
+
+void aidebug_memory_print_report(int (*print)(const char *format, ...))
+{
+	uint8_t i;
+	aidebug_memory_region_t *r;
+
+	aidebug_memory_update_regions();
+
+	print("Memory regions:\n");
+	for(i = 0; i < AIDEBUG_MEMORY_REGION_COUNT; i++){
+		r = &aidebug_memory_regions[i];
+		if(r->memory == 0){
+			continue;
+		}
+		print("%12s: size: %lu B; scheduled: %lu B; high-water: %lu B%s\n", aidebug_memory_region_names[i],
+			  (unsigned long) r->size, (unsigned long) r->scheduled, (unsigned long) r->high_water,
+			  r->painted ? "" : " (not measured)");
+	}
+
+	print("Stack:\n");
+	if(aidebug_memory_stack.depth == 0){
+		print("    Not measured (see aidebug_memory_set_stack_depth())\n");
+	} else {
+		print("    Peak: %s%lu B of %lu B painted\n", aidebug_memory_stack.overflow ? ">= " : "",
+			  (unsigned long) aidebug_memory_stack.peak, (unsigned long) aidebug_memory_stack.depth);
+		if(aidebug_memory_stack.worst_name != 0){
+			print("    Worst: %s %s", aidebug_memory_stack.worst_name, aidebug_memory_stack.worst_category);
+			if(aidebug_memory_stack.worst_index >= 0){
+				print(" (layer %ld)", (long) aidebug_memory_stack.worst_index);
+			}
+			print("\n");
+		}
+	}
+	return;
+}
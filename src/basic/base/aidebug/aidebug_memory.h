@@ -0,0 +1,167 @@
+/**
+ * \file basic/base/aidebug/aidebug_memory.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Instrumentation of the memory usage (memory regions and stack)
+ *
+ * Besides the memory blocks that are assigned to the model (parameter, inference and training memory), the layers,
+ * losses and optimizers use the stack for temporary results (for example in the backward pass of the dense layer).
+ * This module measures both:
+ * * **Memory regions:** The scheduled size of every region is recorded. The inference and training memory is painted
+ * with a pattern when it is scheduled, so the actually touched memory (high-water mark) can be determined afterwards.
+ * * **Stack:** Before every layer, loss and optimizer call, a configurable amount of stack below the current stack
+ * pointer is painted with a pattern. After the call, the painted area is scanned for the deepest overwritten byte.
+ * The painted area is allocated as a regular local array, so on systems with guard pages (like Linux) a too large
+ * depth causes a regular stack overflow instead of a silent corruption.
+ *
+ * The instrumentation is only compiled into the algorithms when \ref AIDEBUG_MEMORY is defined (see aifes_math.h).
+ * Otherwise the macros expand to nothing and cause no runtime costs. The stack measurement assumes a downwards growing
+ * stack (true for ARM, AVR, x86, RISC-V and Xtensa). On hosted systems with lazy symbol binding, the first call of
+ * a shared library function (like expf()) includes the stack of the dynamic linker (set LD_BIND_NOW=1 on Linux).
+ *
+ * Example:
+ * \code{.c}
+ * aidebug_memory_set_stack_depth(2048); // Must fit into the free stack of the task
+ *
+ * aialgo_schedule_training_memory(&model, optimizer, memory_ptr, memory_size);
+ * aialgo_init_model_for_training(&model, optimizer);
+ * aialgo_train_model(&model, &input_tensor, &target_tensor, optimizer, batch_size);
+ *
+ * aidebug_memory_print_report(printf);
+ * \endcode
+ */
+
+#ifndef AIDEBUG_MEMORY_H
+#define AIDEBUG_MEMORY_H
+
+#include "core/aifes_core.h"
+
+#define AIDEBUG_MEMORY_PARAMETER        0 /**< Region ID of the parameter memory. */
+#define AIDEBUG_MEMORY_INFERENCE        1 /**< Region ID of the inference memory. */
+#define AIDEBUG_MEMORY_TRAINING         2 /**< Region ID of the training memory. */
+#define AIDEBUG_MEMORY_REGION_COUNT     3
+
+#define AIDEBUG_MEMORY_PATTERN          0xA5 /**< Byte used to paint the unused memory. */
+
+typedef struct aidebug_memory_region    aidebug_memory_region_t;
+typedef struct aidebug_memory_stack     aidebug_memory_stack_t;
+
+/** @brief Usage information of a memory region
+ */
+struct aidebug_memory_region {
+	const uint8_t *memory; /**< Start of the memory block. */
+	uint32_t size; /**< Size of the provided memory block in bytes. */
+	uint32_t scheduled; /**< Bytes assigned by the scheduler (maximum of all scheduling calls). */
+	uint32_t high_water; /**< Highest touched byte offset + 1 (maximum of all measurements). */
+	uint8_t painted; /**< TRUE if the memory was painted and the high-water mark can be measured. */
+};
+
+/** @brief Result of the stack measurement
+ */
+struct aidebug_memory_stack {
+	uint32_t depth; /**< Painted stack depth in bytes (0 disables the measurement). */
+	uint32_t peak; /**< Maximum stack usage of a single layer, loss or optimizer call in bytes. */
+	uint8_t overflow; /**< TRUE if the painted depth was completely used (the real usage may be higher). */
+
+	const char *worst_name; /**< Name of the layer (or loss) with the maximum stack usage. */
+	const char *worst_category; /**< Category of the call with the maximum stack usage (like "forward" or "backward"). */
+	int32_t worst_index; /**< Layer index of the call with the maximum stack usage (negative if not a layer). */
+};
+
+/** @brief Record the scheduling of a memory region
+ *
+ * Called by the scheduling functions of the algorithms when \ref AIDEBUG_MEMORY is defined.
+ *
+ * @param region        Region ID (AIDEBUG_MEMORY_PARAMETER, AIDEBUG_MEMORY_INFERENCE or AIDEBUG_MEMORY_TRAINING)
+ * @param *memory       The memory block of the region
+ * @param size          Size of the memory block in bytes
+ * @param scheduled     Bytes assigned by the scheduler
+ * @param paint         TRUE to paint the memory for the high-water measurement (only if the content is not needed)
+ */
+void aidebug_memory_record_region(uint8_t region, void *memory, uint32_t size, uint32_t scheduled, uint8_t paint);
+
+/** @brief Scan the painted memory regions and update the high-water marks
+ */
+void aidebug_memory_update_regions(void);
+
+/** @brief Get the usage information of a memory region
+ *
+ * Call aidebug_memory_update_regions() before to get the current high-water mark.
+ *
+ * @param region    Region ID
+ * @return          The region information
+ */
+const aidebug_memory_region_t *aidebug_memory_get_region(uint8_t region);
+
+/** @brief Set the stack depth that is painted before every measured call
+ *
+ * The depth has to be smaller than the free stack at the call sites in the algorithms.
+ *
+ * @param depth     Painted depth in bytes (0 disables the stack measurement, default)
+ */
+void aidebug_memory_set_stack_depth(uint32_t depth);
+
+/** @brief Paint the stack below the current stack pointer
+ *
+ * Use the AIDEBUG_MEMORY_STACK_BEGIN() macro instead to remove the call when the instrumentation is disabled.
+ */
+void aidebug_memory_paint_stack(void);
+
+/** @brief Measure the stack usage since the last aidebug_memory_paint_stack() call
+ *
+ * Use the AIDEBUG_MEMORY_STACK_END() macro instead to remove the call when the instrumentation is disabled.
+ *
+ * @param *name         Name of the measured layer or function (static string)
+ * @param *category     Category of the call (static string)
+ * @param index         Layer index (negative if not a layer)
+ * @return              Used stack in bytes
+ */
+uint32_t aidebug_memory_measure_stack(const char *name, const char *category, int32_t index);
+
+/** @brief Get the result of the stack measurement
+ *
+ * @return The stack information
+ */
+const aidebug_memory_stack_t *aidebug_memory_get_stack(void);
+
+/** @brief Reset the peak stack usage
+ *
+ * The high-water marks of the memory regions are reset when the regions are scheduled again.
+ */
+void aidebug_memory_reset_stack(void);
+
+/** @brief Print the memory regions, the peak stack usage and the layer with the highest stack usage
+ *
+ * @param *print    A function for printing (for example printf)
+ */
+void aidebug_memory_print_report(int (*print)(const char *format, ...));
+
+#ifdef AIDEBUG_MEMORY
+#define AIDEBUG_MEMORY_REGION(REGION, MEMORY, SIZE, SCHEDULED, PAINT)    aidebug_memory_record_region((REGION), (MEMORY), (SIZE), (SCHEDULED), (PAINT))
+#define AIDEBUG_MEMORY_STACK_BEGIN()                                    aidebug_memory_paint_stack()
+#define AIDEBUG_MEMORY_STACK_END(NAME, CATEGORY, INDEX)                 aidebug_memory_measure_stack((NAME), (CATEGORY), (INDEX))
+#else
+#define AIDEBUG_MEMORY_REGION(REGION, MEMORY, SIZE, SCHEDULED, PAINT)
+#define AIDEBUG_MEMORY_STACK_BEGIN()
+#define AIDEBUG_MEMORY_STACK_END(NAME, CATEGORY, INDEX)
+#endif // AIDEBUG_MEMORY
+
+#endif // AIDEBUG_MEMORY_H
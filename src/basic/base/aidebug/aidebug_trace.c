@@ -0,0 +1,192 @@
+/**
+ * \file basic/base/aidebug/aidebug_trace.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+	All rights reserved.
+
+	AIfES is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aidebug_trace.h for documentation.
+ * \details
+ */
+
+#include "basic/base/aidebug/aidebug_trace.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+
+static uint64_t aidebug_trace_clock_monotonic(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000u + (uint64_t) ts.tv_nsec / 1000u;
+}
+
+static uint64_t (*aidebug_trace_clock)(void) = aidebug_trace_clock_monotonic;
+#else
+static uint64_t (*aidebug_trace_clock)(void) = 0;
+#endif
+
+// Buffer of the calling thread
+static AIDEBUG_THREAD_LOCAL aidebug_trace_buffer_t *aidebug_trace_current_buffer = 0;
+
+// List of all registered buffers (only appended, never removed)
+static aidebug_trace_buffer_t *aidebug_trace_buffers = 0;
+
+// Fallback timestamp if no clock is set
+static volatile uint32_t aidebug_trace_event_counter = 0;
+
+void aidebug_trace_init_buffer(aidebug_trace_buffer_t *buffer, aidebug_trace_event_t *events, uint32_t capacity, uint32_t thread_id, const char *thread_name)
+{
+	buffer->events = events;
+	buffer->capacity = capacity;
+	buffer->count = 0;
+	buffer->thread_id = thread_id;
+	buffer->thread_name = thread_name;
+	buffer->next = 0;
+	return;
+}
+
+// Checks if the buffer is already in the list starting at head
+static uint8_t aidebug_trace_is_registered(aidebug_trace_buffer_t *head, aidebug_trace_buffer_t *buffer)
+{
+	for(; head != 0; head = head->next){
+		if(head == buffer){
+			return 1;
+		}
+	}
+	return 0;
+}
+
+void aidebug_trace_register_thread(aidebug_trace_buffer_t *buffer)
+{
+	aidebug_trace_current_buffer = buffer;
+
+#if defined(__GCC_ATOMIC_POINTER_LOCK_FREE) && !defined(__AVR__)
+	// Lock free push to the front of the list
+	aidebug_trace_buffer_t *head = __atomic_load_n(&aidebug_trace_buffers, __ATOMIC_ACQUIRE);
+	do {
+		// A second push of the same buffer would link it to itself
+		if(aidebug_trace_is_registered(head, buffer)){
+			return;
+		}
+		buffer->next = head;
+	} while(!__atomic_compare_exchange_n(&aidebug_trace_buffers, &head, buffer, 0, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE));
+#else
+	if(aidebug_trace_is_registered(aidebug_trace_buffers, buffer)){
+		return;
+	}
+	buffer->next = aidebug_trace_buffers;
+	aidebug_trace_buffers = buffer;
+#endif
+	return;
+}
+
+void aidebug_trace_set_clock(uint64_t (*clock_us)(void))
+{
+	aidebug_trace_clock = clock_us;
+	return;
+}
+
+uint64_t aidebug_trace_timestamp(void)
+{
+	if(aidebug_trace_clock != 0){
+		return aidebug_trace_clock();
+	}
+	return aidebug_trace_event_counter++;
+}
+
+static void aidebug_trace_record(const char *name, const char *category, int32_t arg, char phase)
+{
+	aidebug_trace_buffer_t *buffer = aidebug_trace_current_buffer;
+	aidebug_trace_event_t *event;
+
+	if(buffer == 0 || buffer->capacity == 0){
+		return;
+	}
+
+	event = &buffer->events[buffer->count % buffer->capacity];
+	event->timestamp = aidebug_trace_timestamp();
+	event->name = name;
+	event->category = category;
+	event->arg = arg;
+	event->phase = phase;
+	buffer->count++;
+	return;
+}
+
+void aidebug_trace_begin(const char *name, const char *category, int32_t arg)
+{
+	aidebug_trace_record(name, category, arg, AIDEBUG_TRACE_PHASE_BEGIN);
+	return;
+}
+
+void aidebug_trace_end(const char *name, const char *category, int32_t arg)
+{
+	aidebug_trace_record(name, category, arg, AIDEBUG_TRACE_PHASE_END);
+	return;
+}
+
+void aidebug_trace_reset(void)
+{
+	aidebug_trace_buffer_t *buffer;
+
+	for(buffer = aidebug_trace_buffers; buffer != 0; buffer = buffer->next){
+		buffer->count = 0;
+	}
+	return;
+}
+
+void aidebug_trace_write_chrome_json(int (*print)(const char *format, ...))
+{
+	aidebug_trace_buffer_t *buffer;
+	aidebug_trace_event_t *event;
+	uint32_t i, first, count, depth;
+	uint8_t separator = 0;
+
+	print("{\"traceEvents\":[\n");
+	for(buffer = aidebug_trace_buffers; buffer != 0; buffer = buffer->next){
+		// Thread name as metadata event
+		print("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%lu,\"args\":{\"name\":\"%s\"}}",
+			  separator ? ",\n" : "", (unsigned long) buffer->thread_id,
+			  buffer->thread_name != 0 ? buffer->thread_name : "thread");
+		separator = 1;
+
+		count = buffer->count < buffer->capacity ? buffer->count : buffer->capacity;
+		first = buffer->count - count;
+		depth = 0;
+		for(i = 0; i < count; i++){
+			event = &buffer->events[(first + i) % buffer->capacity];
+			// Skip end events whose begin event was overwritten in the ring buffer
+			if(event->phase == AIDEBUG_TRACE_PHASE_END){
+				if(depth == 0){
+					continue;
+				}
+				depth--;
+			} else {
+				depth++;
+			}
+			print(",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":0,\"tid\":%lu",
+				  event->name, event->category, event->phase,
+				  (unsigned long long) event->timestamp, (unsigned long) buffer->thread_id);
+			if(event->arg != AIDEBUG_TRACE_NO_ARG){
+				print(",\"args\":{\"index\":%ld}", (long) event->arg);
+			}
+			print("}");
+		}
+	}
+	print("\n],\"displayTimeUnit\":\"ms\"}\n");
+	return;
+}
@@ -0,0 +1,178 @@
+/**
+ * \file basic/base/aidebug/aidebug_trace.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+	All rights reserved.
+
+	AIfES is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	This program is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Timeline tracing of the model execution in Chrome trace / Perfetto format
+ *
+ * The tracer records begin and end events (for example for the forward and backward pass of every layer or every
+ * optimizer update) into per-thread ring buffers. The events can be exported as Chrome trace JSON that can be opened
+ * with chrome://tracing or https://ui.perfetto.dev.
+ *
+ * The tracer is only compiled in when \ref AIDEBUG_TRACE is defined (see aifes_math.h).
+ * Otherwise the trace macros (AIDEBUG_TRACE_BEGIN(), AIDEBUG_TRACE_END()) expand to nothing and cause no runtime costs.
+ *
+ * Every thread that should be traced needs its own buffer. A buffer is written by its owning thread only, so no locks
+ * are required. If the buffer is full, the oldest events are overwritten. End events whose begin event was overwritten
+ * are not exported.
+ *
+ * Example:
+ * \code{.c}
+ * aidebug_trace_event_t trace_events[1024];
+ * aidebug_trace_buffer_t trace_buffer;
+ *
+ * aidebug_trace_init_buffer(&trace_buffer, trace_events, 1024, 0, "main");
+ * aidebug_trace_register_thread(&trace_buffer);
+ *
+ * // On Arduino a clock has to be set (on POSIX systems a monotonic clock is used by default)
+ * aidebug_trace_set_clock(arduino_micros); // uint64_t arduino_micros(void){ return micros(); }
+ *
+ * aialgo_train_model(&model, &input_tensor, &target_tensor, optimizer, batch_size);
+ *
+ * aidebug_trace_write_chrome_json(printf);
+ * \endcode
+ */
+
+#ifndef AIDEBUG_TRACE_H
+#define AIDEBUG_TRACE_H
+
+#include "core/aifes_core.h"
+
+/** @brief Thread local storage qualifier used for the buffer of the current thread
+ *
+ * On bare metal targets there is only one thread, so no qualifier is needed.
+ */
+#if defined(__GNUC__) && (defined(__unix__) || defined(__APPLE__))
+#define AIDEBUG_THREAD_LOCAL    __thread
+#else
+#define AIDEBUG_THREAD_LOCAL
+#endif
+
+#define AIDEBUG_TRACE_PHASE_BEGIN   'B'
+#define AIDEBUG_TRACE_PHASE_END     'E'
+
+#define AIDEBUG_TRACE_NO_ARG        (-1)
+
+typedef struct aidebug_trace_event  aidebug_trace_event_t;
+typedef struct aidebug_trace_buffer aidebug_trace_buffer_t;
+
+/** @brief A single begin or end event of the trace
+ */
+struct aidebug_trace_event {
+	const char *name; /**< Name of the event (must be a static string, for example the layer type name). */
+	const char *category; /**< Category of the event (must be a static string, for example "forward"). */
+	uint64_t timestamp; /**< Timestamp in microseconds. */
+	int32_t arg; /**< Optional argument like the layer index (AIDEBUG_TRACE_NO_ARG if not used). */
+	char phase; /**< AIDEBUG_TRACE_PHASE_BEGIN or AIDEBUG_TRACE_PHASE_END. */
+};
+
+/** @brief Ring buffer for the events of one thread
+ */
+struct aidebug_trace_buffer {
+	aidebug_trace_event_t *events; /**< Event memory with capacity elements. */
+	uint32_t capacity; /**< Maximum number of stored events. */
+	volatile uint32_t count; /**< Total number of recorded events (the buffer index is count % capacity). */
+
+	uint32_t thread_id; /**< ID of the thread (tid field of the trace). */
+	const char *thread_name; /**< Name of the thread shown in the trace viewer. */
+
+	aidebug_trace_buffer_t *next; /**< Next registered buffer (internal list of all traced threads). */
+};
+
+/** @brief Initialize a trace buffer
+ *
+ * @param *buffer       The buffer to initialize
+ * @param *events       Memory for the events
+ * @param capacity      Number of events that fit into the memory
+ * @param thread_id     ID of the thread that uses the buffer
+ * @param *thread_name  Name of the thread (static string)
+ */
+void aidebug_trace_init_buffer(aidebug_trace_buffer_t *buffer, aidebug_trace_event_t *events, uint32_t capacity, uint32_t thread_id, const char *thread_name);
+
+/** @brief Register the buffer for the calling thread
+ *
+ * All events of the calling thread are written to this buffer afterwards.
+ * The buffer is added to the list of buffers that are exported with aidebug_trace_write_chrome_json().
+ * Registering an already registered buffer again only makes it the buffer of the calling thread.
+ *
+ * @param *buffer   The initialized buffer
+ */
+void aidebug_trace_register_thread(aidebug_trace_buffer_t *buffer);
+
+/** @brief Set the clock function for the timestamps
+ *
+ * The function has to return a monotonic time in microseconds.
+ * On POSIX systems a monotonic clock is set by default. If no clock is available, the timestamps are
+ * consecutive event numbers.
+ *
+ * @param *clock_us Function that returns the current time in microseconds
+ */
+void aidebug_trace_set_clock(uint64_t (*clock_us)(void));
+
+/** @brief Returns the current timestamp of the trace clock in microseconds
+ *
+ * @return Timestamp in microseconds
+ */
+uint64_t aidebug_trace_timestamp(void);
+
+/** @brief Record a begin event in the buffer of the calling thread
+ *
+ * Use the AIDEBUG_TRACE_BEGIN() macro instead to remove the call when tracing is disabled.
+ *
+ * @param *name         Name of the event (static string)
+ * @param *category     Category of the event (static string)
+ * @param arg           Optional argument (AIDEBUG_TRACE_NO_ARG if not used)
+ */
+void aidebug_trace_begin(const char *name, const char *category, int32_t arg);
+
+/** @brief Record an end event in the buffer of the calling thread
+ *
+ * Use the AIDEBUG_TRACE_END() macro instead to remove the call when tracing is disabled.
+ *
+ * @param *name         Name of the event (static string)
+ * @param *category     Category of the event (static string)
+ * @param arg           Optional argument (AIDEBUG_TRACE_NO_ARG if not used)
+ */
+void aidebug_trace_end(const char *name, const char *category, int32_t arg);
+
+/** @brief Clear the events of all registered buffers
+ */
+void aidebug_trace_reset(void);
+
+/** @brief Write the events of all registered buffers as Chrome trace JSON
+ *
+ * Call this function only when the traced threads are not recording at the same time.
+ *
+ * @param *print    A function for printing (for example printf)
+ */
+void aidebug_trace_write_chrome_json(int (*print)(const char *format, ...));
+
+#ifdef AIDEBUG_TRACE
+#define AIDEBUG_TRACE_BEGIN(NAME, CATEGORY, ARG)    aidebug_trace_begin((NAME), (CATEGORY), (ARG))
+#define AIDEBUG_TRACE_END(NAME, CATEGORY, ARG)      aidebug_trace_end((NAME), (CATEGORY), (ARG))
+#else
+#define AIDEBUG_TRACE_BEGIN(NAME, CATEGORY, ARG)
+#define AIDEBUG_TRACE_END(NAME, CATEGORY, ARG)
+#endif // AIDEBUG_TRACE
+
+/** @brief Name of a layer for the trace events (falls back to "Layer" if the layer type has no name) */
+#define AIDEBUG_TRACE_LAYER_NAME(LAYER)   (((LAYER)->layer_type != 0 && (LAYER)->layer_type->name != 0) ? (LAYER)->layer_type->name : "Layer")
+
+#endif // AIDEBUG_TRACE_H
@@ -0,0 +1,318 @@
+/**
+ * \file basic/base/aifeature/aifeature_mfcc.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aifeature_mfcc.h for documentation.
+ * \details
+ */
+
+#include "basic/base/aifeature/aifeature_mfcc.h"
+#include "basic/base/aidebug/aidebug_trace.h"
+#include "basic/base/aimath/aimath_f32.h"
+
+#include <string.h>
+#include <math.h>
+
+#define AIFEATURE_MFCC_PI	3.14159265358979f
+
+// Indices of the tables and buffers in aifeature_mfcc.shapes
+enum {
+	AIFEATURE_MFCC_WINDOW = 0,
+	AIFEATURE_MFCC_TWIDDLES,
+	AIFEATURE_MFCC_MEL_WEIGHTS,
+	AIFEATURE_MFCC_DCT,
+	AIFEATURE_MFCC_SAMPLES,
+	AIFEATURE_MFCC_SPECTRUM,
+	AIFEATURE_MFCC_POWER,
+	AIFEATURE_MFCC_MEL,
+	AIFEATURE_MFCC_LOG_MEL,
+	AIFEATURE_MFCC_COEFFICIENTS
+};
+
+static uint32_t aifeature_mfcc_align(uint32_t size)
+{
+	return (size + 3) & ~((uint32_t) 3);
+}
+
+static uint32_t aifeature_mfcc_sizeof_tensor(const aimath_dtype_t *dtype, uint32_t elements)
+{
+	return aifeature_mfcc_align(dtype->tensor_params_size) + aifeature_mfcc_align(elements * dtype->size);
+}
+
+static void aifeature_mfcc_place_tensor(aitensor_t *tensor, const aimath_dtype_t *dtype, uint16_t *shape, uint16_t rows, uint16_t cols,
+										void *memory_ptr, uint32_t *address_counter)
+{
+	tensor->dtype = dtype;
+	tensor->dim = 2;
+	tensor->shape = shape;
+	tensor->shape[0] = rows;
+	tensor->shape[1] = cols;
+	tensor->tensor_params = dtype->tensor_params_size > 0 ? memory_ptr + *address_counter : 0;
+	*address_counter += aifeature_mfcc_align(dtype->tensor_params_size);
+	tensor->data = memory_ptr + *address_counter;
+	*address_counter += aifeature_mfcc_align((uint32_t) rows * cols * dtype->size);
+	return;
+}
+
+static uint16_t aifeature_mfcc_coefficients(const aifeature_mfcc_t *feature)
+{
+	return feature->mfcc_count > 0 ? feature->mfcc_count : feature->mel_count;
+}
+
+static float aifeature_mfcc_hz_to_mel(float frequency)
+{
+	return 2595.0f * log10f(1.0f + frequency / 700.0f);
+}
+
+static float aifeature_mfcc_mel_to_hz(float mel)
+{
+	return 700.0f * (powf(10.0f, mel / 2595.0f) - 1.0f);
+}
+
+aifeature_mfcc_t *aifeature_mfcc(aifeature_mfcc_t *feature)
+{
+	feature->result.dtype = feature->dtype;
+	feature->result.dim = 2;
+	feature->result.shape = feature->result_shape;
+	feature->result_shape[0] = 1;
+	feature->result_shape[1] = feature->frame_count * aifeature_mfcc_coefficients(feature);
+	feature->result.data = 0;
+
+	feature->mel_index = 0;
+	feature->sample_count = 0;
+	feature->frames_calculated = 0;
+
+	return feature;
+}
+
+uint32_t aifeature_mfcc_sizeof_memory(const aifeature_mfcc_t *feature)
+{
+	uint32_t memory = 0;
+	uint32_t bins = feature->fft_length / 2 + 1;
+
+	// Tables
+	memory += aifeature_mfcc_sizeof_tensor(feature->dtype, feature->frame_length); // window
+	memory += aifeature_mfcc_sizeof_tensor(feature->dtype, feature->fft_length); // twiddles
+	memory += aifeature_mfcc_sizeof_tensor(feature->dtype, bins); // mel_weights
+	memory += aifeature_mfcc_align(bins * sizeof(int16_t)); // mel_index
+	if(feature->mfcc_count > 0){
+		memory += aifeature_mfcc_sizeof_tensor(feature->dtype, feature->mel_count * feature->mfcc_count); // dct_matrix
+	}
+
+	// Buffers
+	memory += aifeature_mfcc_sizeof_tensor(feature->dtype, feature->frame_length); // samples
+	memory += aifeature_mfcc_sizeof_tensor(feature->dtype, feature->fft_length); // spectrum
+	memory += aifeature_mfcc_sizeof_tensor(feature->power_dtype, bins); // power
+	memory += aifeature_mfcc_sizeof_tensor(feature->power_dtype, feature->mel_count); // mel
+	memory += aifeature_mfcc_sizeof_tensor(feature->dtype, feature->mel_count); // log_mel
+	if(feature->mfcc_count > 0){
+		memory += aifeature_mfcc_sizeof_tensor(feature->dtype, feature->mfcc_count); // coefficients
+	}
+
+	// Result data (the tensor_params are set by the data type specific implementation)
+	memory += aifeature_mfcc_align(aimath_tensor_elements(&(feature->result)) * feature->dtype->size);
+	return memory;
+}
+
+static void aifeature_mfcc_init_tables(aifeature_mfcc_t *feature)
+{
+	uint32_t i, j;
+	uint32_t bins = feature->fft_length / 2 + 1;
+	uint32_t edge_count = (uint32_t) feature->mel_count + 2;
+	uint32_t table_size = feature->fft_length > (uint32_t) feature->mel_count * feature->mfcc_count ? feature->fft_length : (uint32_t) feature->mel_count * feature->mfcc_count;
+	float upper_frequency = feature->upper_frequency > 0.0f ? feature->upper_frequency : 0.5f * feature->sample_rate;
+	float mel_lower = aifeature_mfcc_hz_to_mel(feature->lower_frequency);
+	float mel_upper = aifeature_mfcc_hz_to_mel(upper_frequency);
+	float edges[edge_count];
+	float table_data[table_size];
+	uint16_t table_shape[2];
+	aitensor_t table = AITENSOR_2D_F32(table_shape, table_data);
+
+	// Periodic Hann window
+	table_shape[0] = 1;
+	table_shape[1] = feature->frame_length;
+	for(i = 0; i < feature->frame_length; i++)
+	{
+		table_data[i] = 0.5f - 0.5f * cosf(2.0f * AIFEATURE_MFCC_PI * i / feature->frame_length);
+	}
+	feature->quantize_f32(&table, &(feature->window));
+
+	// Twiddle factors (cos(2 pi k / N), sin(2 pi k / N)) for k = 0 ... N/2-1
+	table_shape[1] = feature->fft_length;
+	for(i = 0; i < feature->fft_length / 2; i++)
+	{
+		table_data[2*i] = cosf(2.0f * AIFEATURE_MFCC_PI * i / feature->fft_length);
+		table_data[2*i + 1] = sinf(2.0f * AIFEATURE_MFCC_PI * i / feature->fft_length);
+	}
+	feature->quantize_f32(&table, &(feature->twiddles));
+
+	// Mel filterbank: edges of the filters as (fractional) FFT bins
+	for(i = 0; i < edge_count; i++)
+	{
+		edges[i] = aifeature_mfcc_mel_to_hz(mel_lower + i * (mel_upper - mel_lower) / (feature->mel_count + 1))
+					* feature->fft_length / feature->sample_rate;
+	}
+	table_shape[1] = bins;
+	for(i = 0, j = 0; i < bins; i++)
+	{
+		while(j + 2 < edge_count && edges[j + 1] <= (float) i){
+			j++;
+		}
+		if((float) i < edges[0] || (float) i >= edges[edge_count - 1]){
+			feature->mel_index[i] = -1;
+			table_data[i] = 0.0f;
+		} else {
+			feature->mel_index[i] = j;
+			table_data[i] = ((float) i - edges[j]) / (edges[j + 1] - edges[j]);
+		}
+	}
+	feature->quantize_f32(&table, &(feature->mel_weights));
+
+	// Orthonormal DCT-II matrix [mel_count x mfcc_count]
+	if(feature->mfcc_count > 0){
+		table_shape[0] = feature->mel_count;
+		table_shape[1] = feature->mfcc_count;
+		for(i = 0; i < feature->mel_count; i++)
+		{
+			for(j = 0; j < feature->mfcc_count; j++)
+			{
+				table_data[i * feature->mfcc_count + j] = sqrtf((j == 0 ? 1.0f : 2.0f) / feature->mel_count)
+															* cosf(AIFEATURE_MFCC_PI * j * (i + 0.5f) / feature->mel_count);
+			}
+		}
+		feature->quantize_f32(&table, &(feature->dct_matrix));
+	}
+	return;
+}
+
+uint8_t aifeature_mfcc_set_memory(aifeature_mfcc_t *feature, void *memory_ptr, uint32_t memory_size)
+{
+	uint32_t address_counter = 0;
+	uint16_t bins = feature->fft_length / 2 + 1;
+
+	if(memory_size < aifeature_mfcc_sizeof_memory(feature)){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("The memory of the feature extraction is too small.\n");
+#endif
+		return 1;
+	}
+
+	aifeature_mfcc_place_tensor(&(feature->window), feature->dtype, feature->shapes[AIFEATURE_MFCC_WINDOW], 1, feature->frame_length, memory_ptr, &address_counter);
+	aifeature_mfcc_place_tensor(&(feature->twiddles), feature->dtype, feature->shapes[AIFEATURE_MFCC_TWIDDLES], 1, feature->fft_length, memory_ptr, &address_counter);
+	aifeature_mfcc_place_tensor(&(feature->mel_weights), feature->dtype, feature->shapes[AIFEATURE_MFCC_MEL_WEIGHTS], 1, bins, memory_ptr, &address_counter);
+	feature->mel_index = memory_ptr + address_counter;
+	address_counter += aifeature_mfcc_align(bins * sizeof(int16_t));
+	if(feature->mfcc_count > 0){
+		aifeature_mfcc_place_tensor(&(feature->dct_matrix), feature->dtype, feature->shapes[AIFEATURE_MFCC_DCT], feature->mel_count, feature->mfcc_count, memory_ptr, &address_counter);
+	}
+
+	aifeature_mfcc_place_tensor(&(feature->samples), feature->dtype, feature->shapes[AIFEATURE_MFCC_SAMPLES], 1, feature->frame_length, memory_ptr, &address_counter);
+	aifeature_mfcc_place_tensor(&(feature->spectrum), feature->dtype, feature->shapes[AIFEATURE_MFCC_SPECTRUM], 1, feature->fft_length, memory_ptr, &address_counter);
+	aifeature_mfcc_place_tensor(&(feature->power), feature->power_dtype, feature->shapes[AIFEATURE_MFCC_POWER], 1, bins, memory_ptr, &address_counter);
+	aifeature_mfcc_place_tensor(&(feature->mel), feature->power_dtype, feature->shapes[AIFEATURE_MFCC_MEL], 1, feature->mel_count, memory_ptr, &address_counter);
+	aifeature_mfcc_place_tensor(&(feature->log_mel), feature->dtype, feature->shapes[AIFEATURE_MFCC_LOG_MEL], 1, feature->mel_count, memory_ptr, &address_counter);
+	if(feature->mfcc_count > 0){
+		aifeature_mfcc_place_tensor(&(feature->coefficients), feature->dtype, feature->shapes[AIFEATURE_MFCC_COEFFICIENTS], 1, feature->mfcc_count, memory_ptr, &address_counter);
+	}
+
+	feature->result.data = memory_ptr + address_counter;
+
+	aifeature_mfcc_init_tables(feature);
+	aifeature_mfcc_reset(feature);
+	return 0;
+}
+
+void aifeature_mfcc_reset(aifeature_mfcc_t *feature)
+{
+	feature->sample_count = 0;
+	feature->frames_calculated = 0;
+	memset(feature->result.data, 0, aimath_sizeof_tensor_data(&(feature->result)));
+	return;
+}
+
+void aifeature_mfcc_calc_frame(aifeature_mfcc_t *feature, const aitensor_t *frame)
+{
+	uint16_t coefficients = aifeature_mfcc_coefficients(feature);
+	uint32_t frame_size = coefficients * aimath_sizeof_dtype(feature->dtype);
+	uint16_t frame_shape[2] = {1, coefficients};
+	aitensor_t *features;
+	aitensor_t result_frame = {
+		.dtype = feature->dtype,
+		.dim = 2,
+		.shape = frame_shape,
+		.tensor_params = feature->result.tensor_params,
+		.data = feature->result.data + (feature->frame_count - 1) * frame_size
+	};
+
+	AIDEBUG_TRACE_BEGIN("MFCC", "feature", feature->frames_calculated);
+
+	feature->apply_window(frame, &(feature->window), &(feature->spectrum));
+	feature->rfft(&(feature->spectrum), &(feature->twiddles));
+	feature->power_spectrum(&(feature->spectrum), &(feature->power));
+	feature->mel_filterbank(&(feature->power), feature->mel_index, &(feature->mel_weights), &(feature->mel));
+	feature->log(&(feature->mel), &(feature->log_mel));
+	if(feature->mfcc_count > 0){
+		feature->mat_mul(&(feature->log_mel), &(feature->dct_matrix), &(feature->coefficients));
+		features = &(feature->coefficients);
+	} else {
+		features = &(feature->log_mel);
+	}
+
+	// Drop the oldest frame and store the new one at the end
+	memmove(feature->result.data, feature->result.data + frame_size, (feature->frame_count - 1) * frame_size);
+	feature->store_frame(features, &result_frame);
+	feature->frames_calculated++;
+
+	AIDEBUG_TRACE_END("MFCC", "feature", feature->frames_calculated - 1);
+	return;
+}
+
+uint16_t aifeature_mfcc_push_samples(aifeature_mfcc_t *feature, const aitensor_t *samples)
+{
+	uint32_t i = 0;
+	uint32_t count;
+	uint32_t elements = aimath_tensor_elements(samples);
+	uint16_t sample_size = aimath_sizeof_dtype(feature->dtype);
+	uint16_t new_frames = 0;
+
+	if(samples->tensor_params != 0 && feature->samples.tensor_params != 0){
+		memcpy(feature->samples.tensor_params, samples->tensor_params, feature->dtype->tensor_params_size);
+	}
+
+	while(i < elements)
+	{
+		count = feature->frame_length - feature->sample_count;
+		if(count > elements - i){
+			count = elements - i;
+		}
+		memcpy(feature->samples.data + feature->sample_count * sample_size, samples->data + i * sample_size, count * sample_size);
+		feature->sample_count += count;
+		i += count;
+
+		if(feature->sample_count == feature->frame_length){
+			aifeature_mfcc_calc_frame(feature, &(feature->samples));
+			new_frames++;
+
+			// Keep the overlap with the next frame
+			memmove(feature->samples.data, feature->samples.data + feature->frame_step * sample_size, (feature->frame_length - feature->frame_step) * sample_size);
+			feature->sample_count = feature->frame_length - feature->frame_step;
+		}
+	}
+	return new_frames;
+}
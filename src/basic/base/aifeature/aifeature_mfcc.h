@@ -0,0 +1,268 @@
+/**
+ * \file basic/base/aifeature/aifeature_mfcc.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Base implementation of a streaming audio feature extraction (log mel spectrogram and MFCC)
+ *
+ * This is an "abstract" data-type independent implementation. To use the feature extraction, use one of the provided
+ * implementations for a specific hardware and data-type (for example from aifeature_mfcc_default.h) or set
+ * the required math functions on your own.
+ *
+ * The signal is split into frames of frame_length samples with a distance of frame_step samples. For every frame
+ * the following stages are calculated:
+ * 1. **Window:** Multiplication with a (periodic) Hann window and zero padding to fft_length
+ * 2. **Real FFT:** Discrete Fourier transform of the real frame and power spectrum \f$ |X_k|^2 \f$
+ * 3. **Mel filterbank:** mel_count overlapping triangular filters, equally spaced on the mel scale
+ *    \f$ mel(f) = 2595 \cdot log_{10}(1 + f / 700) \f$ between lower_frequency and upper_frequency
+ * 4. **Log:** Natural logarithm of the filterbank energies (log mel spectrogram)
+ * 5. **DCT:** Orthonormal DCT-II of the log mel energies, the first mfcc_count coefficients are the MFCCs
+ *    (skipped if mfcc_count is 0)
+ *
+ * The features of the last frame_count frames are stored in the result tensor (2D tensor of shape
+ * [1 x frame_count * coefficients], oldest frame first). It can be used directly as input of a model with a
+ * matching \link ailayer_input.h input layer \endlink.
+ *
+ * **Streaming:** New samples are added with aifeature_mfcc_push_samples(), for example from the callback of the
+ * microphone. Only the frames that are completed by the new samples are calculated; the older frames are moved one
+ * frame to the front of the result tensor.
+ *
+ * All tables (window, twiddle factors, filterbank and DCT matrix) and buffers are placed in a memory block that
+ * is provided by the user (see aifeature_mfcc_sizeof_memory() and aifeature_mfcc_set_memory()).
+ *
+ * Example:
+ * \code{.c}
+ * aifeature_mfcc_f32_t mfcc = {
+ *     .sample_rate = 16000,
+ *     .frame_length = 480,
+ *     .frame_step = 320,
+ *     .fft_length = 512,
+ *     .mel_count = 40,
+ *     .mfcc_count = 13,
+ *     .frame_count = 49,
+ *     .lower_frequency = 20.0f,
+ *     .upper_frequency = 4000.0f
+ * };
+ * aifeature_mfcc_f32_default(&mfcc);
+ *
+ * uint32_t memory_size = aifeature_mfcc_sizeof_memory(&mfcc);
+ * void *memory_ptr = malloc(memory_size);
+ * aifeature_mfcc_set_memory(&mfcc, memory_ptr, memory_size);
+ *
+ * // In the main loop
+ * if(aifeature_mfcc_push_samples(&mfcc, &samples) > 0){
+ *     aialgo_inference_model(&model, &mfcc.result, &output_tensor);
+ * }
+ * \endcode
+ */
+
+#ifndef AIFEATURE_MFCC
+#define AIFEATURE_MFCC
+
+#include "core/aifes_core.h"
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+typedef struct aifeature_mfcc 	aifeature_mfcc_t; /**< New data type name for code reduction. */
+
+/** @brief General \link aifeature_mfcc.h streaming MFCC feature extraction \endlink structure
+*
+*/
+struct aifeature_mfcc {
+	/** @name Configuration
+	 * @brief Required configuration parameters for the feature extraction
+	 */
+	///@{
+	uint32_t sample_rate; /**< Sample rate of the signal in Hz. */
+	uint16_t frame_length; /**< Number of samples per frame. */
+	uint16_t frame_step; /**< Number of samples between the starts of two frames. */
+	uint16_t fft_length; /**< Length of the FFT (power of two, at least frame_length). */
+	uint16_t mel_count; /**< Number of mel filters. */
+	uint16_t mfcc_count; /**< Number of MFCCs per frame (not more than mel_count) or 0 for the log mel energies. */
+	uint16_t frame_count; /**< Number of frames in the result tensor. */
+	float lower_frequency; /**< Lower edge of the first mel filter in Hz. */
+	float upper_frequency; /**< Upper edge of the last mel filter in Hz (0 for the half sample rate). */
+	///@}
+
+	const aimath_dtype_t *dtype; /**< Data type of the samples, the tables and the result. */
+	const aimath_dtype_t *power_dtype; /**< Data type of the power spectrum and the filterbank energies. */
+
+	/** @name Result
+	 * @brief The features of the last frame_count frames
+	 */
+	///@{
+	aitensor_t result; /**< Feature tensor of shape [1 x frame_count * coefficients] (oldest frame first). */
+	uint16_t result_shape[2]; /**< Shape of the result tensor. */
+	uint32_t frames_calculated; /**< Number of frames calculated since the last reset. */
+	///@}
+
+	/** @name Tables and buffers
+	 * @brief Located in the memory block given by aifeature_mfcc_set_memory()
+	 */
+	///@{
+	aitensor_t window; /**< Window function (frame_length elements). */
+	aitensor_t twiddles; /**< Twiddle factors of the FFT (fft_length elements). */
+	aitensor_t mel_weights; /**< Weights of the rising filter edges (fft_length / 2 + 1 elements). */
+	int16_t *mel_index; /**< Filter index of the rising edges (fft_length / 2 + 1 elements). */
+	aitensor_t dct_matrix; /**< DCT matrix of shape [mel_count x mfcc_count]. */
+	aitensor_t samples; /**< Buffer for the samples of the next frame (frame_length elements). */
+	aitensor_t spectrum; /**< Windowed frame and FFT result (fft_length elements). */
+	aitensor_t power; /**< Power spectrum (fft_length / 2 + 1 elements). */
+	aitensor_t mel; /**< Filterbank energies (mel_count elements). */
+	aitensor_t log_mel; /**< Log mel energies (mel_count elements). */
+	aitensor_t coefficients; /**< MFCCs of the current frame (mfcc_count elements). */
+	uint16_t sample_count; /**< Number of samples in the samples buffer. */
+	uint16_t shapes[10][2]; /**< Shapes of the tables and buffers. */
+	///@}
+
+	/** @name Math functions
+	 * @brief Required data type specific math functions
+	 */
+	///@{
+
+	/** @brief Required math function: Conversion of a F32 tensor into the data type of the tables
+	 *
+	 * Only used in aifeature_mfcc_set_memory() to initialize the tables.
+	 *
+	 * @param x         F32 tensor (input)
+	 * @param result    Tensor with the same shape (output)
+	 */
+	void (*quantize_f32)(const aitensor_t *x, aitensor_t *result);
+
+	/** @brief Required math function: Window function with zero padding
+	 *
+	 * @param x         Signal frame (input)
+	 * @param window    Window function (input)
+	 * @param result    Windowed and zero padded frame (output)
+	 */
+	void (*apply_window)(const aitensor_t *x, const aitensor_t *window, aitensor_t *result);
+
+	/** @brief Required math function: In place FFT of a real signal with packed result
+	 *
+	 * @param x         Signal, replaced by the packed transform (input and output)
+	 * @param twiddles  Twiddle factor table (input)
+	 */
+	void (*rfft)(aitensor_t *x, const aitensor_t *twiddles);
+
+	/** @brief Required math function: Power spectrum of the packed FFT result
+	 *
+	 * @param x         Packed transform (input)
+	 * @param result    Power spectrum (output)
+	 */
+	void (*power_spectrum)(const aitensor_t *x, aitensor_t *result);
+
+	/** @brief Required math function: Triangular filterbank
+	 *
+	 * @param power         Power spectrum (input)
+	 * @param mel_index     Filter index of the rising edges (input)
+	 * @param mel_weights   Weights of the rising edges (input)
+	 * @param result        Filterbank energies (output)
+	 */
+	void (*mel_filterbank)(const aitensor_t *power, const int16_t *mel_index, const aitensor_t *mel_weights, aitensor_t *result);
+
+	/** @brief Required math function: Natural logarithm
+	 *
+	 * @param x         Filterbank energies (input)
+	 * @param result    Log mel energies (output)
+	 */
+	void (*log)(const aitensor_t *x, aitensor_t *result);
+
+	/** @brief Required math function: Matrix multiplication (for the DCT)
+	 *
+	 * @param a         Log mel energies (input)
+	 * @param b         DCT matrix (input)
+	 * @param result    MFCCs (output)
+	 */
+	void (*mat_mul)(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
+
+	/** @brief Required math function: Storage of the features of a frame in the result tensor
+	 *
+	 * Copies the features into the result frame (for fixed point data types with the quantization of the result).
+	 *
+	 * @param x         Features of the current frame (input)
+	 * @param result    Frame of the result tensor (output)
+	 */
+	void (*store_frame)(const aitensor_t *x, aitensor_t *result);
+
+	///@}
+};
+
+/** @brief Initialize the given feature extraction structure
+ *
+ * This function represents the "constructor" of the abstract feature extraction.\n
+ * This function is not intended to call it directly. Instead use one of the data type specific implementations
+ * (like for example aifeature_mfcc_f32_default()).
+ *
+ * @param *feature  The feature extraction structure to initialize.
+ * @return          Pointer to the (successfully) initialized structure
+ */
+aifeature_mfcc_t *aifeature_mfcc(aifeature_mfcc_t *feature);
+
+/** @brief Calculate the memory size for the tables and buffers of the feature extraction
+ *
+ * @param *feature  The feature extraction structure
+ * @return          Required memory size in bytes
+ */
+uint32_t aifeature_mfcc_sizeof_memory(const aifeature_mfcc_t *feature);
+
+/** @brief Assign the memory for the tables and buffers, initialize the tables and reset the feature extraction
+ *
+ * The tables are calculated once in F32 and converted to the data type of the feature extraction.
+ * Temporary F32 arrays for the tables are placed on the stack (at most fft_length or mel_count * mfcc_count floats).
+ *
+ * @param *feature      The feature extraction structure
+ * @param *memory_ptr   Pointer to the memory block
+ * @param memory_size   Size of the memory block (for error checking)
+ * @return              0 if successful
+ */
+uint8_t aifeature_mfcc_set_memory(aifeature_mfcc_t *feature, void *memory_ptr, uint32_t memory_size);
+
+/** @brief Clear the sample buffer and the result tensor
+ *
+ * @param *feature  The feature extraction structure
+ */
+void aifeature_mfcc_reset(aifeature_mfcc_t *feature);
+
+/** @brief Add new samples and calculate the features of all completed frames
+ *
+ * The samples are appended to the sample buffer. Every time frame_length samples are available, the features of
+ * the frame are calculated and appended to the result tensor (the oldest frame is dropped) and the buffer is moved
+ * by frame_step samples.
+ *
+ * The samples must have the data type of the feature extraction (for example \link aimath_f32.h F32 \endlink values
+ * in [-1, 1) or \link aimath_q15.h Q15 \endlink PCM values with shift 15). All samples of a stream must use the same
+ * quantization. frame_step must not be larger than frame_length.
+ *
+ * @param *feature  The feature extraction structure
+ * @param *samples  Tensor with the new samples (all elements are used)
+ * @return          Number of new frames in the result tensor
+ */
+uint16_t aifeature_mfcc_push_samples(aifeature_mfcc_t *feature, const aitensor_t *samples);
+
+/** @brief Calculate the features of one frame and append them to the result tensor
+ *
+ * Used by aifeature_mfcc_push_samples(). Can be used directly if the frames are already available.
+ *
+ * @param *feature  The feature extraction structure
+ * @param *frame    Tensor with frame_length samples
+ */
+void aifeature_mfcc_calc_frame(aifeature_mfcc_t *feature, const aitensor_t *frame);
+
+#endif // AIFEATURE_MFCC
@@ -28,11 +28,12 @@
 const aicore_layertype_t ailayer_dense_type_s = {
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
     .name = "Dense",
-	.print_specs = ailayer_dense_print_specs
+	.print_specs = ailayer_dense_print_specs,
 #else
     .name = 0,
-    .print_specs = 0
+    .print_specs = 0,
 #endif
+	.calc_cost = ailayer_dense_calc_cost
 };
 const aicore_layertype_t *ailayer_dense_type = &ailayer_dense_type_s;
 
@@ -67,12 +68,14 @@ ailayer_t *ailayer_dense(ailayer_dense_t *layer, ailayer_t *input_layer)
 
 	layer->base.forward = ailayer_dense_forward;
 	layer->base.backward = ailayer_dense_backward;
+	layer->base.backward_sgd = layer->linear_backward_sgd != 0 ? ailayer_dense_backward_sgd : 0;
 
 	layer->base.calc_result_shape = ailayer_dense_calc_result_shape;
 	layer->base.sizeof_paramem = ailayer_dense_sizeof_paramem;
 	layer->base.set_paramem = ailayer_dense_set_paramem;
 	layer->base.sizeof_trainmem = ailayer_dense_sizeof_trainmem;
 	layer->base.set_trainmem = ailayer_dense_set_trainmem;
+	layer->base.result_in_place = FALSE;
 
 	layer->base.get_result_bound = 0;
 
@@ -113,12 +116,14 @@ void ailayer_dense_backward(ailayer_t *self)
 	aitensor_t *d_bias = layer->gradients[1];
 
 	int8_t temp_result_data[aimath_sizeof_tensor_data(d_weights)];
+	// Own tensor params, because data types with calculated quantization parameters would override the ones of d_weights
+	uint32_t temp_result_params[aimath_sizeof_tensor_params(d_weights) / sizeof(uint32_t) + 1];
 	aitensor_t temp_result = {
 		.dim = 2,
 		.shape = d_weights->shape,
 		.data = temp_result_data,
 		.dtype = d_weights->dtype,
-		.tensor_params = d_weights->tensor_params
+		.tensor_params = temp_result_params
 	};
 
 	aimath_transpose_vector(x_in);
@@ -140,6 +145,19 @@ void ailayer_dense_backward(ailayer_t *self)
 	return;
 }
 
+void ailayer_dense_backward_sgd(ailayer_t *self, const void *learning_rate)
+{
+	aitensor_t *delta_in = &(self->deltas);
+	aitensor_t *delta_out = &(self->output_layer->deltas);
+	aitensor_t *x_in = &(self->input_layer->result);
+	ailayer_dense_t *layer = (ailayer_dense_t *)(self->layer_configuration);
+
+	// d_in = w^T * d_out (old weights), w = w - lr * x_in^T * d_out, b = b - lr * d_out
+	layer->linear_backward_sgd(x_in, delta_out, learning_rate, &(layer->weights), &(layer->bias), delta_in);
+
+	return;
+}
+
 void ailayer_dense_calc_result_shape(ailayer_t *self)
 {
 	ailayer_dense_t *layer = (ailayer_dense_t *)(self->layer_configuration);
@@ -221,6 +239,7 @@ void ailayer_dense_set_trainmem(ailayer_t *self, void *memory_ptr)
 	address_counter += aimath_sizeof_tensor_data(layer->gradients[0]);
 	self->gradients[0]->tensor_params = memory_ptr + address_counter;
 	address_counter += aimath_sizeof_tensor_params(layer->gradients[0]);
+	address_counter = AIMATH_ALIGN_SIZE(address_counter);
 
 	// Bias gradients in gradients[1]
 	self->gradients[1] = memory_ptr + address_counter;
@@ -232,10 +251,30 @@ void ailayer_dense_set_trainmem(ailayer_t *self, void *memory_ptr)
 	address_counter += aimath_sizeof_tensor_data(layer->gradients[1]);
 	self->gradients[1]->tensor_params = memory_ptr + address_counter;
 	address_counter += aimath_sizeof_tensor_params(layer->gradients[1]);
+	address_counter = AIMATH_ALIGN_SIZE(address_counter);
 
 	return;
 }
 
+void ailayer_dense_calc_cost(const ailayer_t *self, aicore_layercost_t *cost)
+{
+	ailayer_dense_t *layer = (ailayer_dense_t *)(self->layer_configuration);
+	uint32_t batch = self->input_layer->result.shape[0];
+	uint32_t inputs = self->input_layer->result.shape[1];
+	uint32_t neurons = layer->neurons;
+	uint32_t weights_bytes = inputs * neurons * aimath_sizeof_dtype(layer->weights_dtype);
+	uint32_t bias_bytes = neurons * aimath_sizeof_dtype(layer->bias_dtype);
+
+	// One multiply-accumulate (2 operations) per weight and sample plus the bias addition
+	cost->ops = 2 * batch * inputs * neurons + batch * neurons;
+	cost->special_ops = 0;
+	cost->bytes_read = aimath_sizeof_tensor_data(&(self->input_layer->result)) + weights_bytes + bias_bytes;
+	cost->bytes_written = aimath_sizeof_tensor_data(&(self->result));
+	cost->parameter_bytes = weights_bytes + bias_bytes;
+	cost->activation_bytes = aimath_sizeof_tensor_data(&(self->result));
+	return;
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 void ailayer_dense_print_specs(const ailayer_t *self, int (*print)(const char *format, ...))
 {
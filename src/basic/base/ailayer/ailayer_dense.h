@@ -141,6 +141,27 @@ struct ailayer_dense {
 	 */
 	void (*tensor_add)(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
 
+	/** @brief Optional math function: Backward pass with SGD update
+	 *
+	 * Calculates the deltas for the previous layer with the old weights and updates the parameters with the
+	 * gradients in the same pass (no gradient memory):\n
+     * @f[
+     *  \delta_{in} = \delta_{out} \cdot w^T, \quad w \leftarrow w - \eta \cdot x^T \cdot \delta_{out},
+     *  \quad b \leftarrow b - \eta \cdot \sum_n \delta_{out,n}
+     * @f]
+     *
+     * delta_in may be the same tensor as x. If not set (0), the layer does not support aialgo_train_model_fused_sgd().
+     *
+     * @param x             Matrix with dimension \f$ N \times K \f$ (input)
+     * @param delta_out     Matrix with dimension \f$ N \times M \f$ (input)
+     * @param learning_rate Scalar \f$ \eta \f$ (input)
+     * @param weights       Matrix with dimension \f$ K \times M \f$ (input / output)
+     * @param bias          Laying vektor with dimension \f$ 1 \times M \f$ (input / output)
+     * @param delta_in      Matrix with dimension \f$ N \times K \f$ (output)
+	 */
+	void (*linear_backward_sgd)(const aitensor_t *x, const aitensor_t *delta_out, const void *learning_rate,
+								aitensor_t *weights, aitensor_t *bias, aitensor_t *delta_in);
+
 	///@}
 
 	uint16_t result_shape[2]; /**< Inference result tensor (ailayer.result) shape. */
@@ -226,6 +247,32 @@ void ailayer_dense_forward(ailayer_t *self);
  */
 void ailayer_dense_backward(ailayer_t *self);
 
+/** @brief Calculate the backward pass for the given Dense layer and apply a SGD update to the parameters
+ *
+ * *Implementation of ailayer.backward_sgd.*
+ *
+ * Fused version of ailayer_dense_backward() and the update of the SGD optimizer without momentum for
+ * aialgo_train_model_fused_sgd(). The errors for the previous layer are calculated with the weights before the update:
+ * @f[
+ *  \delta_{in} \leftarrow w^T \cdot \delta_{out}
+ * @f]
+ * @f[
+ *  w \leftarrow w - \eta \cdot x_{in}^T \cdot \delta_{out}
+ * @f]
+ * @f[
+ *  b \leftarrow b - \eta \cdot \left( \begin{array}{c} 1 & \cdots & 1 \\ \end{array}\right) \cdot \delta_{out}
+ * @f]
+ *
+ * Every weight is read and written only once and no gradient tensors are needed.
+ *
+ * Used math functions:
+ * * ailayer_dense.linear_backward_sgd
+ *
+ * @param *self             Layer to calculate the backward path for.
+ * @param *learning_rate    Learning rate \f$ \eta \f$ (aiscalar of the weights data type)
+ */
+void ailayer_dense_backward_sgd(ailayer_t *self, const void *learning_rate);
+
 /** @brief Calculate the shape of the result tensor (ailayer.result)
  *
  * *Implementation of ailayer.calc_result_shape.*
@@ -284,6 +331,22 @@ uint32_t ailayer_dense_sizeof_trainmem(const ailayer_t *self);
  */
 void ailayer_dense_set_trainmem(ailayer_t *self, void *memory_ptr);
 
+/** @brief Calculate the static cost of a forward pass of the Dense layer
+ *
+ * *Implementation of aicore_layertype.calc_cost.*
+ *
+ * The cost is calculated for the matrix multiplication with bias addition:
+ * * Operations: \f$ 2 \cdot N \cdot K \cdot M + N \cdot M \f$
+ * * Read: Input, weights and bias
+ * * Written: Result
+ *
+ * with the batch size \f$ N \f$, the number of inputs \f$ K \f$ and the number of neurons \f$ M \f$.
+ *
+ * @param *self The layer to calculate the cost for (the result shape has to be calculated before)
+ * @param *cost The calculated cost is written here
+ */
+void ailayer_dense_calc_cost(const ailayer_t *self, aicore_layercost_t *cost);
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 /** @brief Print the layer specification
  *
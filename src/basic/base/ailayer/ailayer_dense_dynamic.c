@@ -0,0 +1,173 @@
+/**
+ * \file basic/base/ailayer/ailayer_dense_dynamic.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See ailayer_dense_dynamic.h for documentation.
+ * \details
+ */
+
+#include "basic/base/ailayer/ailayer_dense_dynamic.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+#include <string.h>
+
+const aicore_layertype_t ailayer_dense_dynamic_type_s = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = "Dense (dynamic quantized)",
+	.print_specs = ailayer_dense_dynamic_print_specs,
+#else
+    .name = 0,
+    .print_specs = 0,
+#endif
+	.calc_cost = ailayer_dense_dynamic_calc_cost
+};
+const aicore_layertype_t *ailayer_dense_dynamic_type = &ailayer_dense_dynamic_type_s;
+
+ailayer_t *ailayer_dense_dynamic(ailayer_dense_dynamic_t *layer, ailayer_t *input_layer)
+{
+	ailayer_t *self = ailayer_dense(&layer->base, input_layer);
+
+	self->layer_type = ailayer_dense_dynamic_type;
+
+	// Transposed weights
+	layer->base.weights.shape[0] = layer->base.neurons;
+	layer->base.weights.shape[1] = input_layer->result.shape[1];
+	layer->base.weights.tensor_params = 0;
+
+	self->forward = ailayer_dense_dynamic_forward;
+	self->backward = 0;
+	self->backward_sgd = 0;
+
+	self->sizeof_paramem = ailayer_dense_dynamic_sizeof_paramem;
+	self->set_paramem = ailayer_dense_dynamic_set_paramem;
+	self->sizeof_trainmem = 0;
+	self->set_trainmem = 0;
+
+	// Inference only
+	self->trainable_params_count = 0;
+
+	return self;
+}
+
+void ailayer_dense_dynamic_forward(ailayer_t *self)
+{
+	ailayer_dense_dynamic_t *layer = (ailayer_dense_dynamic_t *)(self->layer_configuration);
+	aitensor_t *input_tensor = &(self->input_layer->result);
+	aitensor_t *result_tensor = &(self->result);
+
+	uint8_t input_quantized_data[aimath_tensor_elements(input_tensor) * aimath_sizeof_dtype(layer->input_quantized_dtype)];
+	uint32_t input_quantized_params[(layer->input_quantized_dtype->tensor_params_size + 3) / 4];
+	aitensor_t input_quantized = {
+		.dtype = layer->input_quantized_dtype,
+		.dim = 2,
+		.shape = input_tensor->shape,
+		.tensor_params = input_quantized_params,
+		.data = input_quantized_data
+	};
+
+	// x_q = quantize(x)
+	layer->quantize(input_tensor, &input_quantized);
+	// z = dequantize(x_q * W_q^T) + b
+	layer->linear_dequantize(&input_quantized, &(layer->base.weights), layer->weights_scales, &(layer->base.bias), result_tensor);
+
+	return;
+}
+
+uint32_t ailayer_dense_dynamic_sizeof_paramem(const ailayer_t *self)
+{
+	uint32_t memory = 0;
+	ailayer_dense_dynamic_t *layer = (ailayer_dense_dynamic_t *)(self->layer_configuration);
+
+	// Bias
+	memory += layer->base.bias_dtype->tensor_params_size;
+	memory += layer->base.neurons * aimath_sizeof_dtype(layer->base.bias_dtype); // data
+
+	// Weights scales
+	memory += layer->base.neurons * sizeof(float);
+
+	// Quantized weights (at the end for the alignment of the other values)
+	memory += self->input_layer->result.shape[1] * layer->base.neurons * aimath_sizeof_dtype(layer->base.weights_dtype);
+	return memory;
+}
+
+void ailayer_dense_dynamic_set_paramem(ailayer_t *self, void *memory_ptr)
+{
+	uint32_t address_counter = 0;
+	ailayer_dense_dynamic_t *layer = (ailayer_dense_dynamic_t *)(self->layer_configuration);
+
+	layer->base.bias.tensor_params = memory_ptr + address_counter;
+	address_counter += layer->base.bias_dtype->tensor_params_size;
+	layer->base.bias.dim = 2;
+	layer->base.bias.dtype = layer->base.bias_dtype;
+	layer->base.bias.shape = layer->base.bias_shape;
+	layer->base.bias.shape[0] = 1;
+	layer->base.bias.shape[1] = layer->base.neurons;
+	layer->base.bias.data = memory_ptr + address_counter;
+	address_counter += aimath_sizeof_tensor_data(&(layer->base.bias));
+
+	layer->weights_scales = memory_ptr + address_counter;
+	address_counter += layer->base.neurons * sizeof(float);
+
+	layer->base.weights.tensor_params = 0;
+	layer->base.weights.dim = 2;
+	layer->base.weights.dtype = layer->base.weights_dtype;
+	layer->base.weights.shape = layer->base.weights_shape;
+	layer->base.weights.shape[0] = layer->base.neurons;
+	layer->base.weights.shape[1] = self->input_layer->result.shape[1];
+	layer->base.weights.data = memory_ptr + address_counter;
+
+	return;
+}
+
+void ailayer_dense_dynamic_quantize_weights(ailayer_dense_dynamic_t *layer, const aitensor_t *weights, const aitensor_t *bias)
+{
+	layer->quantize_channels_transposed(weights, &(layer->base.weights), layer->weights_scales);
+	memcpy(layer->base.bias.data, bias->data, aimath_sizeof_tensor_data(&(layer->base.bias)));
+	return;
+}
+
+void ailayer_dense_dynamic_calc_cost(const ailayer_t *self, aicore_layercost_t *cost)
+{
+	ailayer_dense_dynamic_t *layer = (ailayer_dense_dynamic_t *)(self->layer_configuration);
+	uint32_t batch = self->input_layer->result.shape[0];
+	uint32_t inputs = self->input_layer->result.shape[1];
+	uint32_t neurons = layer->base.neurons;
+	uint32_t weights_bytes = inputs * neurons * aimath_sizeof_dtype(layer->base.weights_dtype);
+	uint32_t bias_bytes = neurons * aimath_sizeof_dtype(layer->base.bias_dtype);
+	uint32_t scales_bytes = neurons * sizeof(float);
+
+	// Input quantization (range search, scaling and rounding), integer multiply-accumulate and dequantization with bias
+	cost->ops = 4 * batch * inputs + 2 * batch * inputs * neurons + 3 * batch * neurons;
+	cost->special_ops = 1;
+	cost->bytes_read = 2 * aimath_sizeof_tensor_data(&(self->input_layer->result)) + batch * inputs * aimath_sizeof_dtype(layer->input_quantized_dtype)
+					   + weights_bytes + bias_bytes + scales_bytes;
+	cost->bytes_written = batch * inputs * aimath_sizeof_dtype(layer->input_quantized_dtype) + aimath_sizeof_tensor_data(&(self->result));
+	cost->parameter_bytes = weights_bytes + bias_bytes + scales_bytes;
+	cost->activation_bytes = aimath_sizeof_tensor_data(&(self->result));
+	return;
+}
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+void ailayer_dense_dynamic_print_specs(const ailayer_t *self, int (*print)(const char *format, ...))
+{
+    ailayer_dense_dynamic_t *layer = (ailayer_dense_dynamic_t *)(self->layer_configuration);
+
+    print("neurons: %ld; weights: %s", (long unsigned int) layer->base.neurons, layer->base.weights_dtype->name);
+}
+#endif
@@ -0,0 +1,204 @@
+/**
+ * \file basic/base/ailayer/ailayer_dense_dynamic.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Base \link ailayer layer \endlink implementation of the Dense layer with dynamic quantization
+ *
+ * This is an "abstract" data-type independent implementation. To use the layer use one of the provided
+ * implementations for a specific hardware and data-type (for example from ailayer_dense_dynamic_default.h) or set
+ * the required math functions on your own.
+ *
+ * The layer calculates the same function as the \link ailayer_dense.h Dense layer \endlink
+ * @f[
+ *  y = x \cdot W + b
+ * @f]
+ * but stores the weights as quantized integers with one scale per neuron (per output channel). The inputs and
+ * results are \link aimath_f32.h F32 \endlink values, so the layer can replace a Dense layer in a F32 model without
+ * any calibration data.
+ *
+ * In every forward pass the inputs are quantized with the range of the current input values (dynamic quantization),
+ * the weighted sums are calculated with integer arithmetic and the results are converted back to F32 with the scales.
+ *
+ * The weights are stored transposed (\f$ W^T \in \mathbb{Z}^{M \times K} \f$) to read consecutive memory in the
+ * dot products. Use ailayer_dense_dynamic_quantize_weights() to convert the weights of a trained F32 Dense layer.
+ *
+ * The layer only supports inference (no backward pass).
+ */
+
+#ifndef AILAYER_DENSE_DYNAMIC
+#define AILAYER_DENSE_DYNAMIC
+
+#include "core/aifes_core.h"
+#include "basic/base/ailayer/ailayer_dense.h"
+
+typedef struct ailayer_dense_dynamic 	ailayer_dense_dynamic_t;
+
+/** @brief General \link ailayer_dense_dynamic.h Dense layer with dynamic quantization \endlink structure
+*
+*/
+struct ailayer_dense_dynamic {
+	ailayer_dense_t base; /**< Inherited field members from the ailayer_dense struct (weights_dtype is the quantized type). */
+
+	/** @name Trainable parameters
+	 * @brief Additional data fields for the quantized parameters
+	 */
+	///@{
+	float *weights_scales; /**< Scales of the quantized weights of every neuron (neurons elements). */
+	///@}
+
+	const aimath_dtype_t *input_quantized_dtype; /**< Data type of the quantized inputs. */
+
+    /** @name Math functions
+	 * @brief Required data type specific math functions
+	 */
+	///@{
+
+	/** @brief Required math function: Quantization of a F32 tensor with parameters from the value range
+	 *
+	 * @param x         F32 tensor (input)
+	 * @param result    Quantized tensor with the same shape, the quantization parameters are set (output)
+	 */
+	void (*quantize)(const aitensor_t *x, aitensor_t *result);
+
+	/** @brief Required math function: Linear transformation with per channel quantized weights and F32 result
+	 *
+     * @f[
+     *  result_{ij} = scale_a \cdot scale_{b,j} \cdot \sum_k (a_{ik} - zero\_point_a) \cdot b_{jk} + c_j
+     * @f]
+     *
+     * @param a         Quantized matrix with dimension \f$ N \times K \f$ (input)
+     * @param b         Transposed quantized matrix with dimension \f$ M \times K \f$ (input)
+     * @param b_scales  Scales of the rows of b (M elements)
+     * @param c         F32 laying vektor with dimension \f$ 1 \times M \f$ (input)
+     * @param result    F32 matrix with dimension \f$ N \times M \f$ (output)
+	 */
+	void (*linear_dequantize)(const aitensor_t *a, const aitensor_t *b, const float *b_scales, const aitensor_t *c, aitensor_t *result);
+
+	/** @brief Required math function: Per channel quantization and transposition of a F32 weight matrix
+	 *
+	 * Only required for ailayer_dense_dynamic_quantize_weights().
+	 *
+     * @param w         F32 matrix with dimension \f$ K \times M \f$ (input)
+     * @param result    Quantized matrix with dimension \f$ M \times K \f$ (output)
+     * @param scales    Scales of the columns of w (M elements, output)
+	 */
+	void (*quantize_channels_transposed)(const aitensor_t *w, aitensor_t *result, float *scales);
+
+	///@}
+};
+
+/** @brief Dense layer with dynamic quantization type
+ *
+ * Defines the type of the layer (for example for type checks and debug prints).
+ * See aicore_layertype for more information about the layer type.
+ */
+extern const aicore_layertype_t *ailayer_dense_dynamic_type;
+
+/** @brief Initialize and connect the given Dense layer with dynamic quantization
+ *
+ * This function represents the "constructor" of the abstract layer. It initializes the layer structure
+ * and connects it to the previous layer.\n
+ * This function is not intended to call it directly. Instead use one of the data type specific implementations
+ * (like for example ailayer_dense_dynamic_q7_default()).
+ *
+ * @param *layer        The layer to initialize.
+ * @param *input_layer  The previous layer that provides the inputs to the layer.
+ * @return  Pointer to the (successfully) initialized general layer structure (ailayer_dense.base)
+ */
+ailayer_t *ailayer_dense_dynamic(ailayer_dense_dynamic_t *layer, ailayer_t *input_layer);
+
+/** @brief Calculate the forward pass for given Dense layer with dynamic quantization
+ *
+ * *Implementation of ailayer.forward.*
+ *
+ * The inputs are quantized to a temporary tensor on the stack (inputs count bytes for Q7), multiplied with the
+ * quantized weights and converted to F32 with the bias added.
+ *
+ * Used math functions:
+ * * ailayer_dense_dynamic.quantize
+ * * ailayer_dense_dynamic.linear_dequantize
+ *
+ * @param *self Layer to calculate the forward path for.
+ */
+void ailayer_dense_dynamic_forward(ailayer_t *self);
+
+/** @brief Calculate and return the parameter memory size needed for this layer
+ *
+ * *Implementation of ailayer.sizeof_paramem.*
+ *
+ * The parameter size is calculated for the bias, the weights scales and the quantized weights.
+ *
+ * @param *self The layer to calculate the parameter memory size for
+ * @return  Calculated parameter memory size in bytes.
+ */
+uint32_t ailayer_dense_dynamic_sizeof_paramem(const ailayer_t *self);
+
+/** @brief Distribute provided memory to the parameter pointers
+ *
+ * *Implementation of ailayer.set_paramem.*
+ *
+ * The required parameter size can be calculated with ailayer_dense_dynamic_sizeof_paramem()
+ *
+ * @param *self         The layer to set the memory fields for.
+ * @param *memory_ptr   The memory that can be used for the parameters
+ */
+void ailayer_dense_dynamic_set_paramem(ailayer_t *self, void *memory_ptr);
+
+/** @brief Quantize the parameters of a trained F32 Dense layer into this layer
+ *
+ * The parameter memory of the layer has to be set before (for example with aialgo_distribute_parameter_memory()).
+ *
+ * Example:
+ * \code{.c}
+ * ailayer_dense_dynamic_quantize_weights(&dense_dynamic_layer, &dense_f32_layer.weights, &dense_f32_layer.bias);
+ * \endcode
+ *
+ * Used math functions:
+ * * ailayer_dense_dynamic.quantize_channels_transposed
+ *
+ * @param *layer    The layer to set the parameters for
+ * @param *weights  F32 weights of shape [inputs x neurons]
+ * @param *bias     F32 bias of shape [1 x neurons]
+ */
+void ailayer_dense_dynamic_quantize_weights(ailayer_dense_dynamic_t *layer, const aitensor_t *weights, const aitensor_t *bias);
+
+/** @brief Calculate the static cost of a forward pass of the Dense layer with dynamic quantization
+ *
+ * *Implementation of aicore_layertype.calc_cost.*
+ *
+ * Like ailayer_dense_calc_cost() plus the quantization of the inputs (range search and conversion) and the
+ * conversion of the results. The integer multiply-accumulate operations are counted as basic operations.
+ *
+ * @param *self The layer to calculate the cost for (the result shape has to be calculated before)
+ * @param *cost The calculated cost is written here
+ */
+void ailayer_dense_dynamic_calc_cost(const ailayer_t *self, aicore_layercost_t *cost);
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+/** @brief Print the layer specification
+ *
+ * @param *self     The layer to print the specification for
+ * @param *print    Pointer to the print function to use
+ */
+void ailayer_dense_dynamic_print_specs(const ailayer_t *self, int (*print)(const char *format, ...));
+#endif // AIDEBUG_PRINT_MODULE_SPECS
+
+#endif // AILAYER_DENSE_DYNAMIC
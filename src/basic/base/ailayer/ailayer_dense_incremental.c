@@ -0,0 +1,170 @@
+/**
+ * \file basic/base/ailayer/ailayer_dense_incremental.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See ailayer_dense_incremental.h for documentation.
+ * \details
+ */
+
+#include "basic/base/ailayer/ailayer_dense_incremental.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+const aicore_layertype_t ailayer_dense_incremental_type_s = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = "Dense (incremental)",
+	.print_specs = ailayer_dense_incremental_print_specs,
+#else
+    .name = 0,
+    .print_specs = 0,
+#endif
+	.calc_cost = ailayer_dense_incremental_calc_cost
+};
+const aicore_layertype_t *ailayer_dense_incremental_type = &ailayer_dense_incremental_type_s;
+
+ailayer_t *ailayer_dense_incremental(ailayer_dense_incremental_t *layer, ailayer_t *input_layer)
+{
+	ailayer_t *self = ailayer_dense(&layer->base, input_layer);
+
+	self->layer_type = ailayer_dense_incremental_type;
+
+	layer->cached_input.dtype = input_layer->result.dtype;
+	layer->cached_input.dim = 2;
+	layer->cached_input.shape = input_layer->result.shape;
+	layer->cached_input.tensor_params = 0;
+	layer->cached_input.data = 0;
+
+	layer->cached_result.dtype = layer->base.result_dtype;
+	layer->cached_result.dim = 2;
+	layer->cached_result.shape = layer->cached_result_shape;
+	layer->cached_result.tensor_params = 0;
+	layer->cached_result.data = 0;
+
+	layer->cache_valid = FALSE;
+	layer->incremental_count = 0;
+	layer->changed_inputs = 0;
+
+	self->forward = ailayer_dense_incremental_forward;
+	self->backward = 0;
+	self->backward_sgd = 0;
+
+	self->sizeof_paramem = ailayer_dense_incremental_sizeof_paramem;
+	self->set_paramem = ailayer_dense_incremental_set_paramem;
+	self->sizeof_trainmem = 0;
+	self->set_trainmem = 0;
+
+	// Inference only
+	self->trainable_params_count = 0;
+
+	return self;
+}
+
+void ailayer_dense_incremental_forward(ailayer_t *self)
+{
+	ailayer_dense_incremental_t *layer = (ailayer_dense_incremental_t *)(self->layer_configuration);
+	aitensor_t *input_tensor = &(self->input_layer->result);
+	aitensor_t *result_tensor = &(self->result);
+	uint32_t max_changes = layer->max_changed_inputs != 0 ? layer->max_changed_inputs : aimath_tensor_elements(input_tensor);
+
+	if(layer->cache_valid && (layer->refresh_interval == 0 || layer->incremental_count < layer->refresh_interval))
+	{
+		// z += (x - x_prev) * W for the changed inputs
+		layer->changed_inputs = layer->linear_incremental(input_tensor, &(layer->cached_input), &(layer->base.weights), &(layer->cached_result), max_changes);
+		if(layer->changed_inputs <= max_changes)
+		{
+			layer->incremental_count++;
+			layer->copy_tensor(&(layer->cached_result), result_tensor);
+			return;
+		}
+	}
+
+	// Full calculation: z = x * W + b
+	layer->base.linear(input_tensor, &(layer->base.weights), &(layer->base.bias), &(layer->cached_result));
+	layer->copy_tensor(input_tensor, &(layer->cached_input));
+	layer->copy_tensor(&(layer->cached_result), result_tensor);
+
+	layer->cache_valid = TRUE;
+	layer->incremental_count = 0;
+	layer->changed_inputs = aimath_tensor_elements(input_tensor);
+	return;
+}
+
+void ailayer_dense_incremental_reset(ailayer_dense_incremental_t *layer)
+{
+	layer->cache_valid = FALSE;
+	layer->incremental_count = 0;
+	return;
+}
+
+uint32_t ailayer_dense_incremental_sizeof_paramem(const ailayer_t *self)
+{
+	uint32_t memory = 0;
+	ailayer_dense_incremental_t *layer = (ailayer_dense_incremental_t *)(self->layer_configuration);
+
+	// Weights and bias
+	memory += ailayer_dense_sizeof_paramem(self);
+
+	// Cached input and result
+	memory += aimath_sizeof_tensor_data(&(self->input_layer->result));
+	memory += self->input_layer->result.shape[0] * layer->base.neurons * aimath_sizeof_dtype(layer->base.result_dtype);
+	return memory;
+}
+
+void ailayer_dense_incremental_set_paramem(ailayer_t *self, void *memory_ptr)
+{
+	uint32_t address_counter = 0;
+	ailayer_dense_incremental_t *layer = (ailayer_dense_incremental_t *)(self->layer_configuration);
+
+	ailayer_dense_set_paramem(self, memory_ptr);
+	address_counter += ailayer_dense_sizeof_paramem(self);
+
+	layer->cached_result.shape[0] = self->input_layer->result.shape[0];
+	layer->cached_result.shape[1] = layer->base.neurons;
+	layer->cached_result.data = memory_ptr + address_counter;
+	address_counter += aimath_sizeof_tensor_data(&(layer->cached_result));
+
+	layer->cached_input.data = memory_ptr + address_counter;
+
+	ailayer_dense_incremental_reset(layer);
+	return;
+}
+
+void ailayer_dense_incremental_calc_cost(const ailayer_t *self, aicore_layercost_t *cost)
+{
+	uint32_t input_bytes = aimath_sizeof_tensor_data(&(self->input_layer->result));
+	uint32_t result_bytes = aimath_sizeof_tensor_data(&(self->result));
+
+	ailayer_dense_calc_cost(self, cost);
+
+	// Comparison with the cached input and copies of the input and the result
+	cost->ops += aimath_tensor_elements(&(self->input_layer->result));
+	cost->bytes_read += 2 * input_bytes + result_bytes;
+	cost->bytes_written += input_bytes + 2 * result_bytes;
+	cost->parameter_bytes += input_bytes + result_bytes;
+	return;
+}
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+void ailayer_dense_incremental_print_specs(const ailayer_t *self, int (*print)(const char *format, ...))
+{
+    ailayer_dense_incremental_t *layer = (ailayer_dense_incremental_t *)(self->layer_configuration);
+
+    print("neurons: %ld; refresh interval: %d; max changed inputs: %d", (long unsigned int) layer->base.neurons,
+		  layer->refresh_interval, layer->max_changed_inputs);
+}
+#endif
@@ -0,0 +1,208 @@
+/**
+ * \file basic/base/ailayer/ailayer_dense_incremental.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Base \link ailayer layer \endlink implementation of the Dense layer with incremental inference
+ *
+ * This is an "abstract" data-type independent implementation. To use the layer use one of the provided
+ * implementations for a specific hardware and data-type (for example from ailayer_dense_incremental_default.h) or set
+ * the required math functions on your own.
+ *
+ * The layer calculates the same function as the \link ailayer_dense.h Dense layer \endlink
+ * @f[
+ *  y = x \cdot W + b
+ * @f]
+ * but caches the last input and result. If only a few inputs change between two forward passes (for example
+ * a feature vector of slowly changing sensor values), only the changed inputs are applied to the cached result
+ * (rank-k update):
+ * @f[
+ *  y \leftarrow y + (x_i - x\_prev_i) \cdot W_{i,:} \quad \forall \; x_i \neq x\_prev_i
+ * @f]
+ * So the cost of the forward pass is proportional to the number of changed inputs instead of the number of inputs.
+ *
+ * The full product is calculated on the first forward pass, after ailayer_dense_incremental_reset(), if more than
+ * ailayer_dense_incremental.max_changed_inputs inputs have changed and every ailayer_dense_incremental.refresh_interval
+ * forward passes to bound the accumulated rounding errors.
+ *
+ * The cache is stored in the parameter memory (behind the weights and the bias), so the layer state is kept between
+ * the inference calls. The layer is best used as the first layer of a model with one sample per inference call.
+ * The layer only supports inference (no backward pass). The weights can be trained with a normal
+ * \link ailayer_dense.h Dense layer \endlink and copied to this layer.
+ */
+
+#ifndef AILAYER_DENSE_INCREMENTAL
+#define AILAYER_DENSE_INCREMENTAL
+
+#include "core/aifes_core.h"
+#include "basic/base/ailayer/ailayer_dense.h"
+
+typedef struct ailayer_dense_incremental 	ailayer_dense_incremental_t;
+
+/** @brief General \link ailayer_dense_incremental.h Dense layer with incremental inference \endlink structure
+*
+*/
+struct ailayer_dense_incremental {
+	ailayer_dense_t base; /**< Inherited field members from the ailayer_dense struct. */
+
+	/** @name Layer configuration
+	 * @brief Configuration parameters for the layer
+	 *
+	 * These fields have to be configured by the user before calling the initializer function.
+	 */
+	///@{
+	uint16_t refresh_interval; /**< Number of incremental forward passes until the next full calculation (0 for no periodic refresh). */
+	uint16_t max_changed_inputs; /**< Maximum number of changed inputs for an incremental update (0 for no limit). */
+	///@}
+
+	/** @name Layer state
+	 * @brief Cache and statistics of the incremental inference
+	 */
+	///@{
+	aitensor_t cached_input; /**< Input of the last forward pass. */
+	aitensor_t cached_result; /**< Result of the last forward pass (without rounding of the result data type). */
+	uint16_t cached_result_shape[2]; /**< Shape of the cached result. */
+	uint8_t cache_valid; /**< TRUE if the cache contains the values of a former full calculation. */
+	uint16_t incremental_count; /**< Number of incremental forward passes since the last full calculation. */
+	uint32_t changed_inputs; /**< Number of changed inputs in the last forward pass (all inputs for a full calculation). */
+	///@}
+
+    /** @name Math functions
+	 * @brief Required data type specific math functions
+	 */
+	///@{
+
+	/** @brief Required math function: Rank-k update of a linear transformation
+	 *
+	 * Requires a math function that updates the result of a matrix multiplication for the changed elements of a
+	 * and sets a_prev to a (if not more than max_changes elements have changed):\n
+     * @f[
+     *  result_{i,:} \leftarrow result_{i,:} + (a_{ik} - a\_prev_{ik}) \cdot b_{k,:}
+     * @f]
+     *
+     * @param a             Matrix with the new values \f$ N \times K \f$ (input)
+     * @param a_prev        Matrix with the previous values \f$ N \times K \f$ (input and output)
+     * @param b             Matrix with dimension \f$ K \times M \f$ (input)
+     * @param result        Matrix with dimension \f$ N \times M \f$ (input and output)
+     * @param max_changes   Maximum number of changed elements for the update
+     * @return              Number of changed elements
+	 */
+	uint32_t (*linear_incremental)(const aitensor_t *a, aitensor_t *a_prev, const aitensor_t *b, aitensor_t *result, uint32_t max_changes);
+
+	/** @brief Required math function: Copy of a tensor
+	 *
+	 * Requires a math function that copies the data of a tensor to another tensor with the same shape.
+	 */
+	void (*copy_tensor)(const aitensor_t *from, aitensor_t *to);
+
+	///@}
+};
+
+/** @brief Dense layer with incremental inference type
+ *
+ * Defines the type of the layer (for example for type checks and debug prints).
+ * See aicore_layertype for more information about the layer type.
+ */
+extern const aicore_layertype_t *ailayer_dense_incremental_type;
+
+/** @brief Initialize and connect the given Dense layer with incremental inference
+ *
+ * This function represents the "constructor" of the abstract layer. It initializes the layer structure
+ * and connects it to the previous layer.\n
+ * This function is not intended to call it directly. Instead use one of the data type specific implementations
+ * (like for example ailayer_dense_incremental_f32_default()).
+ *
+ * @param *layer        The layer to initialize.
+ * @param *input_layer  The previous layer that provides the inputs to the layer.
+ * @return  Pointer to the (successfully) initialized general layer structure (ailayer_dense.base)
+ */
+ailayer_t *ailayer_dense_incremental(ailayer_dense_incremental_t *layer, ailayer_t *input_layer);
+
+/** @brief Calculate the forward pass for given Dense layer with incremental inference
+ *
+ * *Implementation of ailayer.forward.*
+ *
+ * Applies the changed inputs to the cached result or calculates the full linear transformation
+ * (see ailayer_dense_incremental.h for the conditions).
+ *
+ * Used math functions:
+ * * ailayer_dense.linear
+ * * ailayer_dense_incremental.linear_incremental
+ * * ailayer_dense_incremental.copy_tensor
+ *
+ * @param *self Layer to calculate the forward path for.
+ */
+void ailayer_dense_incremental_forward(ailayer_t *self);
+
+/** @brief Invalidate the cache of the layer
+ *
+ * The next forward pass calculates the full linear transformation. Call this function after the weights or
+ * the bias have been changed.
+ *
+ * @param *layer The layer to reset
+ */
+void ailayer_dense_incremental_reset(ailayer_dense_incremental_t *layer);
+
+/** @brief Calculate and return the parameter memory size needed for this layer
+ *
+ * *Implementation of ailayer.sizeof_paramem.*
+ *
+ * The parameter size is calculated for the weights, the bias and the cached input and result.
+ *
+ * @param *self The layer to calculate the parameter memory size for
+ * @return  Calculated parameter memory size in bytes.
+ */
+uint32_t ailayer_dense_incremental_sizeof_paramem(const ailayer_t *self);
+
+/** @brief Distribute provided memory to the parameter pointers
+ *
+ * *Implementation of ailayer.set_paramem.*
+ *
+ * The required parameter size can be calculated with ailayer_dense_incremental_sizeof_paramem().
+ * The cache is invalidated.
+ *
+ * @param *self         The layer to set the memory fields for.
+ * @param *memory_ptr   The memory that can be used for the parameters
+ */
+void ailayer_dense_incremental_set_paramem(ailayer_t *self, void *memory_ptr);
+
+/** @brief Calculate the static cost of a forward pass of the Dense layer with incremental inference
+ *
+ * *Implementation of aicore_layertype.calc_cost.*
+ *
+ * The cost of a full calculation (like ailayer_dense_calc_cost()) plus the comparison with the cached input and the
+ * copy of the cached result. This is the worst case, an incremental update with k changed inputs only needs
+ * \f$ 2 \cdot k \cdot neurons \f$ instead of \f$ 2 \cdot inputs \cdot neurons \f$ operations.
+ *
+ * @param *self The layer to calculate the cost for (the result shape has to be calculated before)
+ * @param *cost The calculated cost is written here
+ */
+void ailayer_dense_incremental_calc_cost(const ailayer_t *self, aicore_layercost_t *cost);
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+/** @brief Print the layer specification
+ *
+ * @param *self     The layer to print the specification for
+ * @param *print    Pointer to the print function to use
+ */
+void ailayer_dense_incremental_print_specs(const ailayer_t *self, int (*print)(const char *format, ...));
+#endif // AIDEBUG_PRINT_MODULE_SPECS
+
+#endif // AILAYER_DENSE_INCREMENTAL
@@ -0,0 +1,258 @@
+/**
+ * \file basic/base/ailayer/ailayer_dense_stacked.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See ailayer_dense_stacked.h for documentation.
+ * \details
+ */
+
+#include "basic/base/ailayer/ailayer_dense_stacked.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+#include <string.h>
+
+const aicore_layertype_t ailayer_dense_stacked_type_s = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = "Dense (stacked)",
+	.print_specs = ailayer_dense_stacked_print_specs,
+#else
+    .name = 0,
+    .print_specs = 0,
+#endif
+	.calc_cost = ailayer_dense_stacked_calc_cost
+};
+const aicore_layertype_t *ailayer_dense_stacked_type = &ailayer_dense_stacked_type_s;
+
+// Number of inputs of one model
+static uint16_t ailayer_dense_stacked_inputs(const ailayer_dense_stacked_t *layer, const ailayer_t *input_layer)
+{
+	return layer->shared_input ? input_layer->result.shape[1] : input_layer->result.shape[1] / layer->model_count;
+}
+
+ailayer_t *ailayer_dense_stacked(ailayer_dense_stacked_t *layer, ailayer_t *input_layer)
+{
+    layer->base.layer_type = ailayer_dense_stacked_type;
+
+	layer->base.input_layer = input_layer;
+	input_layer->output_layer = &(layer->base);
+
+	layer->base.layer_configuration = layer;
+	layer->base.result.dtype = layer->result_dtype;
+	layer->base.result.dim = 2;
+	layer->base.result.shape = layer->result_shape;
+	layer->base.result.shape[1] = layer->model_count * layer->neurons;
+
+	layer->base.deltas.dtype = layer->result_dtype;
+	layer->base.deltas.dim = 2;
+	layer->base.deltas.shape = input_layer->result.shape;
+
+	layer->weights.dim = 3;
+	layer->weights.dtype = layer->weights_dtype;
+	layer->weights.shape = layer->weights_shape;
+	layer->weights.shape[0] = layer->model_count;
+	layer->weights.shape[1] = ailayer_dense_stacked_inputs(layer, input_layer);
+	layer->weights.shape[2] = layer->neurons;
+
+	layer->bias.dim = 2;
+	layer->bias.dtype = layer->bias_dtype;
+	layer->bias.shape = layer->bias_shape;
+	layer->bias.shape[0] = layer->model_count;
+	layer->bias.shape[1] = layer->neurons;
+
+	layer->base.forward = ailayer_dense_stacked_forward;
+	layer->base.backward = ailayer_dense_stacked_backward;
+	layer->base.backward_sgd = 0;
+
+	layer->base.calc_result_shape = ailayer_dense_stacked_calc_result_shape;
+	layer->base.sizeof_paramem = ailayer_dense_stacked_sizeof_paramem;
+	layer->base.set_paramem = ailayer_dense_stacked_set_paramem;
+	layer->base.sizeof_trainmem = ailayer_dense_stacked_sizeof_trainmem;
+	layer->base.set_trainmem = ailayer_dense_stacked_set_trainmem;
+	layer->base.result_in_place = FALSE;
+
+	layer->base.get_result_bound = 0;
+
+	layer->base.trainable_params_count = 2;
+	layer->base.trainable_params = layer->trainable_params;
+	layer->base.gradients = layer->gradients;
+	layer->base.optimem = layer->optimem;
+
+	layer->trainable_params[0] = &layer->weights;
+	layer->trainable_params[1] = &layer->bias;
+
+	return &layer->base;
+}
+
+void ailayer_dense_stacked_forward(ailayer_t *self)
+{
+	ailayer_dense_stacked_t *layer = (ailayer_dense_stacked_t *)(self->layer_configuration);
+
+	// z_n = x_n * W_n + b_n for all models
+	layer->linear_stacked(&(self->input_layer->result), &(layer->weights), &(layer->bias), &(self->result));
+
+	return;
+}
+
+void ailayer_dense_stacked_backward(ailayer_t *self)
+{
+	ailayer_dense_stacked_t *layer = (ailayer_dense_stacked_t *)(self->layer_configuration);
+
+	// d_weights_n += x_n^T * delta_out_n; d_bias_n += delta_out_n; delta_in_n = delta_out_n * W_n^T
+	layer->linear_stacked_backward(&(self->input_layer->result), &(self->output_layer->deltas), &(layer->weights),
+								   layer->gradients[0], layer->gradients[1], &(self->deltas));
+
+	return;
+}
+
+void ailayer_dense_stacked_calc_result_shape(ailayer_t *self)
+{
+	ailayer_dense_stacked_t *layer = (ailayer_dense_stacked_t *)(self->layer_configuration);
+
+	self->result.shape[0] = self->input_layer->result.shape[0];
+	self->result.shape[1] = layer->model_count * layer->neurons;
+
+	return;
+}
+
+uint32_t ailayer_dense_stacked_sizeof_paramem(const ailayer_t *self)
+{
+	uint32_t memory = 0;
+	ailayer_dense_stacked_t *layer = (ailayer_dense_stacked_t *)(self->layer_configuration);
+
+	// Weights
+	memory += layer->weights_dtype->tensor_params_size;
+	memory += layer->model_count * ailayer_dense_stacked_inputs(layer, self->input_layer) * layer->neurons * aimath_sizeof_dtype(layer->weights_dtype); // data
+
+	// Bias
+	memory += layer->bias_dtype->tensor_params_size;
+	memory += layer->model_count * layer->neurons * aimath_sizeof_dtype(layer->bias_dtype); // data
+	return memory;
+}
+
+void ailayer_dense_stacked_set_paramem(ailayer_t *self, void *memory_ptr)
+{
+	uint32_t address_counter = 0;
+	ailayer_dense_stacked_t *layer = (ailayer_dense_stacked_t *) (self->layer_configuration);
+
+	layer->weights.tensor_params = memory_ptr + address_counter;
+	address_counter += layer->weights_dtype->tensor_params_size;
+	layer->weights.dim = 3;
+	layer->weights.dtype = layer->weights_dtype;
+	layer->weights.shape = layer->weights_shape;
+	layer->weights.shape[0] = layer->model_count;
+	layer->weights.shape[1] = ailayer_dense_stacked_inputs(layer, self->input_layer);
+	layer->weights.shape[2] = layer->neurons;
+	layer->weights.data = memory_ptr + address_counter;
+	address_counter += aimath_sizeof_tensor_data(&(layer->weights));
+
+	layer->bias.tensor_params = memory_ptr + address_counter;
+	address_counter += layer->bias_dtype->tensor_params_size;
+	layer->bias.dim = 2;
+	layer->bias.dtype = layer->bias_dtype;
+	layer->bias.shape = layer->bias_shape;
+	layer->bias.shape[0] = layer->model_count;
+	layer->bias.shape[1] = layer->neurons;
+	layer->bias.data = memory_ptr + address_counter;
+
+	layer->trainable_params[0] = &(layer->weights);
+	layer->trainable_params[1] = &(layer->bias);
+
+	return;
+}
+
+uint32_t ailayer_dense_stacked_sizeof_trainmem(const ailayer_t *self)
+{
+	uint32_t memory = 0;
+	ailayer_dense_stacked_t *layer = (ailayer_dense_stacked_t *)(self->layer_configuration);
+
+	memory += aimath_sizeof_tensor(&layer->weights);
+	memory += aimath_sizeof_tensor(&layer->bias);
+	return memory;
+}
+
+void ailayer_dense_stacked_set_trainmem(ailayer_t *self, void *memory_ptr)
+{
+	uint32_t address_counter = 0;
+	ailayer_dense_stacked_t *layer = (ailayer_dense_stacked_t *) (self->layer_configuration);
+
+	// Weights gradients in gradients[0]
+	self->gradients[0] = memory_ptr;
+	address_counter += sizeof(aitensor_t);
+	self->gradients[0]->data = memory_ptr + address_counter;
+	self->gradients[0]->dtype = layer->weights.dtype;
+	self->gradients[0]->dim = 3;
+	self->gradients[0]->shape = layer->weights.shape;
+	address_counter += aimath_sizeof_tensor_data(layer->gradients[0]);
+	self->gradients[0]->tensor_params = memory_ptr + address_counter;
+	address_counter += aimath_sizeof_tensor_params(layer->gradients[0]);
+	address_counter = AIMATH_ALIGN_SIZE(address_counter);
+
+	// Bias gradients in gradients[1]
+	self->gradients[1] = memory_ptr + address_counter;
+	address_counter += sizeof(aitensor_t);
+	self->gradients[1]->data = memory_ptr + address_counter;
+	self->gradients[1]->dtype = layer->bias.dtype;
+	self->gradients[1]->dim = 2;
+	self->gradients[1]->shape = layer->bias.shape;
+	address_counter += aimath_sizeof_tensor_data(layer->gradients[1]);
+	self->gradients[1]->tensor_params = memory_ptr + address_counter;
+	address_counter += aimath_sizeof_tensor_params(layer->gradients[1]);
+	address_counter = AIMATH_ALIGN_SIZE(address_counter);
+
+	return;
+}
+
+void ailayer_dense_stacked_export_model(const ailayer_dense_stacked_t *layer, uint16_t model_index, ailayer_dense_t *dense)
+{
+	uint32_t weights_size = aimath_sizeof_tensor_data(&(layer->weights)) / layer->model_count;
+	uint32_t bias_size = aimath_sizeof_tensor_data(&(layer->bias)) / layer->model_count;
+
+	memcpy(dense->weights.data, layer->weights.data + model_index * weights_size, weights_size);
+	memcpy(dense->bias.data, layer->bias.data + model_index * bias_size, bias_size);
+	return;
+}
+
+void ailayer_dense_stacked_calc_cost(const ailayer_t *self, aicore_layercost_t *cost)
+{
+	ailayer_dense_stacked_t *layer = (ailayer_dense_stacked_t *)(self->layer_configuration);
+	uint32_t batch = self->input_layer->result.shape[0];
+	uint32_t inputs = ailayer_dense_stacked_inputs(layer, self->input_layer);
+	uint32_t outputs = layer->model_count * layer->neurons;
+	uint32_t weights_bytes = inputs * outputs * aimath_sizeof_dtype(layer->weights_dtype);
+	uint32_t bias_bytes = outputs * aimath_sizeof_dtype(layer->bias_dtype);
+
+	// Like the Dense layer for every model
+	cost->ops = 2 * batch * inputs * outputs + batch * outputs;
+	cost->special_ops = 0;
+	cost->bytes_read = aimath_sizeof_tensor_data(&(self->input_layer->result)) + weights_bytes + bias_bytes;
+	cost->bytes_written = aimath_sizeof_tensor_data(&(self->result));
+	cost->parameter_bytes = weights_bytes + bias_bytes;
+	cost->activation_bytes = aimath_sizeof_tensor_data(&(self->result));
+	return;
+}
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+void ailayer_dense_stacked_print_specs(const ailayer_t *self, int (*print)(const char *format, ...))
+{
+    ailayer_dense_stacked_t *layer = (ailayer_dense_stacked_t *)(self->layer_configuration);
+
+    print("models: %ld; neurons: %ld; shared input: %d", (long unsigned int) layer->model_count,
+		  (long unsigned int) layer->neurons, layer->shared_input);
+}
+#endif
@@ -0,0 +1,253 @@
+/**
+ * \file basic/base/ailayer/ailayer_dense_stacked.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Base \link ailayer layer \endlink implementation of N stacked Dense layers (model-batched training)
+ *
+ * This is an "abstract" data-type independent implementation. To use the layer use one of the provided
+ * implementations for a specific hardware and data-type (for example from ailayer_dense_stacked_default.h) or set
+ * the required math functions on your own.
+ *
+ * For ensembles and hyperparameter sweeps many small models with the same structure are trained. Every single
+ * \link ailayer_dense.h Dense layer \endlink is so small that the runtime is dominated by the overhead of the
+ * function calls per layer, per sample and per model. The stacked Dense layer holds the parameters of
+ * N models in one tensor and calculates
+ * @f[
+ *  y_n = x_n \cdot W_n + b_n \quad \text{for } n = 1 \dots N
+ * @f]
+ * for all models with one call of the math function. The results of the models are concatenated,
+ * \f$ y = (y_1, \dots, y_N) \in \mathbb{R}^{1 \times N \cdot M} \f$.
+ *
+ * The weights tensor has the shape [N x K x M] and the bias tensor the shape [N x M], so the optimizer updates
+ * the parameters of all models with one call per tensor. Element wise activation layers (like ReLU, Sigmoid or Tanh)
+ * and the \link ailoss_mse.h MSE loss \endlink can be used without changes on the concatenated results; the targets
+ * have to be repeated for every model (shape [B x N*M]). Layers that mix the values of a row (like Softmax) are not
+ * suitable, because they would mix the models.
+ *
+ * The first stacked layer of a model can read the same inputs for all models (shared_input = TRUE), the following
+ * layers read the concatenated results of the previous stacked layer. Because the models are independent, the
+ * gradients of every model are equal to the gradients of a single model trained on its own. Use
+ * ailayer_dense_stacked_export_model() to copy the parameters of one model (for example the best one of a sweep)
+ * into a normal Dense layer.
+ */
+
+#ifndef AILAYER_DENSE_STACKED
+#define AILAYER_DENSE_STACKED
+
+#include "core/aifes_core.h"
+#include "basic/base/ailayer/ailayer_dense.h"
+
+typedef struct ailayer_dense_stacked 	ailayer_dense_stacked_t;
+
+/** @brief General \link ailayer_dense_stacked.h stacked Dense layer \endlink structure
+*
+*/
+struct ailayer_dense_stacked {
+	ailayer_t base; /**< Inherited field members from general ailayer struct. */
+	const aimath_dtype_t *result_dtype; /**< Data type of the inference result values. */
+
+    /** @name Layer configuration
+	 * @brief Required configuration parameters for the layer
+	 *
+	 * These fields have to be configured by the user before calling the initializer function.
+	 */
+	///@{
+	uint32_t neurons; /**< Neurons count of every model (number of outputs per model). */
+	uint16_t model_count; /**< Number of stacked models N. */
+	uint8_t shared_input; /**< TRUE if all models read the same inputs (first layer), FALSE for concatenated inputs. */
+	///@}
+
+	/** @name Trainable parameters
+	 * @brief Data fields for the trainable parameters (weights, bias) of the layer
+	 */
+	///@{
+	aitensor_t weights; /**< Tensor containing the weights of all models (shape [N x K x M]). */
+	aitensor_t bias; /**< Tensor containing the bias weights of all models (shape [N x M]). */
+
+	const aimath_dtype_t *weights_dtype; /**< Data type of the weights. */
+	const aimath_dtype_t *bias_dtype; /**< Data type of the bias weights. */
+
+	uint16_t weights_shape[3]; /**< Weights tensor shape. */
+	uint16_t bias_shape[2]; /**< Bias weights tensor shape. */
+
+	aitensor_t *trainable_params[2]; /**< Pointer to the weights and biases (which are the trainable parameters). */
+	aitensor_t *gradients[2]; /**< Gradients structure for the back propagation algorithm. */
+	void *optimem[2]; /**< Memory field used by the trainings optimizer. */
+	///@}
+
+    /** @name Math functions
+	 * @brief Required data type specific math functions
+	 */
+	///@{
+
+	/** @brief Required math function: Stacked linear transformation
+	 *
+	 * Requires a math function that performs the linear transformations of all models:\n
+     * @f[
+     *  result_n = a_n \cdot b_n \oplus c_n
+     * @f]
+     *
+     * @param a         Matrix with dimension \f$ B \times N \cdot K \f$ or \f$ B \times K \f$ for shared inputs (input)
+     * @param b         Stacked matrices with dimension \f$ N \times K \times M \f$ (input)
+     * @param c         Stacked laying vektors with dimension \f$ N \times M \f$ (input)
+     * @param result    Matrix with dimension \f$ B \times N \cdot M \f$ (output)
+	 */
+	void (*linear_stacked)(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
+
+	/** @brief Required math function: Gradients and input deltas of the stacked linear transformation
+	 *
+	 * Requires a math function that accumulates the weight and bias gradients and calculates the input deltas of all models:\n
+     * @f[
+     *  \partial w_n \leftarrow \partial w_n + x_n^T \cdot \delta_{out,n}, \quad
+     *  \partial b_n \leftarrow \partial b_n + \delta_{out,n}, \quad
+     *  \delta_{in,n} \leftarrow \delta_{out,n} \cdot w_n^T
+     * @f]
+	 */
+	void (*linear_stacked_backward)(const aitensor_t *x, const aitensor_t *delta_out, const aitensor_t *weights,
+									aitensor_t *d_weights, aitensor_t *d_bias, aitensor_t *delta_in);
+
+	///@}
+
+	uint16_t result_shape[2]; /**< Inference result tensor (ailayer.result) shape. */
+};
+
+/** @brief Stacked Dense layer type
+ *
+ * Defines the type of the layer (for example for type checks and debug prints).
+ * See aicore_layertype for more information about the layer type.
+ */
+extern const aicore_layertype_t *ailayer_dense_stacked_type;
+
+/** @brief Initialize and connect the given stacked Dense layer
+ *
+ * This function represents the "constructor" of the abstract stacked Dense layer. It initializes the layer structure
+ * and connects it to the previous layer.\n
+ * This function is not intended to call it directly. Instead use one of the data type specific implementations
+ * (like for example ailayer_dense_stacked_f32_default()).
+ *
+ * @param *layer        The layer to initialize.
+ * @param *input_layer  The previous layer that provides the inputs to the layer.
+ * @return  Pointer to the (successfully) initialized general layer structure (ailayer_dense_stacked.base)
+ */
+ailayer_t *ailayer_dense_stacked(ailayer_dense_stacked_t *layer, ailayer_t *input_layer);
+
+/** @brief Calculate the forward pass for given stacked Dense layer
+ *
+ * *Implementation of ailayer.forward.*
+ *
+ * Used math functions:
+ * * ailayer_dense_stacked.linear_stacked
+ *
+ * @param *self Layer to calculate the forward path for.
+ */
+void ailayer_dense_stacked_forward(ailayer_t *self);
+
+/** @brief Calculate the backward pass for the given stacked Dense layer
+ *
+ * *Implementation of ailayer.backward.*
+ *
+ * The gradients of all models and the deltas for the previous layer are calculated with one call.
+ *
+ * Used math functions:
+ * * ailayer_dense_stacked.linear_stacked_backward
+ *
+ * @param *self Layer to calculate the backward path for.
+ */
+void ailayer_dense_stacked_backward(ailayer_t *self);
+
+/** @brief Calculate the shape of the result tensor (ailayer.result)
+ *
+ * *Implementation of ailayer.calc_result_shape.*
+ *
+ * Resulting shape is [count_inputs x (model_count * neurons)]
+ *
+ * @param *self Layer to calculate the resulting shape for.
+ */
+void ailayer_dense_stacked_calc_result_shape(ailayer_t *self);
+
+/** @brief Calculate and return the parameter memory size needed for this layer
+ *
+ * *Implementation of ailayer.sizeof_paramem.*
+ *
+ * @param *self The layer to calculate the parameter memory size for
+ * @return  Calculated parameter memory size in bytes.
+ */
+uint32_t ailayer_dense_stacked_sizeof_paramem(const ailayer_t *self);
+
+/** @brief Distribute provided memory to the parameter pointers
+ *
+ * *Implementation of ailayer.set_paramem.*
+ *
+ * @param *self         The layer to set the memory fields for.
+ * @param *memory_ptr   The memory that can be used for the parameters
+ */
+void ailayer_dense_stacked_set_paramem(ailayer_t *self, void *memory_ptr);
+
+/** @brief Calculate and return the memory size needed by this layer for training
+ *
+ * *Implementation of ailayer.sizeof_trainmem.*
+ *
+ * The memory size is calculated for the gradient tensors of weights and bias.
+ *
+ * @param *self The layer to calculate the gradient memory size for.
+ * @return  Calculated gradient memory size in bytes.
+ */
+uint32_t ailayer_dense_stacked_sizeof_trainmem(const ailayer_t *self);
+
+/** @brief Distribute provided memory to the gradients pointers
+ *
+ * *Implementation of ailayer.set_trainmem.*
+ *
+ * @param *self         The layer to set the memory fields for.
+ * @param *memory_ptr   The memory that can be used for the gradients
+ */
+void ailayer_dense_stacked_set_trainmem(ailayer_t *self, void *memory_ptr);
+
+/** @brief Copy the parameters of one model into a Dense layer
+ *
+ * The Dense layer must have the same number of inputs and neurons and the same data types as one model of the
+ * stacked layer and its parameter memory must be set.
+ *
+ * @param *layer        The stacked layer
+ * @param model_index   Index of the model (0 to model_count - 1)
+ * @param *dense        The Dense layer to copy the parameters to
+ */
+void ailayer_dense_stacked_export_model(const ailayer_dense_stacked_t *layer, uint16_t model_index, ailayer_dense_t *dense);
+
+/** @brief Calculate the static cost of a forward pass of the stacked Dense layer
+ *
+ * *Implementation of aicore_layertype.calc_cost.*
+ *
+ * @param *self The layer to calculate the cost for (the result shape has to be calculated before)
+ * @param *cost The calculated cost is written here
+ */
+void ailayer_dense_stacked_calc_cost(const ailayer_t *self, aicore_layercost_t *cost);
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+/** @brief Print the layer specification
+ *
+ * @param *self     The layer to print the specification for
+ * @param *print    Pointer to the print function to use
+ */
+void ailayer_dense_stacked_print_specs(const ailayer_t *self, int (*print)(const char *format, ...));
+#endif // AIDEBUG_PRINT_MODULE_SPECS
+
+#endif // AILAYER_DENSE_STACKED
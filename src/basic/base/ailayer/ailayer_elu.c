@@ -28,11 +28,12 @@
 const aicore_layertype_t ailayer_elu_type_s = {
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
     .name = "ELU",
-	.print_specs = ailayer_elu_print_specs
+	.print_specs = ailayer_elu_print_specs,
 #else
     .name = 0,
-    .print_specs = 0
+    .print_specs = 0,
 #endif
+	.calc_cost = ailayer_elu_calc_cost
 };
 const aicore_layertype_t *ailayer_elu_type = &ailayer_elu_type_s;
 
@@ -54,12 +55,14 @@ ailayer_t *ailayer_elu(ailayer_elu_t *layer,  ailayer_t *input_layer) ////const
 
 	layer->base.forward = ailayer_elu_forward;
 	layer->base.backward = ailayer_elu_backward;
+	layer->base.backward_sgd = 0;
 
 	layer->base.calc_result_shape = ailayer_elu_calc_result_shape;
 	layer->base.sizeof_paramem = 0;
 	layer->base.set_paramem = 0;
 	layer->base.sizeof_trainmem = 0;
 	layer->base.set_trainmem = 0;
+	layer->base.result_in_place = FALSE;
 
 	layer->base.trainable_params_count = 0;
 
@@ -84,6 +87,12 @@ void ailayer_elu_backward(ailayer_t *self)
 	aitensor_t *delta_out = &(self->output_layer->deltas);
 	aitensor_t *x_in = &(self->input_layer->result);
 
+	if(layer->elu_backward != 0){
+		// delta_in = delta_out .* elu'(x_in) in one pass
+		layer->elu_backward(x_in, layer->alpha, delta_out, delta_in);
+		return;
+	}
+
 	// delta_in = delta_out .* elu'(x_in)
 	layer->d_elu(x_in, layer->alpha, delta_in);
 	layer->multiply(delta_in, delta_out, delta_in);
@@ -100,6 +109,20 @@ void ailayer_elu_calc_result_shape(ailayer_t *self)
 	return;
 }
 
+void ailayer_elu_calc_cost(const ailayer_t *self, aicore_layercost_t *cost)
+{
+	uint32_t elements = aimath_tensor_elements(&(self->result));
+
+	// Per element: One comparison and one exponential function with subtraction and multiplication for negative values
+	cost->ops = 3 * elements;
+	cost->special_ops = elements;
+	cost->bytes_read = aimath_sizeof_tensor_data(&(self->input_layer->result));
+	cost->bytes_written = aimath_sizeof_tensor_data(&(self->result));
+	cost->parameter_bytes = 0;
+	cost->activation_bytes = aimath_sizeof_tensor_data(&(self->result));
+	return;
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 void ailayer_elu_print_specs(const ailayer_t *self, int (*print)(const char *format, ...))
 {
@@ -107,6 +107,17 @@ struct ailayer_elu {
 	 */
 	void (*multiply)(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
 
+	/** @brief Optional math function: Fused backward pass
+	 *
+	 * Calculates the deltas for the previous layer in one pass without an intermediate tensor:\n
+     * @f[
+     *  \delta_{in,i} = \delta_{out,i} \cdot elu'(x_i)
+     * @f]
+     *
+     * If not set (0), the derivative and the multiplication functions are used.
+	 */
+	void (*elu_backward)(const aitensor_t *x, const void *alpha, const aitensor_t *delta_out, aitensor_t *delta_in);
+
 	///@}
 };
 
@@ -169,6 +180,7 @@ void ailayer_elu_forward(ailayer_t *self);
  * \f$ \delta_{out} \f$:	 Result of the backward pass of the next layer\n\n
  *
  * Used math functions:
+ * * ailayer_elu.elu_backward (if set, otherwise the following functions)
  * * ailayer_elu.elu
  * * ailayer_elu.d_elu
  * * ailayer_elu.multiply
@@ -188,6 +200,17 @@ void ailayer_elu_backward(ailayer_t *self);
  */
 void ailayer_elu_calc_result_shape(ailayer_t *self);
 
+/** @brief Calculate the static cost of a forward pass of the ELU layer
+ *
+ * *Implementation of aicore_layertype.calc_cost.*
+ *
+ * Per element: One comparison and one exponential function with subtraction and multiplication for negative values.
+ *
+ * @param *self The layer to calculate the cost for (the result shape has to be calculated before)
+ * @param *cost The calculated cost is written here
+ */
+void ailayer_elu_calc_cost(const ailayer_t *self, aicore_layercost_t *cost);
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 /** @brief Print the layer specification
  *
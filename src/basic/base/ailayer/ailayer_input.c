@@ -28,11 +28,12 @@
 const aicore_layertype_t ailayer_input_type_s = {
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
     .name = "Input",
-	.print_specs = ailayer_input_print_specs
+	.print_specs = ailayer_input_print_specs,
 #else
     .name = 0,
-    .print_specs = 0
+    .print_specs = 0,
 #endif
+	.calc_cost = ailayer_input_calc_cost
 };
 const aicore_layertype_t *ailayer_input_type = &ailayer_input_type_s;
 
@@ -50,12 +51,14 @@ ailayer_t *ailayer_input(ailayer_input_t *layer)
 
 	layer->base.forward = ailayer_input_forward;
 	layer->base.backward = ailayer_input_backward;
+	layer->base.backward_sgd = 0;
 
 	layer->base.calc_result_shape = ailayer_input_calc_result_shape;
 	layer->base.sizeof_paramem = 0;
 	layer->base.set_paramem = 0;
 	layer->base.sizeof_trainmem = 0;
 	layer->base.set_trainmem = 0;
+	layer->base.result_in_place = FALSE;
 
 	layer->base.get_result_bound = 0;
 
@@ -83,6 +86,18 @@ void ailayer_input_calc_result_shape(ailayer_t *self)
 	return;
 }
 
+void ailayer_input_calc_cost(const ailayer_t *self, aicore_layercost_t *cost)
+{
+	// No calculations, the input data is only referenced
+	cost->ops = 0;
+	cost->special_ops = 0;
+	cost->bytes_read = 0;
+	cost->bytes_written = 0;
+	cost->parameter_bytes = 0;
+	cost->activation_bytes = aimath_sizeof_tensor_data(&(self->result));
+	return;
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 void ailayer_input_print_specs(const ailayer_t *self, int (*print)(const char *format, ...))
 {
@@ -108,6 +108,17 @@ void ailayer_input_backward(ailayer_t *self);
  */
 void ailayer_input_calc_result_shape(ailayer_t *self);
 
+/** @brief Calculate the static cost of a forward pass of the Input layer
+ *
+ * *Implementation of aicore_layertype.calc_cost.*
+ *
+ * No calculations are performed, the input data is only referenced.
+ *
+ * @param *self The layer to calculate the cost for (the result shape has to be calculated before)
+ * @param *cost The calculated cost is written here
+ */
+void ailayer_input_calc_cost(const ailayer_t *self, aicore_layercost_t *cost);
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 /** @brief Print the layer specification
  *
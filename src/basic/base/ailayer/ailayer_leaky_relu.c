@@ -28,11 +28,12 @@
 const aicore_layertype_t ailayer_leaky_relu_type_s = {
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
     .name = "Leaky ReLU",
-	.print_specs = ailayer_leaky_relu_print_specs
+	.print_specs = ailayer_leaky_relu_print_specs,
 #else
     .name = 0,
-    .print_specs = 0
+    .print_specs = 0,
 #endif
+	.calc_cost = ailayer_leaky_relu_calc_cost
 };
 const aicore_layertype_t *ailayer_leaky_relu_type = &ailayer_leaky_relu_type_s;
 
@@ -53,12 +54,22 @@ ailayer_t *ailayer_leaky_relu(ailayer_leaky_relu_t *layer,  ailayer_t *input_lay
 
 	layer->base.forward = ailayer_leaky_relu_forward;
 	layer->base.backward = ailayer_leaky_relu_backward;
+	layer->base.backward_sgd = 0;
 
 	layer->base.calc_result_shape = ailayer_leaky_relu_calc_result_shape;
 	layer->base.sizeof_paramem = 0;
 	layer->base.set_paramem = 0;
-	layer->base.sizeof_trainmem = 0;
-	layer->base.set_trainmem = 0;
+	if(layer->leaky_relu_mask != 0 && layer->leaky_relu_backward_mask != 0){
+		// The sign mask replaces the inputs in the backward pass
+		layer->base.sizeof_trainmem = ailayer_leaky_relu_sizeof_trainmem;
+		layer->base.set_trainmem = ailayer_leaky_relu_set_trainmem;
+		layer->base.result_in_place = TRUE;
+	} else {
+		layer->base.sizeof_trainmem = 0;
+		layer->base.set_trainmem = 0;
+		layer->base.result_in_place = FALSE;
+	}
+	layer->mask = 0;
 
 	layer->base.trainable_params_count = 0;
 
@@ -71,6 +82,12 @@ void ailayer_leaky_relu_forward(ailayer_t *self)
 	aitensor_t *x_in = &(self->input_layer->result);
 	aitensor_t *x_out = &(self->result);
 
+	if(x_out->data == x_in->data && layer->mask != 0){
+		// In place training mode: Keep the signs of the inputs for the backward pass
+		layer->leaky_relu_mask(x_in, layer->alpha, x_out, layer->mask);
+		return;
+	}
+
 	layer->leaky_relu(x_in, layer->alpha, x_out);
 	return;
 }
@@ -82,6 +99,18 @@ void ailayer_leaky_relu_backward(ailayer_t *self)
 	aitensor_t *delta_out = &(self->output_layer->deltas);
 	aitensor_t *x_in = &(self->input_layer->result);
 
+	if(self->result.data == x_in->data && layer->mask != 0){
+		// In place training mode: x_in was overwritten, take the derivative from the sign mask
+		layer->leaky_relu_backward_mask(layer->mask, layer->alpha, delta_out, delta_in);
+		return;
+	}
+
+	if(layer->leaky_relu_backward != 0){
+		// delta_in = delta_out .* leaky_relu'(x_in) in one pass
+		layer->leaky_relu_backward(x_in, layer->alpha, delta_out, delta_in);
+		return;
+	}
+
 	// delta_in = delta_out .* relu'(x_in)
 	layer->d_leaky_relu(x_in, layer->alpha, delta_in);
 	layer->multiply(delta_in, delta_out, delta_in);
@@ -89,6 +118,20 @@ void ailayer_leaky_relu_backward(ailayer_t *self)
 	return;
 }
 
+uint32_t ailayer_leaky_relu_sizeof_trainmem(const ailayer_t *self)
+{
+	// One bit per element, rounded up to 4 bytes
+	return ((aimath_tensor_elements(&(self->result)) + 31) / 32) * 4;
+}
+
+void ailayer_leaky_relu_set_trainmem(ailayer_t *self, void *memory_ptr)
+{
+	ailayer_leaky_relu_t *layer = (ailayer_leaky_relu_t *)(self->layer_configuration);
+
+	layer->mask = memory_ptr;
+	return;
+}
+
 void ailayer_leaky_relu_calc_result_shape(ailayer_t *self)
 {
 	/* Unused: Shape is already defined (Pointer)
@@ -99,6 +142,20 @@ void ailayer_leaky_relu_calc_result_shape(ailayer_t *self)
 	return;
 }
 
+void ailayer_leaky_relu_calc_cost(const ailayer_t *self, aicore_layercost_t *cost)
+{
+	uint32_t elements = aimath_tensor_elements(&(self->result));
+
+	// Per element: One comparison and one multiplication
+	cost->ops = 2 * elements;
+	cost->special_ops = 0;
+	cost->bytes_read = aimath_sizeof_tensor_data(&(self->input_layer->result));
+	cost->bytes_written = aimath_sizeof_tensor_data(&(self->result));
+	cost->parameter_bytes = 0;
+	cost->activation_bytes = aimath_sizeof_tensor_data(&(self->result));
+	return;
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 void ailayer_leaky_relu_print_specs(const ailayer_t *self, int (*print)(const char *format, ...))
 {
@@ -0,0 +1,176 @@
+/**
+ * \file basic/base/ailayer/ailayer_normalize.c
+ * \version 2.0alpha
+ * \date 07.12.2020
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See ailayer_normalize.h for documentation.
+ * \details
+ */
+
+#include "basic/base/ailayer/ailayer_normalize.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+const aicore_layertype_t ailayer_normalize_type_s = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = "Normalize",
+	.print_specs = ailayer_normalize_print_specs,
+#else
+    .name = 0,
+    .print_specs = 0,
+#endif
+	.calc_cost = ailayer_normalize_calc_cost
+};
+const aicore_layertype_t *ailayer_normalize_type = &ailayer_normalize_type_s;
+
+
+ailayer_t *ailayer_normalize(ailayer_normalize_t *layer, ailayer_t *input_layer)
+{
+    layer->base.layer_type = ailayer_normalize_type;
+
+	layer->base.input_layer = input_layer;
+	input_layer->output_layer = &(layer->base);
+
+	layer->base.layer_configuration = layer;
+	layer->base.result.dtype = layer->dtype;
+	layer->base.result.shape = input_layer->result.shape;
+	layer->base.result.dim = input_layer->result.dim;
+
+	layer->base.deltas.dtype = layer->dtype;
+	layer->base.deltas.dim = 2;
+	layer->base.deltas.shape = layer->base.result.shape;
+
+	layer->scale.dim = 2;
+	layer->scale.dtype = layer->dtype;
+	layer->scale.shape = layer->scale_shape;
+	layer->scale.shape[0] = 1;
+	layer->scale.shape[1] = input_layer->result.shape[1];
+
+	layer->offset.dim = 2;
+	layer->offset.dtype = layer->dtype;
+	layer->offset.shape = layer->offset_shape;
+	layer->offset.shape[0] = 1;
+	layer->offset.shape[1] = input_layer->result.shape[1];
+
+	layer->base.forward = ailayer_normalize_forward;
+	layer->base.backward = ailayer_normalize_backward;
+	layer->base.backward_sgd = 0;
+
+	layer->base.calc_result_shape = ailayer_normalize_calc_result_shape;
+	layer->base.sizeof_paramem = ailayer_normalize_sizeof_paramem;
+	layer->base.set_paramem = ailayer_normalize_set_paramem;
+	layer->base.sizeof_trainmem = 0;
+	layer->base.set_trainmem = 0;
+	layer->base.result_in_place = FALSE;
+
+	layer->base.get_result_bound = 0;
+
+	// The statistics are not trained
+	layer->base.trainable_params_count = 0;
+
+	return &(layer->base);
+}
+
+void ailayer_normalize_forward(ailayer_t *self)
+{
+	ailayer_normalize_t *layer = (ailayer_normalize_t *)(self->layer_configuration);
+	aitensor_t *x_in = &(self->input_layer->result);
+	aitensor_t *x_out = &(self->result);
+
+	// x_out = x_in .* scale + offset
+	layer->scale_offset(x_in, &(layer->scale), &(layer->offset), x_out);
+	return;
+}
+
+void ailayer_normalize_backward(ailayer_t *self)
+{
+	ailayer_normalize_t *layer = (ailayer_normalize_t *)(self->layer_configuration);
+	aitensor_t *delta_in = &(self->deltas);
+	aitensor_t *delta_out = &(self->output_layer->deltas);
+
+	// delta_in = delta_out .* scale
+	layer->scale_offset(delta_out, &(layer->scale), 0, delta_in);
+	return;
+}
+
+void ailayer_normalize_calc_result_shape(ailayer_t *self)
+{
+	/* Unused: Shape is already defined (Pointer) */
+	return;
+}
+
+uint32_t ailayer_normalize_sizeof_paramem(const ailayer_t *self)
+{
+	uint32_t memory = 0;
+	ailayer_normalize_t *layer = (ailayer_normalize_t *)(self->layer_configuration);
+
+	memory += layer->dtype->tensor_params_size;
+	memory += aimath_sizeof_tensor_data(&(layer->scale));
+	memory += layer->dtype->tensor_params_size;
+	memory += aimath_sizeof_tensor_data(&(layer->offset));
+	return memory;
+}
+
+void ailayer_normalize_set_paramem(ailayer_t *self, void *memory_ptr)
+{
+	uint32_t address_counter = 0;
+	ailayer_normalize_t *layer = (ailayer_normalize_t *)(self->layer_configuration);
+
+	layer->scale.tensor_params = memory_ptr + address_counter;
+	address_counter += layer->dtype->tensor_params_size;
+	layer->scale.shape[1] = self->input_layer->result.shape[1];
+	layer->scale.data = memory_ptr + address_counter;
+	address_counter += aimath_sizeof_tensor_data(&(layer->scale));
+
+	layer->offset.tensor_params = memory_ptr + address_counter;
+	address_counter += layer->dtype->tensor_params_size;
+	layer->offset.shape[1] = self->input_layer->result.shape[1];
+	layer->offset.data = memory_ptr + address_counter;
+
+	return;
+}
+
+void ailayer_normalize_fit(ailayer_normalize_t *layer, const aitensor_t *x)
+{
+	layer->standardization(x, &(layer->scale), &(layer->offset));
+	return;
+}
+
+void ailayer_normalize_calc_cost(const ailayer_t *self, aicore_layercost_t *cost)
+{
+	uint32_t elements = aimath_tensor_elements(&(self->result));
+	ailayer_normalize_t *layer = (ailayer_normalize_t *)(self->layer_configuration);
+
+	// Per element: One multiplication and one addition
+	cost->ops = 2 * elements;
+	cost->special_ops = 0;
+	cost->parameter_bytes = aimath_sizeof_tensor_data(&(layer->scale)) + aimath_sizeof_tensor_data(&(layer->offset));
+	cost->bytes_read = aimath_sizeof_tensor_data(&(self->input_layer->result)) + cost->parameter_bytes;
+	cost->bytes_written = aimath_sizeof_tensor_data(&(self->result));
+	cost->activation_bytes = aimath_sizeof_tensor_data(&(self->result));
+	return;
+}
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+void ailayer_normalize_print_specs(const ailayer_t *self, int (*print)(const char *format, ...))
+{
+    ailayer_normalize_t *layer = (ailayer_normalize_t *)(self->layer_configuration);
+
+    print("features: %ld", (long unsigned int) layer->scale.shape[1]);
+    return;
+}
+#endif
@@ -0,0 +1,239 @@
+
+/**
+ * \file basic/base/ailayer/ailayer_normalize.h
+ * \internal
+ * \date 07.12.2020
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Base \link ailayer layer \endlink implementation of the Normalize layer (input standardization)
+ *
+ * This is an "abstract" data-type independent implementation. To use the layer use one of the provided
+ * implementations for a specific hardware and data-type (for example from ailayer_normalize_default.h) or set
+ * the required math functions on your own.
+ *
+ * The Normalize layer scales and shifts every feature of the input separately. It calculates
+ * @f[
+ *  y = x \circ scale + offset
+ * @f]
+ * for every row of the input tensor. With \f$ scale_j = 1 / \sigma_j \f$ and \f$ offset_j = - \mu_j / \sigma_j \f$,
+ * the features are standardized with the mean \f$ \mu \f$ and the standard deviation \f$ \sigma \f$ of the
+ * training data (see ailayer_normalize_fit()). Raw sensor values can be used as model input this way.
+ *
+ * The scale and offset are stored in the parameter memory, but they are not trained.
+ *
+ * For the inference, a Normalize layer that is followed by a \link ailayer_dense.h Dense layer \endlink can be folded
+ * into the weights and bias of the Dense layer with aialgo_fold_normalize_layers(). The normalization costs nothing
+ * at runtime afterwards.
+ *
+ * The results of the forward pass of this layer are written to the result tensor of the base ailayer_t struct.
+ */
+
+#ifndef AILAYER_NORMALIZE
+#define AILAYER_NORMALIZE
+
+#include "core/aifes_core.h"
+
+typedef struct ailayer_normalize 	ailayer_normalize_t;
+
+/** @brief General \link ailayer_normalize.h Normalize layer \endlink struct
+*
+*/
+struct ailayer_normalize {
+	ailayer_t base; /**< Inherited field members from general ailayer struct. */
+	const aimath_dtype_t *dtype; /**< Data type of the input, the inference result and the parameters. */
+
+	/** @name Parameters
+	 * @brief Data fields for the (not trainable) parameters of the layer
+	 */
+	///@{
+	aitensor_t scale; /**< Tensor containing the scales of the features. */
+	aitensor_t offset; /**< Tensor containing the offsets of the features. */
+	uint16_t scale_shape[2]; /**< Shape of the scale tensor. */
+	uint16_t offset_shape[2]; /**< Shape of the offset tensor. */
+	///@}
+
+	/** @name Math functions
+	 * @brief Required data type specific math functions
+	 */
+	///@{
+
+	/** @brief Required math function: Column scaling with offset
+	 *
+	 * Requires a math function that scales the columns of a matrix and adds an offset vector to every row:\n
+     * @f[
+     *  result_{ij} = x_{ij} \cdot scale_j + offset_j
+     * @f]
+     *
+     * @param x         Matrix with dimension \f$ N \times K \f$ (input)
+     * @param scale     Vector with dimension \f$ 1 \times K \f$ (input)
+     * @param offset    Vector with dimension \f$ 1 \times K \f$ or 0 for no offset (input)
+     * @param result    Matrix with dimension \f$ N \times K \f$ (output)
+	 */
+	void (*scale_offset)(const aitensor_t *x, const aitensor_t *scale, const aitensor_t *offset, aitensor_t *result);
+
+	/** @brief Required math function for ailayer_normalize_fit(): Scale and offset for a standardization
+	 *
+	 * @param x         Training data with dimension \f$ N \times K \f$ (input)
+	 * @param scale     Vector with dimension \f$ 1 \times K \f$ (output)
+	 * @param offset    Vector with dimension \f$ 1 \times K \f$ (output)
+	 */
+	void (*standardization)(const aitensor_t *x, aitensor_t *scale, aitensor_t *offset);
+
+	/** @brief Required math function for aialgo_fold_normalize_layers(): Folding into a linear transformation
+	 *
+     * @f[
+     *  b'_j = b_j + \sum_i offset_i \cdot W_{ij}, \quad W'_{ij} = scale_i \cdot W_{ij}
+     * @f]
+     *
+     * @param scale     Vector with dimension \f$ 1 \times K \f$ (input)
+     * @param offset    Vector with dimension \f$ 1 \times K \f$ (input)
+     * @param weights   Matrix with dimension \f$ K \times M \f$ (input and output)
+     * @param bias      Vector with dimension \f$ 1 \times M \f$ (input and output)
+	 */
+	void (*fold_scale_offset)(const aitensor_t *scale, const aitensor_t *offset, aitensor_t *weights, aitensor_t *bias);
+
+	///@}
+};
+
+/** @brief Normalize layer type
+ *
+ * Defines the type of the layer (for example for type checks and debug prints).
+ * See aicore_layertype for more information about the layer type.
+ */
+extern const aicore_layertype_t *ailayer_normalize_type;
+
+/** @brief Initialize and connect the given Normalize layer
+ *
+ * This function represents the "constructor" of the abstract Normalize layer. It initializes the layer structure
+ * and connects it to the previous layer.\n
+ * This function is not intended to call it directly. Instead use one of the data type specific implementations
+ * (like for example ailayer_normalize_f32_default()).
+ *
+ * @param *layer        The layer to initialize.
+ * @param *input_layer  The previous layer that provides the inputs to the layer.
+ * @return  Pointer to the (successfully) initialized general layer structure (ailayer_normalize.base).
+ */
+ailayer_t *ailayer_normalize(ailayer_normalize_t *layer, ailayer_t *input_layer);
+
+/** @brief Calculate the forward pass for given Normalize layer
+ *
+ * *Implementation of ailayer.forward.*
+ *
+ * It uses the result tensor of the previous layer as input and writes the result of the forward pass
+ * to the result tensor (ailayer.result) of the given layer.
+ *
+ * Calculation of the forward pass result:
+ * @f[
+ *  x_{out} \leftarrow x_{in} \circ scale + offset
+ * @f]
+ *
+ * Used math functions:
+ * * ailayer_normalize.scale_offset
+ *
+ * @param *self Layer to calculate the forward path for.
+ */
+void ailayer_normalize_forward(ailayer_t *self);
+
+/** @brief Calculate the backward pass for the given Normalize layer
+ *
+ * *Implementation of ailayer.backward.*
+ *
+ * Calculation of the errors for the previous layer:
+ * @f[
+ *  \delta_{in} \leftarrow \delta_{out} \circ scale
+ * @f]
+ *
+ * Used math functions:
+ * * ailayer_normalize.scale_offset
+ *
+ * @param *self Layer to calculate the backward path for.
+ */
+void ailayer_normalize_backward(ailayer_t *self);
+
+/** @brief Calculate the shape of the result tensor
+ *
+ * *Implementation of ailayer.calc_result_shape.*
+ *
+ * As the result tensor shape is shared with the result tensor shape of the previous layer (no change in shape is needed),
+ * this function returns without doing anything.
+ *
+ * @param *self Layer to calculate the resulting shape for.
+ */
+void ailayer_normalize_calc_result_shape(ailayer_t *self);
+
+/** @brief Calculate and return the parameter memory size needed for this layer
+ *
+ * *Implementation of ailayer.sizeof_paramem.*
+ *
+ * The parameter size is calculated for the scale and offset tensors.
+ *
+ * @param *self The layer to calculate the parameter memory size for
+ * @return  Calculated parameter memory size in bytes.
+ */
+uint32_t ailayer_normalize_sizeof_paramem(const ailayer_t *self);
+
+/** @brief Distribute provided memory to the parameter pointers
+ *
+ * *Implementation of ailayer.set_paramem.*
+ *
+ * The required parameter size can be calculated with ailayer_normalize_sizeof_paramem()
+ *
+ * @param *self         The layer to set the memory fields for.
+ * @param *memory_ptr   The memory that can be used for the parameters
+ */
+void ailayer_normalize_set_paramem(ailayer_t *self, void *memory_ptr);
+
+/** @brief Set the scale and offset to standardize the given training data
+ *
+ * The parameter memory of the layer has to be set before (for example with aialgo_distribute_parameter_memory()).
+ *
+ * Example:
+ * \code{.c}
+ * ailayer_normalize_fit(&normalize_layer, &input_tensor);
+ * \endcode
+ *
+ * Used math functions:
+ * * ailayer_normalize.standardization
+ *
+ * @param *layer    The layer to set the parameters for
+ * @param *x        Training data with one sample per row (2D tensor of shape [N x K])
+ */
+void ailayer_normalize_fit(ailayer_normalize_t *layer, const aitensor_t *x);
+
+/** @brief Calculate the static cost of a forward pass of the Normalize layer
+ *
+ * *Implementation of aicore_layertype.calc_cost.*
+ *
+ * Per element: One multiplication and one addition.
+ *
+ * @param *self The layer to calculate the cost for (the result shape has to be calculated before)
+ * @param *cost The calculated cost is written here
+ */
+void ailayer_normalize_calc_cost(const ailayer_t *self, aicore_layercost_t *cost);
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+/** @brief Print the layer specification
+ *
+ * @param *self     The layer to print the specification for
+ * @param *print    Pointer to the print function to use
+ */
+void ailayer_normalize_print_specs(const ailayer_t *self, int (*print)(const char *format, ...));
+#endif // AIDEBUG_PRINT_MODULE_SPECS
+
+#endif // AILAYER_NORMALIZE
@@ -28,11 +28,12 @@
 const aicore_layertype_t ailayer_relu_type_s = {
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
     .name = "ReLU",
-	.print_specs = ailayer_relu_print_specs
+	.print_specs = ailayer_relu_print_specs,
 #else
     .name = 0,
-    .print_specs = 0
+    .print_specs = 0,
 #endif
+	.calc_cost = ailayer_relu_calc_cost
 };
 const aicore_layertype_t *ailayer_relu_type = &ailayer_relu_type_s;
 
@@ -55,12 +56,22 @@ ailayer_t *ailayer_relu(ailayer_relu_t *layer, ailayer_t *input_layer)
 
 	layer->base.forward = ailayer_relu_forward;
 	layer->base.backward = ailayer_relu_backward;
+	layer->base.backward_sgd = 0;
 
 	layer->base.calc_result_shape = ailayer_relu_calc_result_shape;
 	layer->base.sizeof_paramem = 0;
 	layer->base.set_paramem = 0;
-	layer->base.sizeof_trainmem = 0;
-	layer->base.set_trainmem = 0;
+	if(layer->relu_mask != 0 && layer->relu_backward_mask != 0){
+		// The sign mask replaces the inputs in the backward pass
+		layer->base.sizeof_trainmem = ailayer_relu_sizeof_trainmem;
+		layer->base.set_trainmem = ailayer_relu_set_trainmem;
+		layer->base.result_in_place = TRUE;
+	} else {
+		layer->base.sizeof_trainmem = 0;
+		layer->base.set_trainmem = 0;
+		layer->base.result_in_place = FALSE;
+	}
+	layer->mask = 0;
 
 	layer->base.trainable_params_count = 0;
 
@@ -73,6 +84,12 @@ void ailayer_relu_forward(ailayer_t *self)
 	aitensor_t *x_in = &(self->input_layer->result);
 	aitensor_t *x_out = &(self->result);
 
+	if(x_out->data == x_in->data && layer->mask != 0){
+		// In place training mode: Keep the signs of the inputs for the backward pass
+		layer->relu_mask(x_in, x_out, layer->mask);
+		return;
+	}
+
 	layer->relu(x_in, x_out);
 	return;
 }
@@ -85,12 +102,38 @@ void ailayer_relu_backward(ailayer_t *self)
 	aitensor_t *delta_out = &(self->output_layer->deltas);
 	aitensor_t *x_in = &(self->input_layer->result);
 
+	if(self->result.data == x_in->data && layer->mask != 0){
+		// In place training mode: x_in was overwritten, take the derivative from the sign mask
+		layer->relu_backward_mask(layer->mask, delta_out, delta_in);
+		return;
+	}
+
+	if(layer->relu_backward != 0){
+		// delta_in = delta_out .* relu'(x_in) in one pass
+		layer->relu_backward(x_in, delta_out, delta_in);
+		return;
+	}
+
 	// delta_in = delta_out .* relu'(x_in)
 	layer->d_relu(x_in, delta_in);
 	layer->multiply(delta_in, delta_out, delta_in);
 	return;
 }
 
+uint32_t ailayer_relu_sizeof_trainmem(const ailayer_t *self)
+{
+	// One bit per element, rounded up to 4 bytes
+	return ((aimath_tensor_elements(&(self->result)) + 31) / 32) * 4;
+}
+
+void ailayer_relu_set_trainmem(ailayer_t *self, void *memory_ptr)
+{
+	ailayer_relu_t *layer = (ailayer_relu_t *)(self->layer_configuration);
+
+	layer->mask = memory_ptr;
+	return;
+}
+
 void ailayer_relu_calc_result_shape(ailayer_t *self)
 {
 	/* Unused: Shape is already defined (Pointer)
@@ -101,6 +144,20 @@ void ailayer_relu_calc_result_shape(ailayer_t *self)
 	return;
 }
 
+void ailayer_relu_calc_cost(const ailayer_t *self, aicore_layercost_t *cost)
+{
+	uint32_t elements = aimath_tensor_elements(&(self->result));
+
+	// Per element: One comparison
+	cost->ops = elements;
+	cost->special_ops = 0;
+	cost->bytes_read = aimath_sizeof_tensor_data(&(self->input_layer->result));
+	cost->bytes_written = aimath_sizeof_tensor_data(&(self->result));
+	cost->parameter_bytes = 0;
+	cost->activation_bytes = aimath_sizeof_tensor_data(&(self->result));
+	return;
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 void ailayer_relu_print_specs(const ailayer_t *self, int (*print)(const char *format, ...))
 {
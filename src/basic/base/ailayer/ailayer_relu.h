@@ -95,6 +95,59 @@ struct ailayer_relu {
      * @f]
 	 */
 	void (*multiply)(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
+
+	/** @brief Optional math function: Fused backward pass
+	 *
+	 * Calculates the deltas for the previous layer in one pass without an intermediate tensor:\n
+     * @f[
+     *  \delta_{in,i} = \delta_{out,i} \cdot relu'(x_i)
+     * @f]
+     *
+     * If not set (0), the derivative and the multiplication functions are used.
+	 */
+	void (*relu_backward)(const aitensor_t *x, const aitensor_t *delta_out, aitensor_t *delta_in);
+
+	/** @brief Optional math function: ReLU with sign mask
+	 *
+	 * Calculates the ReLU like ailayer_relu.relu and additionally stores one bit per element in the mask:\n
+     * @f[
+     *  mask_{i} = \begin{cases}
+                    0 & \text{if } x_i < 0\\
+                    1 & \text{if } x_i \geq 0
+                    \end{cases}
+     * @f]
+     *
+     * Bit i is stored in byte i / 8 at bit position i % 8. The result may be the same tensor as x.\n
+     * If this function and ailayer_relu.relu_backward_mask are set, the layer stores the mask in the training memory
+     * and sets ailayer.result_in_place.
+     *
+     * @param x         N-dimensional tensor (input)
+     * @param result    N-dimensional tensor (output)
+     * @param mask      Sign mask with (elements + 7) / 8 bytes (output)
+	 */
+	void (*relu_mask)(const aitensor_t *x, aitensor_t *result, uint8_t *mask);
+
+	/** @brief Optional math function: Backward pass with sign mask
+	 *
+	 * Calculates the deltas for the previous layer from the sign mask of ailayer_relu.relu_mask:\n
+     * @f[
+     *  \delta_{in,i} = \delta_{out,i} \cdot mask_i
+     * @f]
+     *
+     * @param mask      Sign mask (input)
+     * @param delta_out N-dimensional tensor (input)
+     * @param delta_in  N-dimensional tensor (output)
+	 */
+	void (*relu_backward_mask)(const uint8_t *mask, const aitensor_t *delta_out, aitensor_t *delta_in);
+
+	///@}
+
+	/** @name Training memory
+	 * @brief Only used with the sign mask functions
+	 */
+	///@{
+	uint8_t *mask; /**< Sign mask of the inputs of the last forward pass (1 bit per element). */
+	///@}
 };
 
 /** @brief ReLU layer type
@@ -132,8 +185,12 @@ ailayer_t *ailayer_relu(ailayer_relu_t *layer, ailayer_t *input_layer);
  * \f$ x_{in} \f$:	 Result of the forward pass of the previous layer\n
  * \f$ x_{out} \f$:	 Result of the forward pass of this layer\n\n
  *
+ * If the result overwrites the result of the previous layer (ailayer.result_in_place is applied by the
+ * training memory scheduler), the sign mask for the backward pass is stored in the training memory.
+ *
  * Used math functions:
  * * ailayer_relu.relu
+ * * ailayer_relu.relu_mask (in place training mode)
  *
  * @param *self Layer to calculate the forward path for.
  */
@@ -155,7 +212,11 @@ void ailayer_relu_forward(ailayer_t *self);
  * \f$ \delta_{in} \f$:	 Result of the backward pass of this layer\n
  * \f$ \delta_{out} \f$:	 Result of the backward pass of the next layer\n\n
  *
+ * In the in place training mode the derivative is taken from the sign mask of the forward pass.
+ *
  * Used math functions:
+ * * ailayer_relu.relu_backward_mask (in place training mode)
+ * * ailayer_relu.relu_backward (if set, otherwise the following functions)
  * * ailayer_relu.relu
  * * ailayer_relu.d_relu
  * * ailayer_relu.multiply
@@ -175,6 +236,40 @@ void ailayer_relu_backward(ailayer_t *self);
  */
 void ailayer_relu_calc_result_shape(ailayer_t *self);
 
+/** @brief Calculate and return the memory size needed by this layer for training
+ *
+ * *Implementation of ailayer.sizeof_trainmem.*
+ *
+ * Only set if the sign mask functions are available. The size of the sign mask (one bit per element)
+ * is rounded up to a multiple of 4 bytes to keep the following memory aligned.
+ *
+ * @param *self The layer to calculate the training memory size for
+ * @return  Calculated training memory size in bytes.
+ */
+uint32_t ailayer_relu_sizeof_trainmem(const ailayer_t *self);
+
+/** @brief Distribute provided memory to the sign mask
+ *
+ * *Implementation of ailayer.set_trainmem.*
+ *
+ * The required memory size can be calculated with ailayer_relu_sizeof_trainmem().
+ *
+ * @param *self         The layer to set the memory fields for.
+ * @param *memory_ptr   The memory that can be used for the training
+ */
+void ailayer_relu_set_trainmem(ailayer_t *self, void *memory_ptr);
+
+/** @brief Calculate the static cost of a forward pass of the ReLU layer
+ *
+ * *Implementation of aicore_layertype.calc_cost.*
+ *
+ * Per element: One comparison.
+ *
+ * @param *self The layer to calculate the cost for (the result shape has to be calculated before)
+ * @param *cost The calculated cost is written here
+ */
+void ailayer_relu_calc_cost(const ailayer_t *self, aicore_layercost_t *cost);
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 /** @brief Print the layer specification
  *
@@ -28,11 +28,12 @@
 const aicore_layertype_t ailayer_sigmoid_type_s = {
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
     .name = "Sigmoid",
-	.print_specs = ailayer_sigmoid_print_specs
+	.print_specs = ailayer_sigmoid_print_specs,
 #else
     .name = 0,
-    .print_specs = 0
+    .print_specs = 0,
 #endif
+	.calc_cost = ailayer_sigmoid_calc_cost
 };
 const aicore_layertype_t *ailayer_sigmoid_type = &ailayer_sigmoid_type_s;
 
@@ -55,12 +56,14 @@ ailayer_t *ailayer_sigmoid(ailayer_sigmoid_t *layer, ailayer_t *input_layer)
 
 	layer->base.forward = ailayer_sigmoid_forward;
 	layer->base.backward = ailayer_sigmoid_backward;
+	layer->base.backward_sgd = 0;
 
 	layer->base.calc_result_shape = ailayer_sigmoid_calc_result_shape;
 	layer->base.sizeof_paramem = 0;
 	layer->base.set_paramem = 0;
 	layer->base.sizeof_trainmem = 0;
 	layer->base.set_trainmem = 0;
+	layer->base.result_in_place = FALSE;
 
 	layer->base.trainable_params_count = 0;
 
@@ -85,6 +88,12 @@ void ailayer_sigmoid_backward(ailayer_t *self)
 	aitensor_t *delta_out = &(self->output_layer->deltas);
 	aitensor_t *x_in = &(self->input_layer->result);
 
+	if(layer->sigmoid_backward != 0){
+		// delta_in = delta_out .* sigmoid'(x_in) in one pass
+		layer->sigmoid_backward(x_in, delta_out, delta_in);
+		return;
+	}
+
 	int8_t temp_result_params[aimath_sizeof_tensor_params(x_in) + 1]; // +1 to prevent array of size 0
 	int8_t temp_result_data[aimath_sizeof_tensor_data(x_in)];
 	aitensor_t temp_result = {
@@ -113,6 +122,20 @@ void ailayer_sigmoid_calc_result_shape(ailayer_t *self)
 	return;
 }
 
+void ailayer_sigmoid_calc_cost(const ailayer_t *self, aicore_layercost_t *cost)
+{
+	uint32_t elements = aimath_tensor_elements(&(self->result));
+
+	// Per element: One exponential function, one division, one negation and one addition
+	cost->ops = 2 * elements;
+	cost->special_ops = 2 * elements;
+	cost->bytes_read = aimath_sizeof_tensor_data(&(self->input_layer->result));
+	cost->bytes_written = aimath_sizeof_tensor_data(&(self->result));
+	cost->parameter_bytes = 0;
+	cost->activation_bytes = aimath_sizeof_tensor_data(&(self->result));
+	return;
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 void ailayer_sigmoid_print_specs(const ailayer_t *self, int (*print)(const char *format, ...))
 {
@@ -89,6 +89,17 @@ struct ailayer_sigmoid {
 	 */
 	void (*multiply)(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
 
+	/** @brief Optional math function: Fused backward pass
+	 *
+	 * Calculates the deltas for the previous layer in one pass without an intermediate tensor:\n
+     * @f[
+     *  \delta_{in,i} = \delta_{out,i} \cdot sigmoid(x_i) \cdot (1 - sigmoid(x_i))
+     * @f]
+     *
+     * If not set (0), the derivative and the multiplication functions are used.
+	 */
+	void (*sigmoid_backward)(const aitensor_t *x, const aitensor_t *delta_out, aitensor_t *delta_in);
+
 	///@}
 };
 
@@ -151,6 +162,7 @@ void ailayer_sigmoid_forward(ailayer_t *self);
  * \f$ \delta_{out} \f$:	 Result of the backward pass of the next layer\n\n
  *
  * Used math functions:
+ * * ailayer_sigmoid.sigmoid_backward (if set, otherwise the following functions)
  * * ailayer_sigmoid.sigmoid
  * * ailayer_sigmoid.d_sigmoid
  * * ailayer_sigmoid.multiply
@@ -170,6 +182,17 @@ void ailayer_sigmoid_backward(ailayer_t *self);
  */
 void ailayer_sigmoid_calc_result_shape(ailayer_t *self);
 
+/** @brief Calculate the static cost of a forward pass of the Sigmoid layer
+ *
+ * *Implementation of aicore_layertype.calc_cost.*
+ *
+ * Per element: One exponential function, one division, one negation and one addition.
+ *
+ * @param *self The layer to calculate the cost for (the result shape has to be calculated before)
+ * @param *cost The calculated cost is written here
+ */
+void ailayer_sigmoid_calc_cost(const ailayer_t *self, aicore_layercost_t *cost);
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 /** @brief Print the layer specification
  *
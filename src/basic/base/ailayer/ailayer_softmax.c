@@ -28,11 +28,12 @@
 const aicore_layertype_t ailayer_softmax_type_s = {
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
     .name = "Softmax",
-	.print_specs = ailayer_softmax_print_specs
+	.print_specs = ailayer_softmax_print_specs,
 #else
     .name = 0,
-    .print_specs = 0
+    .print_specs = 0,
 #endif
+	.calc_cost = ailayer_softmax_calc_cost
 };
 const aicore_layertype_t *ailayer_softmax_type = &ailayer_softmax_type_s;
 
@@ -54,12 +55,14 @@ ailayer_t *ailayer_softmax(ailayer_softmax_t *layer, ailayer_t *input_layer)
 
 	layer->base.forward = ailayer_softmax_forward;
 	layer->base.backward = 0;
+	layer->base.backward_sgd = 0;
 
 	layer->base.calc_result_shape = ailayer_softmax_calc_result_shape;
 	layer->base.sizeof_paramem = 0;
 	layer->base.set_paramem = 0;
 	layer->base.sizeof_trainmem = 0;
 	layer->base.set_trainmem = 0;
+	layer->base.result_in_place = FALSE;
 
 	layer->base.trainable_params_count = 0;
 
@@ -86,6 +89,20 @@ void ailayer_softmax_calc_result_shape(ailayer_t *self)
 	return;
 }
 
+void ailayer_softmax_calc_cost(const ailayer_t *self, aicore_layercost_t *cost)
+{
+	uint32_t elements = aimath_tensor_elements(&(self->result));
+
+	// Per element: Maximum search, subtraction and summation of the exponential function values and one division
+	cost->ops = 3 * elements;
+	cost->special_ops = 2 * elements;
+	cost->bytes_read = aimath_sizeof_tensor_data(&(self->input_layer->result));
+	cost->bytes_written = aimath_sizeof_tensor_data(&(self->result));
+	cost->parameter_bytes = 0;
+	cost->activation_bytes = aimath_sizeof_tensor_data(&(self->result));
+	return;
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 void ailayer_softmax_print_specs(const ailayer_t *self, int (*print)(const char *format, ...))
 {
@@ -128,6 +128,17 @@ void ailayer_softmax_forward(ailayer_t *self);
  */
 void ailayer_softmax_calc_result_shape(ailayer_t *self);
 
+/** @brief Calculate the static cost of a forward pass of the Softmax layer
+ *
+ * *Implementation of aicore_layertype.calc_cost.*
+ *
+ * Per element: Maximum search, subtraction and summation of the exponential function values and one division.
+ *
+ * @param *self The layer to calculate the cost for (the result shape has to be calculated before)
+ * @param *cost The calculated cost is written here
+ */
+void ailayer_softmax_calc_cost(const ailayer_t *self, aicore_layercost_t *cost);
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 /** @brief Print the layer specification
  *
@@ -28,11 +28,12 @@
 const aicore_layertype_t ailayer_softsign_type_s = {
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
     .name = "Softsign",
-	.print_specs = ailayer_softsign_print_specs
+	.print_specs = ailayer_softsign_print_specs,
 #else
     .name = 0,
-    .print_specs = 0
+    .print_specs = 0,
 #endif
+	.calc_cost = ailayer_softsign_calc_cost
 };
 const aicore_layertype_t *ailayer_softsign_type = &ailayer_softsign_type_s;
 
@@ -56,12 +57,14 @@ ailayer_t *ailayer_softsign(ailayer_softsign_t *layer, ailayer_t *input_layer)
 
 	layer->base.forward = ailayer_softsign_forward;
 	layer->base.backward = ailayer_softsign_backward;
+	layer->base.backward_sgd = 0;
 
 	layer->base.calc_result_shape = ailayer_softsign_calc_result_shape;
 	layer->base.sizeof_paramem = 0;
 	layer->base.set_paramem = 0;
 	layer->base.sizeof_trainmem = 0;
 	layer->base.set_trainmem = 0;
+	layer->base.result_in_place = FALSE;
 
 	layer->base.trainable_params_count = 0;
 
@@ -75,6 +78,12 @@ void ailayer_softsign_backward(ailayer_t *self)
 	aitensor_t *delta_out = &(self->output_layer->deltas);
 	aitensor_t *x_in = &(self->input_layer->result);
 
+	if(layer->softsign_backward != 0){
+		// delta_in = delta_out .* softsign'(x_in) in one pass
+		layer->softsign_backward(x_in, delta_out, delta_in);
+		return;
+	}
+
 	int8_t temp_result_params[aimath_sizeof_tensor_params(x_in) + 1]; // +1 to prevent array of size 0
 	int8_t temp_result_data[aimath_sizeof_tensor_data(x_in)];
 	aitensor_t temp_result = {
@@ -112,6 +121,20 @@ void ailayer_softsign_calc_result_shape(ailayer_t *self)
 	return;
 }
 
+void ailayer_softsign_calc_cost(const ailayer_t *self, aicore_layercost_t *cost)
+{
+	uint32_t elements = aimath_tensor_elements(&(self->result));
+
+	// Per element: Absolute value, addition and division
+	cost->ops = 2 * elements;
+	cost->special_ops = elements;
+	cost->bytes_read = aimath_sizeof_tensor_data(&(self->input_layer->result));
+	cost->bytes_written = aimath_sizeof_tensor_data(&(self->result));
+	cost->parameter_bytes = 0;
+	cost->activation_bytes = aimath_sizeof_tensor_data(&(self->result));
+	return;
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 void ailayer_softsign_print_specs(const ailayer_t *self, int (*print)(const char *format, ...))
 {
@@ -90,6 +90,17 @@ struct ailayer_softsign {
 	 */
 	void (*multiply)(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
 
+	/** @brief Optional math function: Fused backward pass
+	 *
+	 * Calculates the deltas for the previous layer in one pass without an intermediate tensor:\n
+     * @f[
+     *  \delta_{in,i} = \delta_{out,i} \cdot \frac{1}{(1 + |x_i|)^2}
+     * @f]
+     *
+     * If not set (0), the derivative and the multiplication functions are used.
+	 */
+	void (*softsign_backward)(const aitensor_t *x, const aitensor_t *delta_out, aitensor_t *delta_in);
+
 	///@}
 };
 
@@ -152,6 +163,7 @@ void ailayer_softsign_forward(ailayer_t *self);
  * \f$ \delta_{out} \f$:	 Result of the backward pass of the next layer\n\n
  *
  * Used math functions:
+ * * ailayer_softsign.softsign_backward (if set, otherwise the following functions)
  * * ailayer_softsign.softsign
  * * ailayer_softsign.d_softsign
  * * ailayer_softsign.multiply
@@ -171,6 +183,17 @@ void ailayer_softsign_backward(ailayer_t *self);
  */
 void ailayer_softsign_calc_result_shape(ailayer_t *self);
 
+/** @brief Calculate the static cost of a forward pass of the Softsign layer
+ *
+ * *Implementation of aicore_layertype.calc_cost.*
+ *
+ * Per element: Absolute value, addition and division.
+ *
+ * @param *self The layer to calculate the cost for (the result shape has to be calculated before)
+ * @param *cost The calculated cost is written here
+ */
+void ailayer_softsign_calc_cost(const ailayer_t *self, aicore_layercost_t *cost);
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 /** @brief Print the layer specification
  *
@@ -28,11 +28,12 @@
 const aicore_layertype_t ailayer_template_type_s = {
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
     .name = "Template",
-	.print_specs = ailayer_template_print_specs
+	.print_specs = ailayer_template_print_specs,
 #else
     .name = 0,
-    .print_specs = 0
+    .print_specs = 0,
 #endif
+	.calc_cost = ailayer_template_calc_cost
 };
 const aicore_layertype_t *ailayer_template_type = &ailayer_template_type_s;
 
@@ -55,12 +56,14 @@ ailayer_t *ailayer_template(ailayer_template_t *layer, ailayer_t *input_layer)
 	// Set the function pointers
 	layer->base.forward = ailayer_template_forward;
 	layer->base.backward = ailayer_template_backward;
+	layer->base.backward_sgd = 0;
 
 	layer->base.calc_result_shape = ailayer_template_calc_result_shape;
 	layer->base.sizeof_paramem = ailayer_template_sizeof_paramem;
 	layer->base.set_paramem = ailayer_template_set_paramem;
 	layer->base.sizeof_paramem = ailayer_template_sizeof_trainmem;
 	layer->base.set_trainmem = ailayer_template_set_trainmem;
+	layer->base.result_in_place = FALSE;
 
 	return &layer->base;
 }
@@ -203,6 +206,20 @@ void ailayer_template_set_trainmem(ailayer_t *self, void *memory_ptr)
 	return;
 }
 
+void ailayer_template_calc_cost(const ailayer_t *self, aicore_layercost_t *cost)
+{
+	uint32_t elements = aimath_tensor_elements(&(self->result));
+
+	// Per element: One addition (x_out = x_in + params)
+	cost->ops = elements;
+	cost->special_ops = 0;
+	cost->bytes_read = 2 * aimath_sizeof_tensor_data(&(self->input_layer->result));
+	cost->bytes_written = aimath_sizeof_tensor_data(&(self->result));
+	cost->parameter_bytes = aimath_sizeof_tensor_data(&(self->result));
+	cost->activation_bytes = aimath_sizeof_tensor_data(&(self->result));
+	return;
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 void ailayer_template_print_specs(const ailayer_t *self, int (*print)(const char *format, ...))
 {
@@ -119,6 +119,17 @@ uint32_t ailayer_template_sizeof_trainmem(const ailayer_t *self);
  */
 void ailayer_template_set_trainmem(ailayer_t *self, void *memory_ptr);
 
+/** @brief Calculate the static cost of a forward pass of the Template layer
+ *
+ * *Implementation of aicore_layertype.calc_cost.*
+ *
+ * Per element: One addition (x_out = x_in + params).
+ *
+ * @param *self The layer to calculate the cost for (the result shape has to be calculated before)
+ * @param *cost The calculated cost is written here
+ */
+void ailayer_template_calc_cost(const ailayer_t *self, aicore_layercost_t *cost);
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 /** @brief Print the layer specification
  *
@@ -49,6 +49,7 @@ ailoss_t *ailoss_crossentropy(ailoss_crossentropy_t *loss, ailayer_t *input_laye
 
 	loss->base.calc_delta = ailoss_crossentropy_calc_delta;
 	loss->base.calc_loss = ailoss_crossentropy_calc_loss;
+	loss->base.calc_delta_and_loss = ailoss_crossentropy_calc_delta_and_loss;
 
 	// Check for valid input and override the backward function (not needed)
 	if(input_layer->layer_type == ailayer_softmax_type || input_layer->layer_type == ailayer_sigmoid_type){
@@ -95,6 +96,15 @@ void ailoss_crossentropy_calc_loss(ailoss_t *self, const aitensor_t *target_data
 	return;
 }
 
+void ailoss_crossentropy_calc_delta_and_loss(ailoss_t *self, const aitensor_t *target_data, void *result)
+{
+	// Loss before the deltas, in case the deltas share the memory with the predictions
+	ailoss_crossentropy_calc_loss(self, target_data, result);
+	ailoss_crossentropy_calc_delta(self, target_data);
+
+	return;
+}
+
 void ailoss_crossentropy_dummy_backward(ailayer_t *self)
 {
 	return;
@@ -179,6 +179,23 @@ void ailoss_crossentropy_calc_delta(ailoss_t *self, const aitensor_t *target_dat
  */
 void ailoss_crossentropy_calc_loss(ailoss_t *self, const aitensor_t *target_data, void *result);
 
+/** @brief Calculate the combined derivative and the loss of the given Cross-Entropy loss in one call
+ *
+ * *Implementation of ailoss.calc_delta_and_loss.*
+ *
+ * Calculates the loss like ailoss_crossentropy_calc_loss() on the current predictions and afterwards the deltas like
+ * ailoss_crossentropy_calc_delta(), so no additional forward pass is needed to monitor the loss during training.
+ *
+ * Used math functions:
+ * * ailoss_crossentropy.crossentropy
+ * * ailoss_crossentropy.tensor_sub
+ *
+ * @param *self         Loss to calculate the deltas and the loss for
+ * @param *target_data  Target data / True values / Labels
+ * @param *result       Result scalar (the data type is specified by the data type specific implementations)
+ */
+void ailoss_crossentropy_calc_delta_and_loss(ailoss_t *self, const aitensor_t *target_data, void *result);
+
 /** @brief Dummy backward-function for the output layer of the model
  *
  * *Implementation of ailayer.backward.*
@@ -0,0 +1,139 @@
+/**
+ * \file basic/base/ailoss/ailoss_distillation.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See ailoss_distillation.h for documentation.
+ * \details
+ */
+
+#include "basic/base/ailoss/ailoss_distillation.h"
+#include "basic/base/ailoss/ailoss_crossentropy.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+const aicore_losstype_t ailoss_distillation_type_s = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = "Distillation",
+	.print_specs = ailoss_distillation_print_specs
+#else
+    .name = 0,
+    .print_specs = 0
+#endif
+};
+const aicore_losstype_t *ailoss_distillation_type = &ailoss_distillation_type_s;
+
+ailoss_t *ailoss_distillation(ailoss_distillation_t *loss, ailayer_t *input_layer)
+{
+    loss->base.loss_type = ailoss_distillation_type;
+
+	loss->base.connection_layer.input_layer = input_layer;
+	input_layer->output_layer = &(loss->base.connection_layer);
+
+	loss->base.loss_configuration = loss;
+
+	loss->base.connection_layer.deltas.dtype = loss->dtype;
+
+	loss->base.calc_delta = ailoss_distillation_calc_delta;
+	loss->base.calc_loss = ailoss_distillation_calc_loss;
+	loss->base.calc_delta_and_loss = 0;
+
+	// The combined deltas are calculated for the inputs of the Softmax layer
+	if(input_layer->layer_type == ailayer_softmax_type){
+        input_layer->backward = ailoss_crossentropy_dummy_backward;
+    }
+    else{
+        #ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+            printf("\n!!! ERROR !!! (ailoss_distillation): No valid input layer. Use Softmax as input.\n");
+        #endif
+        return 0;
+    }
+
+	return &loss->base;
+}
+
+// Tensor with the teacher logits of the sample that belongs to the given part of the target tensor
+static uint8_t ailoss_distillation_teacher_rows(ailoss_distillation_t *loss, const aitensor_t *target_data, aitensor_t *teacher_rows)
+{
+	uint32_t index;
+	uint32_t row_size = aimath_sizeof_tensor_data(target_data) / target_data->shape[0];
+	uint32_t teacher_row_size = aimath_sizeof_tensor_data(loss->teacher_logits) / loss->teacher_logits->shape[0];
+
+	index = (uint32_t) ((const uint8_t *) target_data->data - (const uint8_t *) loss->target_tensor->data) / row_size;
+	if((const uint8_t *) target_data->data < (const uint8_t *) loss->target_tensor->data
+	   || index + target_data->shape[0] > loss->teacher_logits->shape[0]){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("The target data is not part of the target tensor of the distillation loss.\n");
+#endif
+		return 1;
+	}
+
+	*teacher_rows = *(loss->teacher_logits);
+	teacher_rows->shape = target_data->shape;
+	teacher_rows->data = loss->teacher_logits->data + index * teacher_row_size;
+	return 0;
+}
+
+void ailoss_distillation_calc_delta(ailoss_t *self, const aitensor_t *target_data)
+{
+	ailoss_distillation_t *loss = (ailoss_distillation_t *)(self->loss_configuration);
+	ailayer_t *softmax_layer = self->connection_layer.input_layer;
+	aitensor_t *predicted_data = &(softmax_layer->result);
+	aitensor_t *logits = &(softmax_layer->input_layer->result);
+	aitensor_t *deltas = &(softmax_layer->deltas);
+	aitensor_t teacher_rows;
+
+	if(ailoss_distillation_teacher_rows(loss, target_data, &teacher_rows) != 0){
+		return;
+	}
+
+	deltas->shape = predicted_data->shape;
+
+	// dC/dz directly (the backward function of the Softmax layer is not used)
+	loss->distillation_delta(logits, predicted_data, target_data, &teacher_rows, loss->temperature, loss->alpha, deltas);
+
+	return;
+}
+
+void ailoss_distillation_calc_loss(ailoss_t *self, const aitensor_t *target_data, void *result)
+{
+	ailoss_distillation_t *loss = (ailoss_distillation_t *)(self->loss_configuration);
+	ailayer_t *softmax_layer = self->connection_layer.input_layer;
+	aitensor_t teacher_rows;
+
+	if(ailoss_distillation_teacher_rows(loss, target_data, &teacher_rows) != 0){
+		return;
+	}
+
+	loss->distillation_loss(&(softmax_layer->input_layer->result), &(softmax_layer->result), target_data, &teacher_rows,
+							loss->temperature, loss->alpha, result);
+
+	return;
+}
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+void ailoss_distillation_print_specs(const ailoss_t *self, int (*print)(const char *format, ...))
+{
+    ailoss_distillation_t *loss = (ailoss_distillation_t *)(self->loss_configuration);
+
+    print("T: ");
+    loss->dtype->print_aiscalar(loss->temperature, print);
+    print("; alpha: ");
+    loss->dtype->print_aiscalar(loss->alpha, print);
+    return;
+}
+#endif
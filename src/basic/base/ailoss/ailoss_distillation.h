@@ -0,0 +1,158 @@
+/**
+ * \file basic/base/ailoss/ailoss_distillation.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Base \link ailoss loss \endlink implementation of a knowledge distillation loss
+ *
+ * This is an "abstract" data-type independent implementation. To use the loss, use one of the provided
+ * implementations for a specific hardware and data-type (for example from ailoss_distillation_default.h) or set
+ * the required math functions on your own.
+ *
+ * The distillation loss trains a small student model with the outputs of a bigger teacher model. It combines the
+ * Kullback-Leibler divergence between the soft targets of the teacher and the soft predictions of the student
+ * (both calculated with the temperature T) and the Cross-Entropy on the hard labels:
+ * @f[
+ *  L = \alpha \cdot T^2 \cdot KL \left( softmax \left( \frac{t}{T} \right) \middle\| softmax \left( \frac{z}{T} \right) \right)
+ *      + (1 - \alpha) \cdot CE(y, softmax(z))
+ * @f]
+ * with the logits of the student \f$ z \f$, the logits of the teacher \f$ t \f$ and the one-hot encoded labels
+ * \f$ y \f$. The loss <b>works only with a \link ailayer_softmax.h Softmax \endlink output layer</b>.
+ *
+ * The teacher logits are not calculated during the training. They are read from a precomputed tensor with one row per
+ * training sample (for example a constant array in flash memory or a memory-mapped file), so the distillation costs
+ * the same as a normal training.
+ * To find the row of the current sample, the loss compares the target data with the target tensor that is given
+ * to aialgo_train_model(). Therefore the target_tensor field must point to the same tensor that is used for training
+ * and the teacher logits must have the same order as the targets. The normal batching and shuffling-free data
+ * handling of aialgo_train_model() and aialgo_calc_loss_model_f32() works without changes.
+ */
+
+#ifndef DISTILLATION_LOSS
+#define DISTILLATION_LOSS
+
+#include "core/aifes_core.h"
+#include "basic/base/ailayer/ailayer_softmax.h"
+
+typedef struct ailoss_distillation 	ailoss_distillation_t; /**< New data type name for code reduction. */
+
+/** @brief General \link ailoss_distillation.h distillation loss \endlink struct
+*
+*/
+struct ailoss_distillation {
+	ailoss_t base; /**< Inherited field members from general ailoss struct. */
+	const aimath_dtype_t *dtype; /**< Main data type of the loss. */
+
+	/** @name Configuration
+	 * @brief Required configuration parameters
+	 */
+	///@{
+	void *temperature; /**< Temperature T of the soft targets (for example 4). */
+	void *alpha; /**< Weight of the soft target loss (between 0 and 1). */
+	const aitensor_t *teacher_logits; /**< Precomputed logits of the teacher with one row per training sample. */
+	const aitensor_t *target_tensor; /**< The complete target tensor that is used for training (to find the sample index). */
+	///@}
+
+	/** @name Math functions
+	 * @brief Required data type specific math functions
+	 */
+	///@{
+
+	/** @brief Required math function: Deltas of the distillation loss with respect to the student logits
+	 *
+	 * @f[
+	 *  result = \alpha \cdot T \cdot \left( softmax \left( \frac{z}{T} \right) - softmax \left( \frac{t}{T} \right) \right) + (1 - \alpha) \cdot (p - y)
+	 * @f]
+	 */
+	void (*distillation_delta)(const aitensor_t *logits, const aitensor_t *probabilities, const aitensor_t *target_data,
+							   const aitensor_t *teacher_logits, const void *temperature, const void *alpha, aitensor_t *result);
+
+	/** @brief Required math function: Distillation loss
+	 *
+	 * @f[
+	 *  result = \alpha \cdot T^2 \cdot KL(q \| p_T) - (1 - \alpha) \cdot \sum y \log(p)
+	 * @f]
+	 *
+	 * @param result    A Scalar of the defined data type
+	 */
+	void (*distillation_loss)(const aitensor_t *logits, const aitensor_t *probabilities, const aitensor_t *target_data,
+							  const aitensor_t *teacher_logits, const void *temperature, const void *alpha, void *result);
+
+	///@}
+};
+
+/** @brief Distillation loss type
+ *
+ * Defines the type of the loss (for example for type checks and debug prints).
+ * See aicore_losstype for more information about the loss type.
+ */
+extern const aicore_losstype_t *ailoss_distillation_type;
+
+/** @brief Initialize and connect the given distillation loss
+ *
+ * This function represents the "constructor" of the abstract distillation loss. It initializes the loss structure
+ * and connects it to the output layer of the AIfES model.\n
+ * This function is not intended to call it directly. Instead use one of the data type specific implementations
+ * (like for example ailoss_distillation_f32_default()).
+ *
+ * @param *loss         The loss to initialize.
+ * @param *input_layer  The output layer of the model (must be a Softmax layer).
+ * @return  Pointer to the (successfully) initialized loss structure.
+ */
+ailoss_t *ailoss_distillation(ailoss_distillation_t *loss, ailayer_t *input_layer);
+
+/** @brief Calculate the combined derivative of the distillation loss and the Softmax output layer
+ *
+ * *Implementation of ailoss.calc_delta.*
+ *
+ * Like ailoss_crossentropy_calc_delta(), the deltas with respect to the inputs of the Softmax layer (the logits)
+ * are calculated directly and written to the deltas tensor (ailayer.deltas) of the output layer.
+ *
+ * Used math functions:
+ * * ailoss_distillation.distillation_delta
+ *
+ * @param *self         Loss to calculate the deltas for
+ * @param *target_data  Hard labels of the current sample (a part of ailoss_distillation.target_tensor)
+ */
+void ailoss_distillation_calc_delta(ailoss_t *self, const aitensor_t *target_data);
+
+/** @brief Calculate the distillation loss on the given target data
+ *
+ * *Implementation of ailoss.calc_loss.*
+ *
+ * Used math functions:
+ * * ailoss_distillation.distillation_loss
+ *
+ * @param *self         Loss to calculate the loss for
+ * @param *target_data  Hard labels of the current sample (a part of ailoss_distillation.target_tensor)
+ * @param *result       Result scalar (the data type is specified by the data type specific implementations)
+ */
+void ailoss_distillation_calc_loss(ailoss_t *self, const aitensor_t *target_data, void *result);
+
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+/** @brief Print the loss specification
+ *
+ * @param *self The loss to print the specification for
+ * @param *print Pointer to the print function to use
+ */
+void ailoss_distillation_print_specs(const ailoss_t *self, int (*print)(const char *format, ...));
+#endif
+
+#endif // DISTILLATION_LOSS
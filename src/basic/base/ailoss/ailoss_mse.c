@@ -52,6 +52,7 @@ ailoss_t *ailoss_mse(ailoss_mse_t *loss, ailayer_t *input_layer)
 
 	loss->base.calc_delta = ailoss_mse_calc_delta;
 	loss->base.calc_loss = ailoss_mse_calc_loss;
+	loss->base.calc_delta_and_loss = ailoss_mse_calc_delta_and_loss;
 
 	return &loss->base;
 }
@@ -91,6 +92,24 @@ void ailoss_mse_calc_loss(ailoss_t *self, const aitensor_t *target_data, void *r
 	return;
 }
 
+void ailoss_mse_calc_delta_and_loss(ailoss_t *self, const aitensor_t *target_data, void *result)
+{
+	ailoss_mse_t *loss = (ailoss_mse_t *)(self->loss_configuration);
+	aitensor_t *predicted_data = &(self->connection_layer.input_layer->result);
+	aitensor_t *deltas = &(self->connection_layer.deltas);
+
+	if(loss->tensor_sub_norm_squared != 0){
+		loss->tensor_sub_norm_squared(predicted_data, target_data, deltas, result);
+		return;
+	}
+
+	// The deltas are the residuals of the loss
+	loss->tensor_sub(predicted_data, target_data, deltas);
+	loss->norm_squared(deltas, result);
+
+	return;
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 void ailoss_mse_print_specs(const ailoss_t *self, int (*print)(const char *format, ...))
 {
@@ -77,6 +77,17 @@ struct ailoss_mse {
 	 */
 	void (*norm_squared)(const aitensor_t *x, void *result);
 
+	/** @brief Optional math function: Element wise tensor subtraction with squared sum
+	 *
+	 * Subtracts two tensors element wise and calculates the squared sum of the differences in the same pass:\n
+     * @f[
+     *  result = a - b, \quad norm = \sum_i (a_i - b_i)^2
+     * @f]
+     *
+     * If not set (0), ailoss_mse_calc_delta_and_loss() uses ailoss_mse.tensor_sub and ailoss_mse.norm_squared.
+	 */
+	void (*tensor_sub_norm_squared)(const aitensor_t *a, const aitensor_t *b, aitensor_t *result, void *norm);
+
 	///@}
 };
 
@@ -150,6 +161,24 @@ void ailoss_mse_calc_delta(ailoss_t *self, const aitensor_t *target_data);
  */
 void ailoss_mse_calc_loss(ailoss_t *self, const aitensor_t *target_data, void *result);
 
+/** @brief Calculate the derivative and the loss of the given MSE loss in the same pass
+ *
+ * *Implementation of ailoss.calc_delta_and_loss.*
+ *
+ * Writes the deltas like ailoss_mse_calc_delta() and the loss like ailoss_mse_calc_loss(). The squared sum is
+ * calculated from the residuals \f$ p - y \f$ that are needed for the deltas anyway.
+ *
+ * Used math functions:
+ * * ailoss_mse.tensor_sub_norm_squared (if set, otherwise the following functions)
+ * * ailoss_mse.tensor_sub
+ * * ailoss_mse.norm_squared
+ *
+ * @param *self         Loss to calculate the deltas and the loss for
+ * @param *target_data  Target data / True values / Labels
+ * @param *result       Result scalar (the data type is specified by the data type specific implementations)
+ */
+void ailoss_mse_calc_delta_and_loss(ailoss_t *self, const aitensor_t *target_data, void *result);
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 /** @brief Print the loss specification
  *
@@ -74,5 +74,102 @@ uint32_t aimath_sizeof_tensor_params(const aitensor_t *tensor)
 
 uint32_t aimath_sizeof_tensor(const aitensor_t *tensor)
 {
-	return sizeof(aitensor_t) + aimath_sizeof_tensor_data(tensor) + aimath_sizeof_tensor_params(tensor);
+	return AIMATH_ALIGN_SIZE(sizeof(aitensor_t) + aimath_sizeof_tensor_data(tensor) + aimath_sizeof_tensor_params(tensor));
+}
+
+uint8_t aimath_broadcast_result_shape(const aitensor_t *a, const aitensor_t *b, uint16_t *shape)
+{
+	uint8_t i;
+	uint8_t dim = a->dim > b->dim ? a->dim : b->dim;
+	uint16_t a_size, b_size;
+
+	if(dim > AIMATH_BROADCAST_MAX_DIM){
+		return 0;
+	}
+	for(i = 0; i < dim; i++)
+	{
+		// Aligned at the last dimension, missing dimensions have size 1
+		a_size = i + a->dim >= dim ? a->shape[i + a->dim - dim] : 1;
+		b_size = i + b->dim >= dim ? b->shape[i + b->dim - dim] : 1;
+		if(a_size != b_size && a_size != 1 && b_size != 1){
+			return 0;
+		}
+		shape[i] = a_size > b_size ? a_size : b_size;
+	}
+	return dim;
+}
+
+uint8_t aimath_broadcast_plan(const aitensor_t *a, const aitensor_t *b, aimath_broadcast_plan_t *plan)
+{
+	int8_t i;
+	uint8_t dim, merged = 0;
+	uint16_t shape[AIMATH_BROADCAST_MAX_DIM];
+	uint16_t a_size, b_size;
+	uint32_t a_step = 1, b_step = 1;
+	uint32_t a_stride, b_stride;
+
+	dim = aimath_broadcast_result_shape(a, b, shape);
+	if(dim == 0){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("The shapes of the broadcasting operation are not compatible.\n");
+#endif
+		return 1;
+	}
+
+	// From the last to the first dimension; the merged dimensions are stored in reverse order first
+	plan->elements = 1;
+	for(i = dim - 1; i >= 0; i--)
+	{
+		a_size = i + a->dim >= dim ? a->shape[i + a->dim - dim] : 1;
+		b_size = i + b->dim >= dim ? b->shape[i + b->dim - dim] : 1;
+		plan->elements *= shape[i];
+		if(shape[i] == 1) continue;
+
+		a_stride = a_size == 1 ? 0 : a_step;
+		b_stride = b_size == 1 ? 0 : b_step;
+		if(merged > 0
+		   && a_stride == (plan->a_stride[merged - 1] == 0 ? 0 : plan->a_stride[merged - 1] * plan->shape[merged - 1])
+		   && b_stride == (plan->b_stride[merged - 1] == 0 ? 0 : plan->b_stride[merged - 1] * plan->shape[merged - 1])){
+			// Continues the inner dimension in both tensors
+			plan->shape[merged - 1] *= shape[i];
+		} else {
+			plan->shape[merged] = shape[i];
+			plan->a_stride[merged] = a_stride;
+			plan->b_stride[merged] = b_stride;
+			merged++;
+		}
+		a_step *= a_size;
+		b_step *= b_size;
+	}
+
+	// Reverse to the order from the first to the last dimension
+	for(i = 0; i < merged / 2; i++)
+	{
+		a_stride = plan->shape[i]; plan->shape[i] = plan->shape[merged - 1 - i]; plan->shape[merged - 1 - i] = a_stride;
+		a_stride = plan->a_stride[i]; plan->a_stride[i] = plan->a_stride[merged - 1 - i]; plan->a_stride[merged - 1 - i] = a_stride;
+		b_stride = plan->b_stride[i]; plan->b_stride[i] = plan->b_stride[merged - 1 - i]; plan->b_stride[merged - 1 - i] = b_stride;
+	}
+	if(merged == 0){
+		// Single element
+		plan->shape[0] = 1;
+		plan->a_stride[0] = 1;
+		plan->b_stride[0] = 1;
+		merged = 1;
+	}
+	plan->dim = merged;
+
+	if(merged == 1){
+		plan->kind = plan->a_stride[0] == 0 ? AIMATH_BROADCAST_SCALAR_A : (plan->b_stride[0] == 0 ? AIMATH_BROADCAST_SCALAR_B : AIMATH_BROADCAST_SAME);
+	} else if(merged == 2 && plan->a_stride[0] == 0 && plan->a_stride[1] == 1 && plan->b_stride[1] == 1){
+		plan->kind = AIMATH_BROADCAST_ROW_A;
+	} else if(merged == 2 && plan->b_stride[0] == 0 && plan->b_stride[1] == 1 && plan->a_stride[1] == 1){
+		plan->kind = AIMATH_BROADCAST_ROW_B;
+	} else if(merged == 2 && plan->a_stride[0] == 1 && plan->a_stride[1] == 0 && plan->b_stride[0] == plan->shape[1] && plan->b_stride[1] == 1){
+		plan->kind = AIMATH_BROADCAST_COLUMN_A;
+	} else if(merged == 2 && plan->b_stride[0] == 1 && plan->b_stride[1] == 0 && plan->a_stride[0] == plan->shape[1] && plan->a_stride[1] == 1){
+		plan->kind = AIMATH_BROADCAST_COLUMN_B;
+	} else {
+		plan->kind = AIMATH_BROADCAST_GENERAL;
+	}
+	return 0;
 }
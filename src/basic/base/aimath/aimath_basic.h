@@ -29,6 +29,45 @@
 
 #include "core/aifes_math.h"
 
+#define AIMATH_MEMORY_ALIGNMENT     sizeof(void *) /**< Alignment of the blocks in the memory that is distributed by AIfES (tensor structs must be aligned on strict alignment MCUs) */
+
+/** @brief Round up a memory size in bytes to a multiple of AIMATH_MEMORY_ALIGNMENT */
+#define AIMATH_ALIGN_SIZE(size)     ((((size) + AIMATH_MEMORY_ALIGNMENT - 1) / AIMATH_MEMORY_ALIGNMENT) * AIMATH_MEMORY_ALIGNMENT)
+
+#define AIMATH_BROADCAST_MAX_DIM    6 /**< Maximum dimension of the tensors of a broadcasting operation */
+
+#define AIMATH_BROADCAST_SAME       0 /**< Broadcast kind: a and b have the same shape (one contiguous loop) */
+#define AIMATH_BROADCAST_SCALAR_A   1 /**< Broadcast kind: a has only one element */
+#define AIMATH_BROADCAST_SCALAR_B   2 /**< Broadcast kind: b has only one element */
+#define AIMATH_BROADCAST_ROW_A      3 /**< Broadcast kind: a is a row vector that is repeated for every row of b (for example [1 x K] and [N x K]) */
+#define AIMATH_BROADCAST_ROW_B      4 /**< Broadcast kind: b is a row vector that is repeated for every row of a (for example [N x K] and [1 x K]) */
+#define AIMATH_BROADCAST_COLUMN_A   5 /**< Broadcast kind: a is a column vector that is repeated for every column of b (for example [N x 1] and [N x K]) */
+#define AIMATH_BROADCAST_COLUMN_B   6 /**< Broadcast kind: b is a column vector that is repeated for every column of a (for example [N x K] and [N x 1]) */
+#define AIMATH_BROADCAST_GENERAL    7 /**< Broadcast kind: Any other combination of shapes */
+
+#define AIMATH_BROADCAST_ADD        0 /**< Broadcast operation: result = a + b */
+#define AIMATH_BROADCAST_SUB        1 /**< Broadcast operation: result = a - b */
+#define AIMATH_BROADCAST_MULTIPLY   2 /**< Broadcast operation: result = a * b */
+#define AIMATH_BROADCAST_DIVIDE     3 /**< Broadcast operation: result = a / b */
+
+typedef struct aimath_broadcast_plan  aimath_broadcast_plan_t;
+
+/** @brief Precomputed iteration plan of an element wise operation with broadcasting
+ *
+ * The shapes of a and b are aligned at the last dimension and a dimension of size 1 (or a missing dimension) is
+ * repeated to the size of the other tensor (numpy broadcasting rules). Neighboring dimensions that are iterated in
+ * the same way are merged, so most operations need only one or two loops. The plan can be calculated once
+ * (for example when the result shape of a layer is calculated) and used for every forward pass.
+ */
+struct aimath_broadcast_plan {
+	uint8_t kind; /**< Kind of the broadcasting (AIMATH_BROADCAST_SAME, AIMATH_BROADCAST_ROW_B, ...) for the fast paths. */
+	uint8_t dim; /**< Number of merged dimensions. */
+	uint32_t shape[AIMATH_BROADCAST_MAX_DIM]; /**< Merged shape of the result. */
+	uint32_t a_stride[AIMATH_BROADCAST_MAX_DIM]; /**< Step in a for every merged dimension in elements (0 if repeated). */
+	uint32_t b_stride[AIMATH_BROADCAST_MAX_DIM]; /**< Step in b for every merged dimension in elements (0 if repeated). */
+	uint32_t elements; /**< Number of elements of the result. */
+};
+
 /** @brief Printing a tensor to console
  *
  * Calls the corresponding print function of the used aimath_dtype.
@@ -111,13 +150,47 @@ uint32_t aimath_sizeof_tensor_params(const aitensor_t *tensor);
  *
  * The size is calculated by:
  *
- * \code sizeof(aitensor_t) + aimath_sizeof_tensor_data(tensor) + aimath_sizeof_tensor_params(tensor) \endcode
+ * \code AIMATH_ALIGN_SIZE(sizeof(aitensor_t) + aimath_sizeof_tensor_data(tensor) + aimath_sizeof_tensor_params(tensor)) \endcode
+ *
+ * The size is rounded up, so that a following tensor struct is aligned.
  *
  * @param *tensor	The tensor to get the size of
  * @return Size of tensor in bytes
  */
 uint32_t aimath_sizeof_tensor(const aitensor_t *tensor);
 
+/** @brief Calculates the result shape of an element wise operation with broadcasting
+ *
+ * The shapes are aligned at the last dimension. Two sizes are compatible if they are equal or one of them is 1,
+ * the result has the larger size. For example [N x K] and [1 x K] give [N x K], [N x C x H x W] and [C x 1 x 1]
+ * give [N x C x H x W].
+ *
+ * @param *a        Tensor a
+ * @param *b        Tensor b
+ * @param *shape    Array with AIMATH_BROADCAST_MAX_DIM elements for the resulting shape
+ * @return          Dimension of the result or 0 if the shapes are not compatible
+ */
+uint8_t aimath_broadcast_result_shape(const aitensor_t *a, const aitensor_t *b, uint16_t *shape);
+
+/** @brief Calculates the iteration plan of an element wise operation with broadcasting
+ *
+ * See aimath_broadcast_plan for more information.
+ *
+ * Example:
+ * \code{.c}
+ * aimath_broadcast_plan_t plan;
+ *
+ * aimath_broadcast_plan(&x, &bias, &plan); // plan.kind == AIMATH_BROADCAST_ROW_B for x [N x K] and bias [1 x K]
+ * aimath_f32_default_broadcast(&plan, AIMATH_BROADCAST_ADD, &x, &bias, &result);
+ * \endcode
+ *
+ * @param *a        Tensor a
+ * @param *b        Tensor b
+ * @param *plan     The plan is written here
+ * @return          0 if successful, 1 if the shapes are not compatible
+ */
+uint8_t aimath_broadcast_plan(const aitensor_t *a, const aitensor_t *b, aimath_broadcast_plan_t *plan);
+
 //void aimath_create_tensor_2d(uint16_t shape_0, uint16_t shape_1, aimath_dtype_t dtype, void *memory_ptr);
 
 #endif // AIMATH_BASIC
@@ -0,0 +1,117 @@
+/**
+ * \file basic/base/aimath/aimath_q15.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief 	Definition of the Q15 (aiq15) data-type
+ *
+ * The Q15 (aiq15) data-type stores data as 16 bit signed integer values with a power of two scale
+ * (block floating point). The real values are calculated with the shift of the tensor:
+ * @f[
+ *  r = q \cdot 2^{-shift}
+ * @f]
+ * The shift is stored in the tensor_params of the tensor (see aimath_q15_params) and is managed automatically by the
+ * math functions: Every result gets the shift that uses the full value range without an overflow.
+ * Negative shifts are allowed for values larger than the integer range.
+ *
+ * **Example: Create a Q15 tensor**\n
+ * The tensor
+ * @f[
+ * \left( \begin{array}{rrr} 0 & 1 & 2 \\ 3 & 4 & 5 \end{array}\right)
+ * @f]
+ * can be created with
+ * \code{.c}
+ * aimath_q15_params_t example_params = {
+ *     .shift = 11
+ * };
+ * int16_t example_data[] = {0, 2048, 4096,
+ *                           6144, 8192, 10240};
+ * uint16_t example_shape[] = {2, 3};
+ * aitensor_t example_tensor = AITENSOR_2D_Q15(example_shape, &example_params, example_data);
+ * \endcode
+ *
+ * **Example: Print a Q15 tensor to the console**
+ * \code{.c}
+ * print_aitensor(&example_tensor);
+ * \endcode
+ */
+
+#ifndef AIMATH_Q15
+#define AIMATH_Q15
+
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+/** @brief Initialize a 2 dimensional Q15 tensor
+ *
+ * @param shape     A uint16_t array of length 2 for the shape
+ * @param params    Pointer to the aimath_q15_params_t of the tensor
+ * @param data      A int16_t array for the tensor data
+ */
+#define AITENSOR_2D_Q15(shape, params, data)    {aiq15, 2, shape, params, data}
+
+typedef struct aimath_q15_params    aimath_q15_params_t;
+typedef struct aiscalar_q15         aiscalar_q15_t;
+
+/** @brief Quantization parameters of a Q15 tensor (tensor_params)
+ */
+struct aimath_q15_params {
+	int16_t shift; /**< Number of fractional bits (real value = q * 2^-shift). */
+};
+
+/** @brief Scalar for the Q15 (aiq15) data-type
+ */
+struct aiscalar_q15 {
+	int16_t value; /**< Integer value. */
+	int16_t shift; /**< Number of fractional bits (real value = value * 2^-shift). */
+};
+
+/** @brief Printing a Q15 tensor to console
+ *
+ * For users the function
+ * \code{.c}
+ * print_aitensor(&tensor);
+ * \endcode
+ * is prefered.
+ *
+ * @param *tensor	The tensor to print.
+ */
+void aimath_q15_print_aitensor(const aitensor_t *tensor);
+
+/** @brief Printing a Q15 scalar to console
+ *
+ * For users the function
+ * \code{.c}
+ * print_aiscalar(&scalar, aiq15);
+ * \endcode
+ * is prefered.
+ *
+ * @param *scalar	The scalar (type: aiscalar_q15_t) to print.
+ * @param *print	The print function to use
+ */
+void aimath_q15_print_aiscalar(const void *scalar, int (*print)(const char *format, ...));
+
+/** @brief The Q15 data-type indicator
+ *
+ * Use this variable to configure some element with the \link aimath_q15.h Q15 \endlink data-type,
+ */
+extern const aimath_dtype_t *aiq15;
+
+#endif // AIMATH_Q15
@@ -0,0 +1,85 @@
+/**
+ * \file basic/base/aimath/aimath_q31.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aimath_q31.h for documentation.
+ * \details
+ */
+
+#include "basic/base/aimath/aimath_q31.h"
+
+const aimath_dtype_t aiq31_s = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = "Q31",
+#else
+    .name = 0,
+#endif
+	.size = 4,
+	.tensor_params_size = sizeof(aimath_q31_params_t),
+	.print_aitensor = aimath_q31_print_aitensor,
+	.print_aiscalar = aimath_q31_print_aiscalar
+};
+
+const aimath_dtype_t *aiq31 = &aiq31_s;
+
+
+void aimath_q31_print_aitensor(const aitensor_t *tensor)
+{
+	uint16_t i, j;
+	uint16_t rows, cols;
+	int32_t *tensor_data = (int32_t *) tensor->data;
+	aimath_q31_params_t *params = (aimath_q31_params_t *) tensor->tensor_params;
+	float scale = params != 0 ? ldexpf(1.0f, -params->shift) : 1.0f;
+
+	printf("Q31 (shift: %d) [\n", params != 0 ? params->shift : 0);
+	if(tensor->dim == 1)
+	{
+		rows = 1;
+		cols = tensor->shape[0];
+	}
+	else if(tensor->dim == 2)
+	{
+		rows = tensor->shape[0];
+		cols = tensor->shape[1];
+	}
+	else
+	{
+		printf("Printing of tensors with dimension %d is not supported.\n", tensor->dim);
+		printf("]\n");
+		return;
+	}
+	for(i = 0; i < rows; i++)
+	{
+		for(j = 0; j < cols; j++)
+		{
+			printf("%10.5f\t", scale * (float) tensor_data[i*cols + j]);
+		}
+		printf("\n");
+	}
+	printf("]\n");
+	return;
+}
+
+void aimath_q31_print_aiscalar(const void *scalar, int (*print)(const char *format, ...))
+{
+	aiscalar_q31_t *scalar_q31 = (aiscalar_q31_t *) scalar;
+
+    print("%f (Q31: %ld; shift: %d)", ldexpf((float) scalar_q31->value, -scalar_q31->shift),
+		  (long) scalar_q31->value, scalar_q31->shift);
+}
@@ -0,0 +1,119 @@
+/**
+ * \file basic/base/aimath/aimath_q31.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief 	Definition of the Q31 (aiq31) data-type
+ *
+ * The Q31 (aiq31) data-type stores data as 32 bit signed integer values with a power of two scale
+ * (block floating point). The real values are calculated with the shift of the tensor:
+ * @f[
+ *  r = q \cdot 2^{-shift}
+ * @f]
+ * The shift is stored in the tensor_params of the tensor (see aimath_q31_params).
+ * Negative shifts are allowed for values larger than the integer range.
+ *
+ * The Q31 data-type is used for results that need a high precision, like accumulated sums
+ * (for example the result of aimath_q15_default_norm_squared()).
+ *
+ * **Example: Create a Q31 tensor**\n
+ * The tensor
+ * @f[
+ * \left( \begin{array}{rrr} 0 & 1 & 2 \\ 3 & 4 & 5 \end{array}\right)
+ * @f]
+ * can be created with
+ * \code{.c}
+ * aimath_q31_params_t example_params = {
+ *     .shift = 27
+ * };
+ * int32_t example_data[] = {0, 134217728, 268435456,
+ *                           402653184, 536870912, 671088640};
+ * uint16_t example_shape[] = {2, 3};
+ * aitensor_t example_tensor = AITENSOR_2D_Q31(example_shape, &example_params, example_data);
+ * \endcode
+ *
+ * **Example: Print a Q31 tensor to the console**
+ * \code{.c}
+ * print_aitensor(&example_tensor);
+ * \endcode
+ */
+
+#ifndef AIMATH_Q31
+#define AIMATH_Q31
+
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+/** @brief Initialize a 2 dimensional Q31 tensor
+ *
+ * @param shape     A uint16_t array of length 2 for the shape
+ * @param params    Pointer to the aimath_q31_params_t of the tensor
+ * @param data      A int32_t array for the tensor data
+ */
+#define AITENSOR_2D_Q31(shape, params, data)    {aiq31, 2, shape, params, data}
+
+typedef struct aimath_q31_params    aimath_q31_params_t;
+typedef struct aiscalar_q31         aiscalar_q31_t;
+
+/** @brief Quantization parameters of a Q31 tensor (tensor_params)
+ */
+struct aimath_q31_params {
+	int16_t shift; /**< Number of fractional bits (real value = q * 2^-shift). */
+};
+
+/** @brief Scalar for the Q31 (aiq31) data-type
+ */
+struct aiscalar_q31 {
+	int32_t value; /**< Integer value. */
+	int16_t shift; /**< Number of fractional bits (real value = value * 2^-shift). */
+};
+
+/** @brief Printing a Q31 tensor to console
+ *
+ * For users the function
+ * \code{.c}
+ * print_aitensor(&tensor);
+ * \endcode
+ * is prefered.
+ *
+ * @param *tensor	The tensor to print.
+ */
+void aimath_q31_print_aitensor(const aitensor_t *tensor);
+
+/** @brief Printing a Q31 scalar to console
+ *
+ * For users the function
+ * \code{.c}
+ * print_aiscalar(&scalar, aiq31);
+ * \endcode
+ * is prefered.
+ *
+ * @param *scalar	The scalar (type: aiscalar_q31_t) to print.
+ * @param *print	The print function to use
+ */
+void aimath_q31_print_aiscalar(const void *scalar, int (*print)(const char *format, ...));
+
+/** @brief The Q31 data-type indicator
+ *
+ * Use this variable to configure some element with the \link aimath_q31.h Q31 \endlink data-type,
+ */
+extern const aimath_dtype_t *aiq31;
+
+#endif // AIMATH_Q31
@@ -0,0 +1,92 @@
+/**
+ * \file basic/base/aimath/aimath_q7.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aimath_q7.h for documentation.
+ * \details
+ */
+
+#include "basic/base/aimath/aimath_q7.h"
+
+const aimath_dtype_t aiq7_s = {
+#ifdef AIDEBUG_PRINT_MODULE_SPECS
+    .name = "Q7",
+#else
+    .name = 0,
+#endif
+	.size = 1,
+	.tensor_params_size = sizeof(aimath_q7_params_t),
+	.print_aitensor = aimath_q7_print_aitensor,
+	.print_aiscalar = aimath_q7_print_aiscalar
+};
+
+const aimath_dtype_t *aiq7 = &aiq7_s;
+
+
+void aimath_q7_print_aitensor(const aitensor_t *tensor)
+{
+	uint16_t i, j;
+	uint16_t rows, cols;
+	int8_t *tensor_data = (int8_t *) tensor->data;
+	aimath_q7_params_t *params = (aimath_q7_params_t *) tensor->tensor_params;
+
+	if(params != 0){
+		printf("Q7 (scale: %f; zero point: %d) [\n", params->scale, params->zero_point);
+	} else {
+		printf("Q7 (raw) [\n");
+	}
+	if(tensor->dim == 1)
+	{
+		rows = 1;
+		cols = tensor->shape[0];
+	}
+	else if(tensor->dim == 2)
+	{
+		rows = tensor->shape[0];
+		cols = tensor->shape[1];
+	}
+	else
+	{
+		printf("Printing of tensors with dimension %d is not supported.\n", tensor->dim);
+		printf("]\n");
+		return;
+	}
+	for(i = 0; i < rows; i++)
+	{
+		for(j = 0; j < cols; j++)
+		{
+			if(params != 0){
+				printf("%10.5f\t", params->scale * (float) (tensor_data[i*cols + j] - params->zero_point));
+			} else {
+				printf("%4d\t", tensor_data[i*cols + j]);
+			}
+		}
+		printf("\n");
+	}
+	printf("]\n");
+	return;
+}
+
+void aimath_q7_print_aiscalar(const void *scalar, int (*print)(const char *format, ...))
+{
+	aiscalar_q7_t *scalar_q7 = (aiscalar_q7_t *) scalar;
+
+    print("%f (Q7: %d; scale: %f; zero point: %d)", scalar_q7->scale * (float) (scalar_q7->value - scalar_q7->zero_point),
+		  scalar_q7->value, scalar_q7->scale, scalar_q7->zero_point);
+}
@@ -0,0 +1,120 @@
+/**
+ * \file basic/base/aimath/aimath_q7.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief 	Definition of the Q7 (aiq7) data-type
+ *
+ * The Q7 (aiq7) data-type stores data as quantized 8 bit integer values.
+ * The real values are described by an affine mapping with a scale and a zero point:
+ * @f[
+ *  r = scale \cdot (q - zero\_point)
+ * @f]
+ * The quantization parameters are stored in the tensor_params of the tensor (see aimath_q7_params).
+ *
+ * **Example: Create a Q7 tensor**\n
+ * The tensor
+ * @f[
+ * \left( \begin{array}{rrr} 0 & 1 & 2 \\ 3 & 4 & 5 \end{array}\right)
+ * @f]
+ * can be created with
+ * \code{.c}
+ * aimath_q7_params_t example_params = {
+ *     .scale = 0.05f,
+ *     .zero_point = 0
+ * };
+ * int8_t example_data[] = {0, 20, 40,
+ *                          60, 80, 100};
+ * uint16_t example_shape[] = {2, 3};
+ * aitensor_t example_tensor = AITENSOR_2D_Q7(example_shape, &example_params, example_data);
+ * \endcode
+ *
+ * **Example: Print a Q7 tensor to the console**
+ * \code{.c}
+ * print_aitensor(&example_tensor);
+ * \endcode
+ */
+
+#ifndef AIMATH_Q7
+#define AIMATH_Q7
+
+#include "core/aifes_math.h"
+#include "basic/base/aimath/aimath_basic.h"
+
+/** @brief Initialize a 2 dimensional Q7 tensor
+ *
+ * @param shape     A uint16_t array of length 2 for the shape
+ * @param params    Pointer to the aimath_q7_params_t of the tensor
+ * @param data      A int8_t array for the tensor data
+ */
+#define AITENSOR_2D_Q7(shape, params, data)     {aiq7, 2, shape, params, data}
+
+typedef struct aimath_q7_params     aimath_q7_params_t;
+typedef struct aiscalar_q7          aiscalar_q7_t;
+
+/** @brief Quantization parameters of a Q7 tensor (tensor_params)
+ */
+struct aimath_q7_params {
+	float scale; /**< Scaling factor between the quantized and the real values. */
+	int8_t zero_point; /**< Quantized value that represents the real value 0. */
+};
+
+/** @brief Scalar for the Q7 (aiq7) data-type
+ */
+struct aiscalar_q7 {
+	int8_t value; /**< Quantized value. */
+	float scale; /**< Scaling factor between the quantized and the real value. */
+	int8_t zero_point; /**< Quantized value that represents the real value 0. */
+};
+
+/** @brief Printing a Q7 tensor to console
+ *
+ * The real values are printed. If the tensor has no tensor_params, the raw integer values are printed.
+ *
+ * For users the function
+ * \code{.c}
+ * print_aitensor(&tensor);
+ * \endcode
+ * is prefered.
+ *
+ * @param *tensor	The tensor to print.
+ */
+void aimath_q7_print_aitensor(const aitensor_t *tensor);
+
+/** @brief Printing a Q7 scalar to console
+ *
+ * For users the function
+ * \code{.c}
+ * print_aiscalar(&scalar, aiq7);
+ * \endcode
+ * is prefered.
+ *
+ * @param *scalar	The scalar (type: aiscalar_q7_t) to print.
+ * @param *print	The print function to use
+ */
+void aimath_q7_print_aiscalar(const void *scalar, int (*print)(const char *format, ...));
+
+/** @brief The Q7 data-type indicator
+ *
+ * Use this variable to configure some element with the \link aimath_q7.h Q7 \endlink data-type,
+ */
+extern const aimath_dtype_t *aiq7;
+
+#endif // AIMATH_Q7
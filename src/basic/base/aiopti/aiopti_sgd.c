@@ -50,6 +50,9 @@ aiopti_t *aiopti_sgd(aiopti_sgd_t *opti)
     opti->base.sizeof_optimem = 0;
     opti->base.init_optimem = 0;
 
+    // Optional math function
+    opti->scaled_sub = 0;
+
 	return &opti->base;
 }
 
@@ -143,6 +146,15 @@ void aiopti_sgd_update_params_without_momentum(aiopti_t *self, aitensor_t *param
 	return;
 }
 
+void aiopti_sgd_update_params_scaled_sub(aiopti_t *self, aitensor_t *params, const aitensor_t *gradients, void *optimem)
+{
+	aiopti_sgd_t *opti = (aiopti_sgd_t *)(self->optimizer_configuration);
+
+	// p = p - lr * g
+	opti->scaled_sub(opti->base.learning_rate, gradients, params);
+	return;
+}
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 void aiopti_sgd_print_specs(const aiopti_t *self, int (*print)(const char *format, ...))
 {
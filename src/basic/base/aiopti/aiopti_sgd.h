@@ -109,6 +109,18 @@ struct aiopti_sgd {
 	 */
 	void (*zero_tensor)(aitensor_t *tensor);
 
+	/** @brief Optional math function: Subtraction of a scaled tensor
+	 *
+	 * Requires a math function that subtracts a scaled tensor from the result tensor with the rounding mode of the
+	 * data type (for example stochastic rounding for integer types, so that small updates do not vanish):\n
+     * @f[
+     *  result = result - scalar \cdot a
+     * @f]
+     *
+     * Only required for aiopti_sgd_update_params_scaled_sub().
+	 */
+	void (*scaled_sub)(const void *scalar, const aitensor_t *a, aitensor_t *result);
+
 	///@}
 };
 
@@ -259,6 +271,32 @@ void aiopti_sgd_update_params_with_momentum(aiopti_t *self, aitensor_t *params,
  */
 void aiopti_sgd_update_params_without_momentum(aiopti_t *self, aitensor_t *params, const aitensor_t *gradients, void *optimem);
 
+/** @brief Update the given parameter tensor with respect to the gradients with a scaled subtraction (without momentum)
+ *
+ * *Implementation of aiopti.update_params.*
+ *
+ * Calculate and update the values of the trainable parameters (perform one update step) in a single math function:
+ * @f[
+ *  p_t \leftarrow p_{t-1} - lr \cdot g_t
+ * @f]
+ *
+ * \f$ p \f$:	 Tensor of trainable parameters to update (params)\n
+ * \f$ g \f$:	 Gradients\n
+ * \f$ lr \f$:	 Learning rate / Optimization step size\n\n
+ *
+ * This is used for integer data types, where the product \f$ lr \cdot g_t \f$ is usually much smaller than the
+ * resolution of the parameters and must be rounded together with the subtraction.
+ *
+ * Used math functions:
+ * * aiopti_sgd.scaled_sub
+ *
+ * @param *self         The optimizer
+ * @param *params       The tensor of trainable parameters \f$ p \f$ to update
+ * @param *gradients    The gradients \f$ g \f$ associated to the parameters
+ * @param *optimem      Not required because no momentum is used
+ */
+void aiopti_sgd_update_params_scaled_sub(aiopti_t *self, aitensor_t *params, const aitensor_t *gradients, void *optimem);
+
 #ifdef AIDEBUG_PRINT_MODULE_SPECS
 /** @brief Print the optimizer specification
  *
@@ -41,6 +41,7 @@ ailayer_t *ailayer_dense_f32_cmsis(ailayer_dense_t *layer, ailayer_t *input_laye
 	layer->linear = aimath_f32_cmsis_linear;
 	layer->mat_mul = aimath_f32_cmsis_mat_mul;
 	layer->tensor_add = aimath_f32_default_tensor_add;
+	layer->linear_backward_sgd = aimath_f32_default_linear_backward_sgd;
 
 	return ailayer_dense(layer, input_layer);
 }
@@ -33,7 +33,7 @@
 /**
 * Math CMSIS Matrix Multiplication and boradtcast Ass
 *
-* Matrixmultiplication using the CMSIS DSP Library and broadcast add using for loop
+* Matrixmultiplication and broadcast add of the bias using the CMSIS DSP Library
 *
 */
 void aimath_f32_cmsis_linear(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
@@ -52,7 +52,9 @@ void aimath_f32_cmsis_linear(const aitensor_t *a, const aitensor_t *b, const ait
 	}
 #endif
 
-	uint16_t i, j;
+	uint16_t i;
+	uint16_t rows = result->shape[0];
+	uint16_t cols = result->shape[1];
 
 	float *c_data = c != 0 ? (float *) c->data : 0;
 	float *result_data = (float *) result->data;
@@ -60,17 +62,14 @@ void aimath_f32_cmsis_linear(const aitensor_t *a, const aitensor_t *b, const ait
 
 	aimath_f32_cmsis_mat_mul(a, b, result);
 
-
-	for(i = 0; i < result->shape[0]; i++)
-	{
-		for(j = 0; j < result->shape[1]; j++)
+	if(c != 0){
+		// Bias add (row vector broadcast) with the vectorized CMSIS addition
+		for(i = 0; i < rows; i++)
 		{
-			result_data[i*result->shape[1] + j] += c_data[j];
+			arm_add_f32(&result_data[i*cols], c_data, &result_data[i*cols], cols);
 		}
 	}
 
-
-
 	return;
 }
 
@@ -0,0 +1,66 @@
+/**
+ * \file basic/default/aifeature/aifeature_mfcc_default.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aifeature_mfcc_default.h for documentation.
+ * \details
+ */
+
+#include "basic/default/aifeature/aifeature_mfcc_default.h"
+
+aifeature_mfcc_t *aifeature_mfcc_f32_default(aifeature_mfcc_f32_t *feature)
+{
+	feature->dtype = aif32;
+	feature->power_dtype = aif32;
+
+	feature->quantize_f32 = aimath_f32_default_copy_tensor;
+	feature->apply_window = aimath_f32_default_window;
+	feature->rfft = aimath_f32_default_rfft;
+	feature->power_spectrum = aimath_f32_default_power_spectrum;
+	feature->mel_filterbank = aimath_f32_default_mel_filterbank;
+	feature->log = aimath_f32_default_log;
+	feature->mat_mul = aimath_f32_default_mat_mul;
+	feature->store_frame = aimath_f32_default_copy_tensor;
+
+	aifeature_mfcc(feature);
+	feature->result.tensor_params = 0;
+
+	return feature;
+}
+
+aifeature_mfcc_t *aifeature_mfcc_q15_default(aifeature_mfcc_q15_t *feature)
+{
+	feature->base.dtype = aiq15;
+	feature->base.power_dtype = aiq31;
+
+	feature->base.quantize_f32 = aimath_q15_default_quantize_f32;
+	feature->base.apply_window = aimath_q15_default_window;
+	feature->base.rfft = aimath_q15_default_rfft;
+	feature->base.power_spectrum = aimath_q15_default_power_spectrum;
+	feature->base.mel_filterbank = aimath_q15_default_mel_filterbank;
+	feature->base.log = aimath_q15_default_log;
+	feature->base.mat_mul = aimath_q15_default_mat_mul;
+	feature->base.store_frame = aimath_q15_default_requantize;
+
+	aifeature_mfcc(&(feature->base));
+	feature->result_params.shift = feature->result_shift;
+	feature->base.result.tensor_params = &(feature->result_params);
+
+	return &(feature->base);
+}
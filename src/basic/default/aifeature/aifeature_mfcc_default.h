@@ -0,0 +1,109 @@
+/**
+ * \file basic/default/aifeature/aifeature_mfcc_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Default implementation of the \link aifeature_mfcc.h streaming MFCC feature extraction \endlink
+ *
+ * Hardware independent implementations of the feature extraction in \link aimath_f32.h F32 \endlink and
+ * \link aimath_q15.h Q15 \endlink data-type.
+ * For more information about the feature extraction refer to aifeature_mfcc.h.
+ *
+ * The Q15 implementation only uses integer arithmetic per frame (the tables are initialized once with F32), so it is
+ * suitable for microcontrollers without a floating point unit. The samples are 16 bit PCM values (Q15 with shift 15).
+ * The power spectrum and the filterbank energies are calculated in \link aimath_q31.h Q31 \endlink.
+ */
+
+#ifndef AIFEATURE_MFCC_DEFAULT
+#define AIFEATURE_MFCC_DEFAULT
+
+#include "basic/base/aifeature/aifeature_mfcc.h"
+
+#include "basic/default/aimath/aimath_f32_default.h"
+#include "basic/default/aimath/aimath_q15_default.h"
+
+typedef struct aifeature_mfcc 	aifeature_mfcc_f32_t; /**< New data type name for code reduction. */
+typedef struct aifeature_mfcc_q15 	aifeature_mfcc_q15_t; /**< New data type name for code reduction. */
+
+/** @brief Data-type specific \link aifeature_mfcc.h MFCC feature extraction \endlink struct for \link aimath_q15.h Q15 \endlink
+ *
+ * Adds the fixed quantization of the result tensor to the base implementation. All frames of the result use the same
+ * shift, so that the result can be used directly as input of a Q15 model.
+ */
+struct aifeature_mfcc_q15 {
+	aifeature_mfcc_t base; /**< Inherited field members from general aifeature_mfcc struct. */
+
+	int16_t result_shift; /**< Number of fractional bits of the features (for example 10 for log mel energies and 8 for MFCCs). */
+
+	aimath_q15_params_t result_params; /**< Storage for the tensor_params of the result tensor. */
+};
+
+/** @brief Initializes a \link aifeature_mfcc.h MFCC feature extraction \endlink with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Example:
+ * \code{.c}
+ * aifeature_mfcc_f32_t mfcc = {
+ *     .sample_rate = 16000,
+ *     .frame_length = 480,
+ *     .frame_step = 320,
+ *     .fft_length = 512,
+ *     .mel_count = 40,
+ *     .mfcc_count = 13,
+ *     .frame_count = 49,
+ *     .lower_frequency = 20.0f,
+ *     .upper_frequency = 4000.0f
+ * };
+ *
+ * aifeature_mfcc_f32_default(&mfcc);
+ * \endcode
+ *
+ * @param *feature  The feature extraction structure to initialize.
+ * @return          The (successfully) initialized feature extraction structure.
+ */
+aifeature_mfcc_t *aifeature_mfcc_f32_default(aifeature_mfcc_f32_t *feature);
+
+/** @brief Initializes a \link aifeature_mfcc.h MFCC feature extraction \endlink with the \link aimath_q15.h Q15 \endlink default implementation
+ *
+ * Example:
+ * \code{.c}
+ * aifeature_mfcc_q15_t mfcc = {
+ *     .base = {
+ *         .sample_rate = 16000,
+ *         .frame_length = 480,
+ *         .frame_step = 320,
+ *         .fft_length = 512,
+ *         .mel_count = 40,
+ *         .mfcc_count = 13,
+ *         .frame_count = 49,
+ *         .lower_frequency = 20.0f,
+ *         .upper_frequency = 4000.0f
+ *     },
+ *     .result_shift = 8
+ * };
+ *
+ * aifeature_mfcc_q15_default(&mfcc);
+ * \endcode
+ *
+ * @param *feature  The feature extraction structure to initialize.
+ * @return          The (successfully) initialized feature extraction structure.
+ */
+aifeature_mfcc_t *aifeature_mfcc_q15_default(aifeature_mfcc_q15_t *feature);
+
+#endif // AIFEATURE_MFCC_DEFAULT
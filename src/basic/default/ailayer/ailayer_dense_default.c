@@ -34,6 +34,21 @@ ailayer_t *ailayer_dense_f32_default(ailayer_dense_f32_t *layer, ailayer_t *inpu
 	layer->linear = aimath_f32_default_linear;
 	layer->mat_mul = aimath_f32_default_mat_mul;
 	layer->tensor_add = aimath_f32_default_tensor_add;
+	layer->linear_backward_sgd = aimath_f32_default_linear_backward_sgd;
+
+	return ailayer_dense(layer, input_layer);
+}
+
+ailayer_t *ailayer_dense_q15_default(ailayer_dense_q15_t *layer, ailayer_t *input_layer)
+{
+	layer->result_dtype = aiq15;
+	layer->weights_dtype = aiq15;
+	layer->bias_dtype = aiq15;
+
+	layer->linear = aimath_q15_default_linear;
+	layer->mat_mul = aimath_q15_default_mat_mul;
+	layer->tensor_add = aimath_q15_default_tensor_add;
+	layer->linear_backward_sgd = 0;
 
 	return ailayer_dense(layer, input_layer);
 }
@@ -31,8 +31,10 @@
 
 #include "basic/base/ailayer/ailayer_dense.h"
 #include "basic/default/aimath/aimath_f32_default.h"
+#include "basic/default/aimath/aimath_q15_default.h"
 
 typedef struct ailayer_dense 	ailayer_dense_f32_t;
+typedef struct ailayer_dense 	ailayer_dense_q15_t;
 
 /** @brief Initializes and connect a \link ailayer_dense.h Dense layer \endlink with the \link aimath_f32.h F32 \endlink default implementation
  *
@@ -66,4 +68,28 @@ typedef struct ailayer_dense 	ailayer_dense_f32_t;
  */
 ailayer_t *ailayer_dense_f32_default(ailayer_dense_f32_t *layer, ailayer_t *input_layer);
 
+/** @brief Initializes and connect a \link ailayer_dense.h Dense layer \endlink with the \link aimath_q15.h Q15 \endlink default implementation
+ *
+ * The layer can be trained with integer arithmetic only. The shifts of the results, deltas and gradients are
+ * calculated automatically by the math functions. The weights and the bias have to be set with their shifts
+ * (for example with aimath_q15_default_quantize_f32() from initial F32 values) after the parameter memory is set.
+ *
+ * Example: Create the layer structure for training:\n
+ * \code{.c}
+ * ailayer_dense_q15_t dense_layer = {
+ *     .neurons = 3
+ * };
+ * \endcode
+ *
+ * Example: Initialize and connect the layer:\n
+ * \code{.c}
+ * x = ailayer_dense_q15_default(&dense_layer, x);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_dense_q15_default(ailayer_dense_q15_t *layer, ailayer_t *input_layer);
+
 #endif // AILAYER_DENSE_DEFAULT
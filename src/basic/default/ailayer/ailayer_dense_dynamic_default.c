@@ -0,0 +1,45 @@
+/**
+ * \file basic/default/ailayer/ailayer_dense_dynamic_default.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See ailayer_dense_dynamic_default.h for documentation.
+ * \details
+ */
+
+#include "basic/default/ailayer/ailayer_dense_dynamic_default.h"
+
+
+ailayer_t *ailayer_dense_dynamic_q7_default(ailayer_dense_dynamic_q7_t *layer, ailayer_t *input_layer)
+{
+	layer->base.result_dtype = aif32;
+	layer->base.weights_dtype = aiq7;
+	layer->base.bias_dtype = aif32;
+	layer->input_quantized_dtype = aiq7;
+
+	layer->quantize = aimath_q7_default_quantize_f32;
+	layer->linear_dequantize = aimath_q7_default_linear_dequantize_f32;
+	layer->quantize_channels_transposed = aimath_q7_default_quantize_channels_transposed_f32;
+
+	layer->base.linear = 0;
+	layer->base.mat_mul = 0;
+	layer->base.tensor_add = 0;
+	layer->base.linear_backward_sgd = 0;
+
+	return ailayer_dense_dynamic(layer, input_layer);
+}
@@ -0,0 +1,74 @@
+/**
+ * \file basic/default/ailayer/ailayer_dense_dynamic_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Default implementation of the \link ailayer_dense_dynamic.h Dense layer with dynamic quantization \endlink
+ *
+ * Hardware independent implementation of the Dense layer with \link aimath_q7.h Q7 \endlink weights and
+ * \link aimath_f32.h F32 \endlink inputs and results.
+ * For more information about the layer refer to ailayer_dense_dynamic.h.
+ */
+
+#ifndef AILAYER_DENSE_DYNAMIC_DEFAULT
+#define AILAYER_DENSE_DYNAMIC_DEFAULT
+
+#include "basic/base/ailayer/ailayer_dense_dynamic.h"
+#include "basic/default/aimath/aimath_f32_default.h"
+#include "basic/default/aimath/aimath_q7_default.h"
+
+typedef struct ailayer_dense_dynamic 	ailayer_dense_dynamic_q7_t;
+
+/** @brief Initializes and connect a \link ailayer_dense_dynamic.h Dense layer with dynamic quantization \endlink
+ * with \link aimath_q7.h Q7 \endlink weights and the default implementation
+ *
+ * Compared to the F32 Dense layer the weights need 4 times less memory (plus 4 bytes per neuron for the scales).
+ *
+ * Example: Create the layer structure with pretrained and quantized weights:\n
+ * \code{.c}
+ * // Transposed weights [neurons x inputs]
+ * const int8_t weights_data_dense[] = {-127, 85, 95, -111, 76, -127};
+ * const float weights_scales_dense[] = {0.0797f, 0.0722f, 0.0710f};
+ * const float bias_data_dense[] = {-2.9653f,  2.3677f, -1.5968f};
+ * ailayer_dense_dynamic_q7_t dense_layer = {
+ *     .base.neurons = 3,
+ *     .base.weights.data = (int8_t *) weights_data_dense,
+ *     .base.bias.data = (float *) bias_data_dense,
+ *     .weights_scales = (float *) weights_scales_dense
+ * };
+ * \endcode
+ *
+ * Example: Initialize and connect the layer:\n
+ * \code{.c}
+ * x = ailayer_dense_dynamic_q7_default(&dense_layer, x);
+ * \endcode
+ *
+ * Example: Quantize the weights of a trained F32 Dense layer (after aialgo_distribute_parameter_memory()):\n
+ * \code{.c}
+ * ailayer_dense_dynamic_quantize_weights(&dense_layer, &dense_f32_layer.weights, &dense_f32_layer.bias);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_dense_dynamic_q7_default(ailayer_dense_dynamic_q7_t *layer, ailayer_t *input_layer);
+
+#endif // AILAYER_DENSE_DYNAMIC_DEFAULT
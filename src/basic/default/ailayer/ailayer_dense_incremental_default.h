@@ -0,0 +1,67 @@
+/**
+ * \file basic/default/ailayer/ailayer_dense_incremental_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Default implementation of the \link ailayer_dense_incremental.h Dense layer with incremental inference \endlink
+ *
+ * Hardware independent implementation of the Dense layer with incremental inference for \link aimath_f32.h F32 \endlink.
+ * For more information about the layer refer to ailayer_dense_incremental.h.
+ */
+
+#ifndef AILAYER_DENSE_INCREMENTAL_DEFAULT
+#define AILAYER_DENSE_INCREMENTAL_DEFAULT
+
+#include "basic/base/ailayer/ailayer_dense_incremental.h"
+#include "basic/default/aimath/aimath_f32_default.h"
+
+typedef struct ailayer_dense_incremental 	ailayer_dense_incremental_f32_t;
+
+/** @brief Initializes and connect a \link ailayer_dense_incremental.h Dense layer with incremental inference \endlink
+ * with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Example: Create the layer structure:\n
+ * \code{.c}
+ * ailayer_dense_incremental_f32_t dense_layer = {
+ *     .base.neurons = 16,
+ *     .refresh_interval = 100,
+ *     .max_changed_inputs = 8
+ * };
+ * \endcode
+ *
+ * Example: Initialize and connect the layer:\n
+ * \code{.c}
+ * x = ailayer_dense_incremental_f32_default(&dense_layer, x);
+ * \endcode
+ *
+ * Example: Set the trained weights (after aialgo_distribute_parameter_memory()):\n
+ * \code{.c}
+ * aimath_f32_default_copy_tensor(&dense_f32_layer.weights, &dense_layer.base.weights);
+ * aimath_f32_default_copy_tensor(&dense_f32_layer.bias, &dense_layer.base.bias);
+ * ailayer_dense_incremental_reset(&dense_layer);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_dense_incremental_f32_default(ailayer_dense_incremental_f32_t *layer, ailayer_t *input_layer);
+
+#endif // AILAYER_DENSE_INCREMENTAL_DEFAULT
@@ -0,0 +1,68 @@
+/**
+ * \file basic/default/ailayer/ailayer_dense_stacked_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Default implementation of the \link ailayer_dense_stacked.h stacked Dense layer \endlink
+ *
+ * Hardware independent implementations of the stacked Dense layer in \link aimath_f32.h F32 \endlink data-type.
+ * For more information about the stacked Dense layer refer to ailayer_dense_stacked.h.
+ */
+
+#ifndef AILAYER_DENSE_STACKED_DEFAULT
+#define AILAYER_DENSE_STACKED_DEFAULT
+
+#include "basic/base/ailayer/ailayer_dense_stacked.h"
+#include "basic/default/aimath/aimath_f32_default.h"
+
+typedef struct ailayer_dense_stacked 	ailayer_dense_stacked_f32_t;
+
+/** @brief Initializes and connect a \link ailayer_dense_stacked.h stacked Dense layer \endlink with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Example: Ensemble of 16 models with 2 inputs, 8 hidden neurons and 1 output:\n
+ * \code{.c}
+ * ailayer_dense_stacked_f32_t hidden_layer = {
+ *     .neurons = 8,
+ *     .model_count = 16,
+ *     .shared_input = TRUE
+ * };
+ * ailayer_dense_stacked_f32_t output_layer = {
+ *     .neurons = 1,
+ *     .model_count = 16,
+ *     .shared_input = FALSE
+ * };
+ *
+ * model.input_layer = ailayer_input_f32_default(&input_layer);
+ * x = ailayer_dense_stacked_f32_default(&hidden_layer, model.input_layer);
+ * x = ailayer_relu_f32_default(&relu_layer, x);
+ * x = ailayer_dense_stacked_f32_default(&output_layer, x);
+ * model.output_layer = ailayer_sigmoid_f32_default(&sigmoid_layer, x);
+ *
+ * // The targets are repeated for every model: shape [samples x 16]
+ * model.loss = ailoss_mse_f32_default(&mse_loss, model.output_layer);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_dense_stacked_f32_default(ailayer_dense_stacked_f32_t *layer, ailayer_t *input_layer);
+
+#endif // AILAYER_DENSE_STACKED_DEFAULT
@@ -35,6 +35,7 @@ ailayer_t *ailayer_elu_f32_default(ailayer_elu_f32_t *layer, ailayer_t *input_la
 	// backward
 	layer->base.d_elu = aimath_f32_default_d_elu;
 	layer->base.multiply = aimath_f32_default_multiply;
+	layer->base.elu_backward = aimath_f32_default_elu_backward;
 
 	return ailayer_elu(&layer->base, input_layer);
 }
@@ -30,3 +30,10 @@ ailayer_t *ailayer_input_f32_default(ailayer_input_f32_t *layer)
 
 	return ailayer_input(layer);
 }
+
+ailayer_t *ailayer_input_q15_default(ailayer_input_q15_t *layer)
+{
+	layer->dtype = aiq15;
+
+	return ailayer_input(layer);
+}
@@ -32,8 +32,10 @@
 #include "basic/base/ailayer/ailayer_input.h"
 
 #include "basic/default/aimath/aimath_f32_default.h"
+#include "basic/default/aimath/aimath_q15_default.h"
 
 typedef struct ailayer_input 	ailayer_input_f32_t;
+typedef struct ailayer_input 	ailayer_input_q15_t;
 
 /** @brief Initializes and connect an \link ailayer_input.h Input layer \endlink with the \link aimath_f32.h F32 \endlink default implementation
  *
@@ -56,4 +58,28 @@ typedef struct ailayer_input 	ailayer_input_f32_t;
  */
 ailayer_t *ailayer_input_f32_default(ailayer_input_f32_t *layer);
 
+/** @brief Initializes and connect an \link ailayer_input.h Input layer \endlink with the \link aimath_q15.h Q15 \endlink default implementation
+ *
+ * The input tensors of the model must be \link aimath_q15.h Q15 \endlink tensors with their own shift
+ * (for example converted with aimath_q15_default_quantize_f32()).
+ *
+ * Example: Create the layer structure:\n
+ * \code{.c}
+ * uint16_t input_layer_shape[] = {1, 2};
+ * ailayer_input_q15_t input_layer = {
+ *     .input_dim = 2,
+ *     .input_shape = input_layer_shape
+ * };
+ * \endcode
+ *
+ * Example: Initialize and connect the layer:\n
+ * \code{.c}
+ * x = ailayer_input_q15_default(&input_layer);
+ * \endcode
+ *
+ * @param *layer    The layer structure to initialize.
+ * @return          The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_input_q15_default(ailayer_input_q15_t *layer);
+
 #endif // AILAYER_INPUT_DEFAULT
@@ -35,6 +35,27 @@ ailayer_t *ailayer_leaky_relu_f32_default(ailayer_leaky_relu_f32_t *layer, ailay
 	// backward
 	layer->base.d_leaky_relu = aimath_f32_default_d_leaky_relu;
 	layer->base.multiply = aimath_f32_default_multiply;
+	layer->base.leaky_relu_backward = aimath_f32_default_leaky_relu_backward;
+	layer->base.leaky_relu_mask = 0;
+	layer->base.leaky_relu_backward_mask = 0;
+
+	return ailayer_leaky_relu(&layer->base, input_layer);
+}
+
+ailayer_t *ailayer_leaky_relu_mask_f32_default(ailayer_leaky_relu_f32_t *layer, ailayer_t *input_layer)
+{
+	layer->base.dtype = aif32;
+	layer->base.alpha = &(layer->alpha);
+
+	//forward
+	layer->base.leaky_relu = aimath_f32_default_leaky_relu;
+	layer->base.leaky_relu_mask = aimath_f32_default_leaky_relu_mask;
+
+	// backward
+	layer->base.d_leaky_relu = aimath_f32_default_d_leaky_relu;
+	layer->base.multiply = aimath_f32_default_multiply;
+	layer->base.leaky_relu_backward = aimath_f32_default_leaky_relu_backward;
+	layer->base.leaky_relu_backward_mask = aimath_f32_default_leaky_relu_backward_mask;
 
 	return ailayer_leaky_relu(&layer->base, input_layer);
 }
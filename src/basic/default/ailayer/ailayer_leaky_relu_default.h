@@ -65,4 +65,25 @@ struct ailayer_leaky_relu_f32 {
  */
 ailayer_t *ailayer_leaky_relu_f32_default(ailayer_leaky_relu_f32_t *layer, ailayer_t *input_layer);
 
+/** @brief Initializes and connect a \link ailayer_leaky_relu.h Leaky ReLU layer \endlink with the \link aimath_f32.h F32 \endlink
+ * default implementation and sign mask for the training
+ *
+ * Calculates the same function as ailayer_leaky_relu_f32_default(), but for the training the layer stores one bit per
+ * element in the training memory and writes its result over the result of the previous layer (see ailayer_relu_mask_f32_default()).
+ *
+ * Example:\n
+ * \code{.c}
+ * ailayer_leaky_relu_f32_t leaky_relu_layer = {
+ *     .alpha = 0.01f
+ * };
+ *
+ * x = ailayer_leaky_relu_mask_f32_default(&leaky_relu_layer, x);
+ * \endcode
+ *
+ * @param *layer the layer structure to be initialized
+ * @param *input_layer the prior layer that provides the input to this Leaky ReLU layer
+ * @return the initialized Leaky ReLU layer structure
+ */
+ailayer_t *ailayer_leaky_relu_mask_f32_default(ailayer_leaky_relu_f32_t *layer, ailayer_t *input_layer);
+
 #endif // AILAYER_LEAKY_RELU_DEFAULT
@@ -0,0 +1,36 @@
+/**
+ * \file basic/default/ailayer/ailayer_normalize_default.c
+ * \version 2.0alpha
+ * \date 07.12.2020
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See ailayer_normalize_default.h for documentation.
+ * \details
+ */
+
+#include "basic/default/ailayer/ailayer_normalize_default.h"
+
+ailayer_t *ailayer_normalize_f32_default(ailayer_normalize_f32_t *layer, ailayer_t *input_layer)
+{
+	layer->dtype = aif32;
+
+	layer->scale_offset = aimath_f32_default_scale_offset;
+	layer->standardization = aimath_f32_default_standardization;
+	layer->fold_scale_offset = aimath_f32_default_fold_scale_offset;
+
+	return ailayer_normalize(layer, input_layer);
+}
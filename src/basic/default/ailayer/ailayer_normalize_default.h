@@ -0,0 +1,61 @@
+/**
+ * \file basic/default/ailayer/ailayer_normalize_default.h
+ * \internal
+ * \date 07.12.2020
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Default implementation of the \link ailayer_normalize.h Normalize layer \endlink
+ *
+ * Hardware independent implementations of the Normalize layer in \link aimath_f32.h F32 \endlink data-type.
+ * For more information about the Normalize layer refer to ailayer_normalize.h.
+ */
+
+#ifndef AILAYER_NORMALIZE_DEFAULT
+#define AILAYER_NORMALIZE_DEFAULT
+
+#include "basic/base/ailayer/ailayer_normalize.h"
+
+#include "basic/default/aimath/aimath_f32_default.h"
+
+typedef struct ailayer_normalize 	ailayer_normalize_f32_t;
+
+/** @brief Initializes and connect a \link ailayer_normalize.h Normalize layer \endlink with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * Example: Create the layer structure:\n
+ * \code{.c}
+ * ailayer_normalize_f32_t normalize_layer;
+ * \endcode
+ *
+ * Example: Initialize and connect the layer:\n
+ * \code{.c}
+ * x = ailayer_normalize_f32_default(&normalize_layer, x);
+ * \endcode
+ *
+ * Example: Set the statistics after the parameter memory is distributed:\n
+ * \code{.c}
+ * ailayer_normalize_fit(&normalize_layer, &input_tensor);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_normalize_f32_default(ailayer_normalize_f32_t *layer, ailayer_t *input_layer);
+
+#endif // AILAYER_NORMALIZE_DEFAULT
@@ -34,6 +34,43 @@ ailayer_t *ailayer_relu_f32_default(ailayer_relu_f32_t *layer, ailayer_t *input_
 	// backward
 	layer->d_relu = aimath_f32_default_d_relu;
 	layer->multiply = aimath_f32_default_multiply;
+	layer->relu_backward = aimath_f32_default_relu_backward;
+	layer->relu_mask = 0;
+	layer->relu_backward_mask = 0;
+
+	return ailayer_relu(layer, input_layer);
+}
+
+ailayer_t *ailayer_relu_mask_f32_default(ailayer_relu_f32_t *layer, ailayer_t *input_layer)
+{
+	layer->dtype = aif32;
+
+	//forward
+	layer->relu = aimath_f32_default_relu;
+	layer->relu_mask = aimath_f32_default_relu_mask;
+
+	// backward
+	layer->d_relu = aimath_f32_default_d_relu;
+	layer->multiply = aimath_f32_default_multiply;
+	layer->relu_backward = aimath_f32_default_relu_backward;
+	layer->relu_backward_mask = aimath_f32_default_relu_backward_mask;
+
+	return ailayer_relu(layer, input_layer);
+}
+
+ailayer_t *ailayer_relu_q15_default(ailayer_relu_q15_t *layer, ailayer_t *input_layer)
+{
+	layer->dtype = aiq15;
+
+	//forward
+	layer->relu = aimath_q15_default_relu;
+
+	// backward
+	layer->d_relu = aimath_q15_default_d_relu;
+	layer->multiply = aimath_q15_default_multiply;
+	layer->relu_backward = 0;
+	layer->relu_mask = 0;
+	layer->relu_backward_mask = 0;
 
 	return ailayer_relu(layer, input_layer);
 }
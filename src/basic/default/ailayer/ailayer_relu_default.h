@@ -32,8 +32,10 @@
 #include "basic/base/ailayer/ailayer_relu.h"
 
 #include "basic/default/aimath/aimath_f32_default.h"
+#include "basic/default/aimath/aimath_q15_default.h"
 
 typedef struct ailayer_relu 	ailayer_relu_f32_t;
+typedef struct ailayer_relu 	ailayer_relu_q15_t;
 
 /** @brief Initializes and connect a \link ailayer_relu.h ReLU layer \endlink with the \link aimath_f32.h F32 \endlink default implementation
  *
@@ -53,4 +55,44 @@ typedef struct ailayer_relu 	ailayer_relu_f32_t;
  */
 ailayer_t *ailayer_relu_f32_default(ailayer_relu_f32_t *layer, ailayer_t *input_layer);
 
+/** @brief Initializes and connect a \link ailayer_relu.h ReLU layer \endlink with the \link aimath_f32.h F32 \endlink default implementation
+ * and sign mask for the training
+ *
+ * Calculates the same function as ailayer_relu_f32_default(), but for the training the layer stores one bit per element
+ * in the training memory instead of keeping its inputs. The training memory scheduler lets the layer write its result
+ * over the result of the previous layer (ailayer.result_in_place), so no own result memory is needed
+ * (32 times less activation memory for the layer). The result of the previous layer can therefore not be used by other
+ * layers or heads (e.g. early exit heads) during training. The inference is the same as with ailayer_relu_f32_default().
+ *
+ * Example: Initialize and connect the layer:\n
+ * \code{.c}
+ * ailayer_relu_f32_t relu_layer;
+ *
+ * x = ailayer_relu_mask_f32_default(&relu_layer, x);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_relu_mask_f32_default(ailayer_relu_f32_t *layer, ailayer_t *input_layer);
+
+/** @brief Initializes and connect a \link ailayer_relu.h ReLU layer \endlink with the \link aimath_q15.h Q15 \endlink default implementation
+ *
+ * Example: Create the layer structure:\n
+ * \code{.c}
+ * ailayer_relu_q15_t relu_layer;
+ * \endcode
+ *
+ * Example: Initialize and connect the layer:\n
+ * \code{.c}
+ * x = ailayer_relu_q15_default(&relu_layer, x);
+ * \endcode
+ *
+ * @param *layer        The layer structure to initialize.
+ * @param *input_layer  The prior layer.
+ * @return              The (successfully) initialized layer structure.
+ */
+ailayer_t *ailayer_relu_q15_default(ailayer_relu_q15_t *layer, ailayer_t *input_layer);
+
 #endif // AILAYER_RELU_DEFAULT
@@ -34,6 +34,7 @@ ailayer_t *ailayer_sigmoid_f32_default(ailayer_sigmoid_f32_t *layer, ailayer_t *
 	// backward
 	layer->d_sigmoid = aimath_f32_default_d_sigmoid;
 	layer->multiply = aimath_f32_default_multiply;
+	layer->sigmoid_backward = aimath_f32_default_sigmoid_backward;
 
 	layer->base.get_result_bound = ailayer_sigmoid_get_result_bound_f32_default;
 
@@ -34,6 +34,7 @@ ailayer_t *ailayer_softsign_f32_default(ailayer_softsign_f32_t *layer, ailayer_t
     // backward
 	layer->d_softsign = aimath_f32_default_d_softsign;
 	layer->multiply = aimath_f32_default_multiply;
+	layer->softsign_backward = aimath_f32_default_softsign_backward;
 
 	return ailayer_softsign(layer, input_layer);
 }
@@ -35,6 +35,7 @@ ailayer_t *ailayer_tanh_f32_default(ailayer_tanh_f32_t *layer, ailayer_t *input_
 	// backward
 	layer->d_tanh = aimath_f32_default_d_tanh;
 	layer->multiply = aimath_f32_default_multiply;
+	layer->tanh_backward = aimath_f32_default_tanh_backward;
 
 	layer->base.get_result_bound = ailayer_tanh_get_result_bound_f32_default;
 
@@ -0,0 +1,38 @@
+/**
+ * \file basic/default/ailoss/ailoss_distillation_default.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See ailoss_distillation_default.h for documentation.
+ * \details
+ */
+
+#include "basic/default/ailoss/ailoss_distillation_default.h"
+
+
+ailoss_t *ailoss_distillation_f32_default(ailoss_distillation_f32_t *loss, ailayer_t *input_layer)
+{
+	loss->base.dtype = aif32;
+	loss->base.temperature = &(loss->temperature);
+	loss->base.alpha = &(loss->alpha);
+
+	loss->base.distillation_delta = aimath_f32_default_distillation_delta;
+	loss->base.distillation_loss = aimath_f32_default_distillation_loss;
+
+	return ailoss_distillation(&loss->base, input_layer);
+}
@@ -0,0 +1,81 @@
+/**
+ * \file basic/default/ailoss/ailoss_distillation_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Default implementation of the \link ailoss_distillation.h distillation loss \endlink
+ *
+ * Hardware independent implementations of the distillation loss in \link aimath_f32.h F32 \endlink data-type.
+ * For more information about the distillation loss refer to ailoss_distillation.h.
+ */
+
+#ifndef AILOSS_DISTILLATION_DEFAULT
+#define AILOSS_DISTILLATION_DEFAULT
+
+#include "basic/base/ailoss/ailoss_distillation.h"
+
+#include "basic/default/aimath/aimath_f32_default.h"
+
+typedef struct ailoss_distillation_f32 	ailoss_distillation_f32_t;
+
+/** @brief Data-type specific distillation loss struct for \link aimath_f32.h F32 \endlink
+ *
+ * Adds data fields for the temperature and the weight alpha in \link aimath_f32.h F32 \endlink to the base implementation.
+ */
+struct ailoss_distillation_f32 {
+	ailoss_distillation_t base; /**< Inherited field members from general ailoss_distillation struct. */
+	aiscalar_f32_t temperature; /**< Temperature T of the soft targets. */
+	aiscalar_f32_t alpha; /**< Weight of the soft target loss (between 0 and 1). */
+};
+
+/** @brief Initializes and connect a \link ailoss_distillation.h distillation loss \endlink with the \link aimath_f32.h F32 \endlink default implementation
+ *
+ * The hard labels must be row wise one-hot encoded. The teacher logits must have the same shape and order as the
+ * target tensor.
+ *
+ * Example: Create the loss structure:\n
+ * \code{.c}
+ * // Precomputed with the teacher model (for example a memory-mapped file or a constant array in flash memory)
+ * aitensor_t teacher_logits_tensor = AITENSOR_2D_F32(target_shape, teacher_logits_data);
+ *
+ * ailoss_distillation_f32_t distillation_loss = {
+ *     .temperature = 4.0f,
+ *     .alpha = 0.7f,
+ *     .base.teacher_logits = &teacher_logits_tensor,
+ *     .base.target_tensor = &target_tensor
+ * };
+ * \endcode
+ *
+ * Example: Initialize and connect the loss to the layer structure and train the model:\n
+ * \code{.c}
+ * model.output_layer = ailayer_softmax_f32_default(&softmax_layer, x);
+ *
+ * model.loss = ailoss_distillation_f32_default(&distillation_loss, model.output_layer);
+ * ...
+ * aialgo_train_model(&model, &input_tensor, &target_tensor, optimizer, batch_size);
+ * \endcode
+ *
+ * @param *loss         The loss structure to initialize.
+ * @param *input_layer  The output layer of the model (**Must be a Softmax layer!**).
+ * @return              The (successfully) initialized loss structure.
+ */
+ailoss_t *ailoss_distillation_f32_default(ailoss_distillation_f32_t *loss, ailayer_t *input_layer);
+
+#endif // AILOSS_DISTILLATION_DEFAULT
@@ -31,6 +31,18 @@ ailoss_t *ailoss_mse_f32_default(ailoss_mse_f32_t *loss, ailayer_t *input_layer)
 
 	loss->tensor_sub = aimath_f32_default_tensor_sub;
 	loss->norm_squared = aimath_f32_default_norm_squared;
+	loss->tensor_sub_norm_squared = aimath_f32_default_tensor_sub_norm_squared;
+
+	return ailoss_mse(loss, input_layer);
+}
+
+ailoss_t *ailoss_mse_q15_default(ailoss_mse_q15_t *loss, ailayer_t *input_layer)
+{
+	loss->dtype = aiq15;
+
+	loss->tensor_sub = aimath_q15_default_tensor_sub;
+	loss->norm_squared = aimath_q15_default_norm_squared;
+	loss->tensor_sub_norm_squared = 0;
 
 	return ailoss_mse(loss, input_layer);
 }
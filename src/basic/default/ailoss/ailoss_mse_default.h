@@ -32,8 +32,10 @@
 #include "basic/base/ailoss/ailoss_mse.h"
 
 #include "basic/default/aimath/aimath_f32_default.h"
+#include "basic/default/aimath/aimath_q15_default.h"
 
 typedef struct ailoss_mse 	ailoss_mse_f32_t;
+typedef struct ailoss_mse 	ailoss_mse_q15_t;
 
 /** @brief Initializes and connect a \link ailoss_mse.h Mean Squared Error loss \endlink with the \link aimath_f32.h F32 \endlink default implementation
  *
@@ -55,4 +57,26 @@ typedef struct ailoss_mse 	ailoss_mse_f32_t;
  */
 ailoss_t *ailoss_mse_f32_default(ailoss_mse_f32_t *loss, ailayer_t *input_layer);
 
+/** @brief Initializes and connect a \link ailoss_mse.h Mean Squared Error loss \endlink with the \link aimath_q15.h Q15 \endlink default implementation
+ *
+ * The loss value (ailoss.calc_loss) is returned as \link aimath_q31.h Q31 \endlink scalar (aiscalar_q31_t).
+ *
+ * Example: Create the loss structure:\n
+ * \code{.c}
+ * ailoss_mse_q15_t mse_loss;
+ * \endcode
+ *
+ * Example: Initialize and connect the loss to the layer structure:\n
+ * \code{.c}
+ * aimodel_t model;
+ * ...
+ * model.loss = ailoss_mse_q15_default(&mse_loss, model.output_layer);
+ * \endcode
+ *
+ * @param *loss         The loss structure to initialize.
+ * @param *input_layer  The output layer of the model.
+ * @return              The (successfully) initialized loss structure.
+ */
+ailoss_t *ailoss_mse_q15_default(ailoss_mse_q15_t *loss, ailayer_t *input_layer);
+
 #endif // AILOSS_MSE_DEFAULT
@@ -68,272 +68,1262 @@ void aimath_f32_default_linear(const aitensor_t *a, const aitensor_t *b, const a
 	return;
 }
 
+void aimath_f32_default_linear_stacked(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
+{
+	uint16_t i, j, k, n;
+	uint16_t models = b->shape[0];
+	uint16_t inputs = b->shape[1];
+	uint16_t neurons = b->shape[2];
+	// All models read the same inputs if a has only the inputs of one model
+	uint32_t input_stride = a->shape[1] == inputs ? 0 : inputs;
+	const float *a_row, *b_block;
+	float sum;
+
+	float *a_data = (float *) a->data;
+	float *b_data = (float *) b->data;
+	float *c_data = c != 0 ? (float *) c->data : 0;
+	float *result_data = (float *) result->data;
+
+#ifdef SHAPE_CHECK
+	if(a->shape[1] != inputs && a->shape[1] != models * inputs)
+	{
+		LOG_E("Stacked linear input shapes doesn't match.\n");
+		return;
+	}
+	if(a->shape[0] != result->shape[0] || models * neurons != result->shape[1])
+	{
+		LOG_E("Stacked linear output shape doesn't match.\n");
+		return;
+	}
+#endif
+
+	for(i = 0; i < a->shape[0]; i++)
+	{
+		for(n = 0; n < models; n++)
+		{
+			a_row = &a_data[i * a->shape[1] + n * input_stride];
+			b_block = &b_data[(uint32_t) n * inputs * neurons];
+			for(j = 0; j < neurons; j++)
+			{
+				sum = c != 0 ? c_data[n * neurons + j] : 0.0f;
+				for(k = 0; k < inputs; k++)
+				{
+					sum += a_row[k] * b_block[k * neurons + j];
+				}
+				result_data[i * result->shape[1] + n * neurons + j] = sum;
+			}
+		}
+	}
+	return;
+}
+
+void aimath_f32_default_linear_stacked_backward(const aitensor_t *x, const aitensor_t *delta_out, const aitensor_t *weights,
+												aitensor_t *d_weights, aitensor_t *d_bias, aitensor_t *delta_in)
+{
+	uint16_t i, j, k, n;
+	uint16_t models = weights->shape[0];
+	uint16_t inputs = weights->shape[1];
+	uint16_t neurons = weights->shape[2];
+	uint32_t input_stride = x->shape[1] == inputs ? 0 : inputs;
+	const float *x_row, *delta_row, *w_block;
+	float *dw_block, *delta_in_row;
+	float sum;
+
+	float *x_data = (float *) x->data;
+	float *delta_out_data = (float *) delta_out->data;
+	float *w_data = (float *) weights->data;
+	float *dw_data = (float *) d_weights->data;
+	float *db_data = (float *) d_bias->data;
+	float *delta_in_data = delta_in != 0 ? (float *) delta_in->data : 0;
+
+	// Gradients first, because delta_in may share the memory with x
+	for(i = 0; i < x->shape[0]; i++)
+	{
+		for(n = 0; n < models; n++)
+		{
+			x_row = &x_data[i * x->shape[1] + n * input_stride];
+			delta_row = &delta_out_data[i * delta_out->shape[1] + n * neurons];
+			dw_block = &dw_data[(uint32_t) n * inputs * neurons];
+			for(k = 0; k < inputs; k++)
+			{
+				for(j = 0; j < neurons; j++)
+				{
+					dw_block[k * neurons + j] += x_row[k] * delta_row[j];
+				}
+			}
+			for(j = 0; j < neurons; j++)
+			{
+				db_data[n * neurons + j] += delta_row[j];
+			}
+		}
+	}
+
+	if(delta_in == 0){
+		return;
+	}
+	for(i = 0; i < x->shape[0]; i++)
+	{
+		for(n = 0; n < models; n++)
+		{
+			delta_row = &delta_out_data[i * delta_out->shape[1] + n * neurons];
+			delta_in_row = &delta_in_data[i * x->shape[1] + n * input_stride];
+			w_block = &w_data[(uint32_t) n * inputs * neurons];
+			for(k = 0; k < inputs; k++)
+			{
+				sum = 0.0f;
+				for(j = 0; j < neurons; j++)
+				{
+					sum += delta_row[j] * w_block[k * neurons + j];
+				}
+				// The deltas of shared inputs are summed over all models
+				delta_in_row[k] = (input_stride == 0 && n > 0) ? delta_in_row[k] + sum : sum;
+			}
+		}
+	}
+	return;
+}
+
+void aimath_f32_default_linear_backward_sgd(const aitensor_t *x, const aitensor_t *delta_out, const void *learning_rate,
+											aitensor_t *weights, aitensor_t *bias, aitensor_t *delta_in)
+{
+	uint16_t i, j, k;
+	uint16_t rows = x->shape[0];
+	uint16_t inputs = weights->shape[0];
+	uint16_t neurons = weights->shape[1];
+	float lr = *((float *) learning_rate);
+	float delta_in_column[rows];
+	float *w_row;
+	float sum, x_ik;
+
+	float *x_data = (float *) x->data;
+	float *delta_out_data = (float *) delta_out->data;
+	float *w_data = (float *) weights->data;
+	float *b_data = (float *) bias->data;
+	float *delta_in_data = (float *) delta_in->data;
+
+#ifdef SHAPE_CHECK
+	if(x->shape[1] != inputs || delta_out->shape[1] != neurons || delta_out->shape[0] != rows)
+	{
+		LOG_E("Linear backward input shapes doesn't match.\n");
+		return;
+	}
+#endif
+
+	for(k = 0; k < inputs; k++)
+	{
+		w_row = &w_data[k * neurons];
+
+		// delta_in column k with the old weights
+		for(i = 0; i < rows; i++)
+		{
+			sum = 0.0f;
+			for(j = 0; j < neurons; j++)
+			{
+				sum += delta_out_data[i * neurons + j] * w_row[j];
+			}
+			delta_in_column[i] = sum;
+		}
+
+		// w_kj = w_kj - lr * sum_i x_ik * d_out_ij
+		for(i = 0; i < rows; i++)
+		{
+			x_ik = x_data[i * inputs + k];
+			for(j = 0; j < neurons; j++)
+			{
+				w_row[j] -= lr * (x_ik * delta_out_data[i * neurons + j]);
+			}
+		}
+
+		// x column k is not needed anymore
+		for(i = 0; i < rows; i++)
+		{
+			delta_in_data[i * inputs + k] = delta_in_column[i];
+		}
+	}
+
+	for(i = 0; i < rows; i++)
+	{
+		for(j = 0; j < neurons; j++)
+		{
+			b_data[j] -= lr * delta_out_data[i * neurons + j];
+		}
+	}
+	return;
+}
+
+uint32_t aimath_f32_default_linear_incremental(const aitensor_t *a, aitensor_t *a_prev, const aitensor_t *b, aitensor_t *result, uint32_t max_changes)
+{
+	uint16_t i, j, k;
+	uint32_t n, changes = 0;
+	float difference;
+
+	float *a_data = (float *) a->data;
+	float *a_prev_data = (float *) a_prev->data;
+	float *b_data = (float *) b->data;
+	float *result_data = (float *) result->data;
+
+#ifdef SHAPE_CHECK
+	if(a->shape[1] != b->shape[0] || a->shape[0] != a_prev->shape[0] || a->shape[1] != a_prev->shape[1])
+	{
+		LOG_E("MatMul input shapes doesn't match.\n");
+		return 0;
+	}
+	if(a->shape[0] != result->shape[0] || b->shape[1] != result->shape[1])
+	{
+		LOG_E("MatMul output shape doesn't match.\n");
+		return 0;
+	}
+#endif
+
+	for(n = 0; n < aimath_tensor_elements(a); n++)
+	{
+		if(a_data[n] != a_prev_data[n]) changes++;
+	}
+	if(changes > max_changes)
+	{
+		return changes;
+	}
+
+	for(i = 0; i < a->shape[0]; i++)
+	{
+		for(k = 0; k < a->shape[1]; k++)
+		{
+			if(a_data[i*a->shape[1] + k] == a_prev_data[i*a->shape[1] + k]) continue;
+
+			difference = a_data[i*a->shape[1] + k] - a_prev_data[i*a->shape[1] + k];
+			for(j = 0; j < b->shape[1]; j++)
+			{
+				result_data[i*b->shape[1] + j] += difference * b_data[k*b->shape[1] + j];
+			}
+			a_prev_data[i*a->shape[1] + k] = a_data[i*a->shape[1] + k];
+		}
+	}
+	return changes;
+}
+
 void aimath_f32_default_mat_mul(const aitensor_t *a, const aitensor_t *b, aitensor_t *result){
 	aimath_f32_default_linear(a, b, 0, result);
 }
 
-void aimath_f32_default_multiply(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+void aimath_f32_default_multiply(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(a);
+	for(i = 0; i < elements; i++)
+	{
+		((float *) result->data)[i] = ((float *) a->data)[i] * ((float *) b->data)[i];
+	}
+	return;
+}
+
+void aimath_f32_default_divide(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(a);
+	for(i = 0; i < elements; i++)
+	{
+		((float *) result->data)[i] = ((float *) a->data)[i] / ((float *) b->data)[i];
+	}
+	return;
+}
+
+void aimath_f32_default_scalar_mul(const void *scalar, const aitensor_t *a, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(a);
+	for(i = 0; i < elements; i++)
+	{
+		((float *) result->data)[i] = *((float *) scalar) * ((float *) a->data)[i];
+	}
+	return;
+}
+
+void aimath_f32_default_scalar_add(const void *scalar, const aitensor_t *a, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(a);
+	for(i = 0; i < elements; i++)
+	{
+		((float *) result->data)[i] = *((float *) scalar) + ((float *) a->data)[i];
+	}
+	return;
+}
+
+/**
+* Add 2D tensors
+*/
+void aimath_f32_default_tensor_add(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(a);
+	for(i = 0; i < elements; i++)
+	{
+		((float *) result->data)[i] = ((float *) a->data)[i] + ((float *) b->data)[i];
+	}
+	return;
+}
+
+void aimath_f32_default_tensor_sub(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(a);
+	for(i = 0; i < elements; i++)
+	{
+		((float *) result->data)[i] = ((float *) a->data)[i] - ((float *) b->data)[i];
+	}
+	return;
+}
+
+// Inner loop of a broadcasting operation with the steps 0 or 1 in a and b. The loops are specialized,
+// so the compiler can vectorize them.
+static void aimath_f32_default_broadcast_inner(uint8_t operation, const float *a, uint32_t a_step, const float *b, uint32_t b_step, float *result, uint32_t count)
+{
+	uint32_t i;
+
+	if(a_step == 1 && b_step == 1){
+		switch(operation){
+		case AIMATH_BROADCAST_ADD: for(i = 0; i < count; i++) result[i] = a[i] + b[i]; break;
+		case AIMATH_BROADCAST_SUB: for(i = 0; i < count; i++) result[i] = a[i] - b[i]; break;
+		case AIMATH_BROADCAST_MULTIPLY: for(i = 0; i < count; i++) result[i] = a[i] * b[i]; break;
+		case AIMATH_BROADCAST_DIVIDE: for(i = 0; i < count; i++) result[i] = a[i] / b[i]; break;
+		}
+	} else if(a_step == 1){
+		const float b_value = b[0];
+		switch(operation){
+		case AIMATH_BROADCAST_ADD: for(i = 0; i < count; i++) result[i] = a[i] + b_value; break;
+		case AIMATH_BROADCAST_SUB: for(i = 0; i < count; i++) result[i] = a[i] - b_value; break;
+		case AIMATH_BROADCAST_MULTIPLY: for(i = 0; i < count; i++) result[i] = a[i] * b_value; break;
+		case AIMATH_BROADCAST_DIVIDE: for(i = 0; i < count; i++) result[i] = a[i] / b_value; break;
+		}
+	} else if(b_step == 1){
+		const float a_value = a[0];
+		switch(operation){
+		case AIMATH_BROADCAST_ADD: for(i = 0; i < count; i++) result[i] = a_value + b[i]; break;
+		case AIMATH_BROADCAST_SUB: for(i = 0; i < count; i++) result[i] = a_value - b[i]; break;
+		case AIMATH_BROADCAST_MULTIPLY: for(i = 0; i < count; i++) result[i] = a_value * b[i]; break;
+		case AIMATH_BROADCAST_DIVIDE: for(i = 0; i < count; i++) result[i] = a_value / b[i]; break;
+		}
+	} else {
+		// Both repeated: Single value
+		float value;
+		switch(operation){
+		case AIMATH_BROADCAST_ADD: value = a[0] + b[0]; break;
+		case AIMATH_BROADCAST_SUB: value = a[0] - b[0]; break;
+		case AIMATH_BROADCAST_MULTIPLY: value = a[0] * b[0]; break;
+		default: value = a[0] / b[0]; break;
+		}
+		for(i = 0; i < count; i++) result[i] = value;
+	}
+	return;
+}
+
+void aimath_f32_default_broadcast(const aimath_broadcast_plan_t *plan, uint8_t operation, const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	uint8_t d;
+	uint8_t last = plan->dim - 1;
+	uint32_t outer, o, r;
+	uint32_t index[AIMATH_BROADCAST_MAX_DIM] = {0};
+	const float *a_data = (const float *) a->data;
+	const float *b_data = (const float *) b->data;
+	float *result_data = (float *) result->data;
+	uint32_t inner = plan->shape[last];
+
+#ifdef SHAPE_CHECK
+	if(aimath_tensor_elements(result) != plan->elements)
+	{
+		LOG_E("Broadcast output shape doesn't match.\n");
+		return;
+	}
+#endif
+
+	// Fast paths for the common kinds, the rows are addressed directly
+	switch(plan->kind){
+	case AIMATH_BROADCAST_SAME:
+	case AIMATH_BROADCAST_SCALAR_A:
+	case AIMATH_BROADCAST_SCALAR_B:
+		aimath_f32_default_broadcast_inner(operation, a_data, plan->a_stride[0], b_data, plan->b_stride[0], result_data, plan->elements);
+		return;
+	case AIMATH_BROADCAST_ROW_A:
+		for(r = 0; r < plan->shape[0]; r++)
+		{
+			aimath_f32_default_broadcast_inner(operation, a_data, 1, b_data + r * inner, 1, result_data + r * inner, inner);
+		}
+		return;
+	case AIMATH_BROADCAST_ROW_B:
+		for(r = 0; r < plan->shape[0]; r++)
+		{
+			aimath_f32_default_broadcast_inner(operation, a_data + r * inner, 1, b_data, 1, result_data + r * inner, inner);
+		}
+		return;
+	case AIMATH_BROADCAST_COLUMN_A:
+		for(r = 0; r < plan->shape[0]; r++)
+		{
+			aimath_f32_default_broadcast_inner(operation, a_data + r, 0, b_data + r * inner, 1, result_data + r * inner, inner);
+		}
+		return;
+	case AIMATH_BROADCAST_COLUMN_B:
+		for(r = 0; r < plan->shape[0]; r++)
+		{
+			aimath_f32_default_broadcast_inner(operation, a_data + r * inner, 1, b_data + r, 0, result_data + r * inner, inner);
+		}
+		return;
+	default:
+		break;
+	}
+
+	// General case: Odometer over the outer dimensions
+	outer = plan->elements / inner;
+	for(o = 0; o < outer; o++)
+	{
+		aimath_f32_default_broadcast_inner(operation, a_data, plan->a_stride[last], b_data, plan->b_stride[last], result_data, inner);
+		result_data += inner;
+
+		// Step to the next row (odometer over the outer dimensions)
+		for(d = last; d > 0; d--)
+		{
+			a_data += plan->a_stride[d - 1];
+			b_data += plan->b_stride[d - 1];
+			if(++index[d - 1] < plan->shape[d - 1]) break;
+			a_data -= plan->a_stride[d - 1] * plan->shape[d - 1];
+			b_data -= plan->b_stride[d - 1] * plan->shape[d - 1];
+			index[d - 1] = 0;
+		}
+	}
+	return;
+}
+
+void aimath_f32_default_broadcast_add(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	aimath_broadcast_plan_t plan;
+
+	if(aimath_broadcast_plan(a, b, &plan) == 0){
+		aimath_f32_default_broadcast(&plan, AIMATH_BROADCAST_ADD, a, b, result);
+	}
+	return;
+}
+
+void aimath_f32_default_broadcast_sub(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	aimath_broadcast_plan_t plan;
+
+	if(aimath_broadcast_plan(a, b, &plan) == 0){
+		aimath_f32_default_broadcast(&plan, AIMATH_BROADCAST_SUB, a, b, result);
+	}
+	return;
+}
+
+void aimath_f32_default_broadcast_multiply(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	aimath_broadcast_plan_t plan;
+
+	if(aimath_broadcast_plan(a, b, &plan) == 0){
+		aimath_f32_default_broadcast(&plan, AIMATH_BROADCAST_MULTIPLY, a, b, result);
+	}
+	return;
+}
+
+void aimath_f32_default_broadcast_divide(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	aimath_broadcast_plan_t plan;
+
+	if(aimath_broadcast_plan(a, b, &plan) == 0){
+		aimath_f32_default_broadcast(&plan, AIMATH_BROADCAST_DIVIDE, a, b, result);
+	}
+	return;
+}
+
+// only for 2D tensors
+// a: f32
+// b: u8
+// result: f32
+void aimath_f32_default_tensor_sub_sparse8(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	uint32_t i, index;
+	for(i = 0; i < a->shape[0]; i++)
+	{
+	    index = a->shape[1] * i + ((uint8_t *) b->data)[i];
+		((float *) result->data)[index] = ((float *) a->data)[index] - 1.0f;
+	}
+	return;
+}
+
+void aimath_f32_default_scale_offset(const aitensor_t *x, const aitensor_t *scale, const aitensor_t *offset, aitensor_t *result)
+{
+	uint16_t i, j;
+	uint16_t rows = x->shape[0];
+	uint16_t cols = x->shape[1];
+	float *x_data = (float *) x->data;
+	float *scale_data = (float *) scale->data;
+	float *offset_data = offset != 0 ? (float *) offset->data : 0;
+	float *result_data = (float *) result->data;
+
+#ifdef SHAPE_CHECK
+	if(scale->shape[1] != cols || (offset != 0 && offset->shape[1] != cols))
+	{
+		LOG_E("Scale offset shapes doesn't match.\n");
+		return;
+	}
+#endif
+
+	for(i = 0; i < rows; i++)
+	{
+		for(j = 0; j < cols; j++)
+		{
+			result_data[i*cols + j] = x_data[i*cols + j] * scale_data[j];
+			if(offset != 0){
+				result_data[i*cols + j] += offset_data[j];
+			}
+		}
+	}
+	return;
+}
+
+void aimath_f32_default_standardization(const aitensor_t *x, aitensor_t *scale, aitensor_t *offset)
+{
+	uint16_t j;
+	uint16_t cols = x->shape[1];
+	float *scale_data = (float *) scale->data;
+	float *offset_data = (float *) offset->data;
+
+	aimath_f32_default_reduce_mean(x, 0, offset);
+	aimath_f32_default_reduce_variance(x, 0, scale);
+	for(j = 0; j < cols; j++)
+	{
+		scale_data[j] = scale_data[j] > 0.0f ? 1.0f / sqrtf(scale_data[j]) : 1.0f;
+		offset_data[j] = -offset_data[j] * scale_data[j];
+	}
+	return;
+}
+
+void aimath_f32_default_fold_scale_offset(const aitensor_t *scale, const aitensor_t *offset, aitensor_t *weights, aitensor_t *bias)
+{
+	uint16_t i, j;
+	uint16_t rows = weights->shape[0];
+	uint16_t cols = weights->shape[1];
+	float *scale_data = (float *) scale->data;
+	float *offset_data = (float *) offset->data;
+	float *weights_data = (float *) weights->data;
+	float *bias_data = (float *) bias->data;
+
+	for(i = 0; i < rows; i++)
+	{
+		for(j = 0; j < cols; j++)
+		{
+			bias_data[j] += offset_data[i] * weights_data[i*cols + j];
+			weights_data[i*cols + j] *= scale_data[i];
+		}
+	}
+	return;
+}
+
+void aimath_f32_default_copy_tensor(const aitensor_t *from, aitensor_t *to)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(from);
+	for(i = 0; i < elements; i++)
+	{
+		((float *) to->data)[i] = ((float *) from->data)[i];
+	}
+	return;
+}
+
+void aimath_f32_default_transpose_vector(aitensor_t *vector)
+{
+	uint16_t temp;
+	temp = vector->shape[0];
+	vector->shape[0] = vector->shape[1];
+	vector->shape[1] = temp;
+	return;
+}
+
+void aimath_f32_default_norm_squared(const aitensor_t *x, void *result)
+{
+	*((float *) result) = aimath_f32_default_pairwise_sum_squares((float *) x->data, aimath_tensor_elements(x), 0.0f);
+	return;
+}
+
+void aimath_f32_default_tensor_sub_norm_squared(const aitensor_t *a, const aitensor_t *b, aitensor_t *result, void *norm)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(a);
+	float *a_data = (float *) a->data;
+	float *b_data = (float *) b->data;
+	float *result_data = (float *) result->data;
+	float difference;
+	float sum = 0.0f;
+
+	for(i = 0; i < elements; i++)
+	{
+		difference = a_data[i] - b_data[i];
+		result_data[i] = difference;
+		sum += difference * difference;
+	}
+	*((float *) norm) = sum;
+	return;
+}
+
+void aimath_f32_default_sum(const aitensor_t *x, void *result)
+{
+	*((float *) result) = aimath_f32_default_pairwise_sum((float *) x->data, aimath_tensor_elements(x));
+	return;
+}
+
+void aimath_f32_default_min(const aitensor_t *x, void *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	float *x_data = (float *) x->data;
+	float min_value = FLT_MAX;
+
+	for(i = 0; i < elements; i++)
+	{
+		if(x_data[i] < min_value){
+			min_value = x_data[i];
+		}
+	}
+	*((float *) result) = min_value;
+	return;
+}
+
+
+void aimath_f32_default_max(const aitensor_t *x, void *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	float *x_data = (float *) x->data;
+	float max_value = -FLT_MAX;
+
+	for(i = 0; i < elements; i++)
+	{
+		if(x_data[i] > max_value){
+			max_value = x_data[i];
+		}
+	}
+	*((float *) result) = max_value;
+	return;
+}
+
+// Pairwise summation over the rows of a strided block: acc_l = sum_r f(x[r * stride + l]) for l < lanes
+// with f(v) = v (center == 0) or f(v) = (v - center_l)^2. The lanes are independent accumulators that the
+// compiler can map to SIMD registers. The rounding error grows with O(log(rows)) instead of O(rows).
+static void aimath_f32_default_pairwise_rows(const float *x, uint32_t rows, uint32_t stride, uint16_t lanes, const float *center, float *acc)
+{
+	uint32_t r, half;
+	uint16_t l;
+	float right[AIMATH_F32_REDUCE_LANES];
+	float difference;
+	const float *row;
+
+	if(rows > AIMATH_F32_PAIRWISE_BLOCK){
+		half = rows / 2;
+		aimath_f32_default_pairwise_rows(x, half, stride, lanes, center, acc);
+		aimath_f32_default_pairwise_rows(x + half * stride, rows - half, stride, lanes, center, right);
+		for(l = 0; l < lanes; l++)
+		{
+			acc[l] += right[l];
+		}
+		return;
+	}
+
+	for(l = 0; l < lanes; l++)
+	{
+		acc[l] = 0.0f;
+	}
+	for(r = 0; r < rows; r++)
+	{
+		row = x + r * stride;
+		if(center == 0){
+			for(l = 0; l < lanes; l++)
+			{
+				acc[l] += row[l];
+			}
+		} else {
+			for(l = 0; l < lanes; l++)
+			{
+				difference = row[l] - center[l];
+				acc[l] += difference * difference;
+			}
+		}
+	}
+	return;
+}
+
+// Sum of a contiguous array, the array is viewed as rows of AIMATH_F32_REDUCE_LANES elements
+static float aimath_f32_default_pairwise_sum_centered(const float *x, uint32_t count, const float *center)
+{
+	uint32_t i;
+	uint32_t rows = count / AIMATH_F32_REDUCE_LANES;
+	float acc[AIMATH_F32_REDUCE_LANES];
+	float difference, tail = 0.0f;
+
+	if(rows > 0){
+		aimath_f32_default_pairwise_rows(x, rows, AIMATH_F32_REDUCE_LANES, AIMATH_F32_REDUCE_LANES, center, acc);
+	} else {
+		for(i = 0; i < AIMATH_F32_REDUCE_LANES; i++)
+		{
+			acc[i] = 0.0f;
+		}
+	}
+	for(i = rows * AIMATH_F32_REDUCE_LANES; i < count; i++)
+	{
+		if(center == 0){
+			tail += x[i];
+		} else {
+			difference = x[i] - center[0];
+			tail += difference * difference;
+		}
+	}
+	// Add the lanes as a tree
+	return (((acc[0] + acc[4]) + (acc[2] + acc[6])) + ((acc[1] + acc[5]) + (acc[3] + acc[7]))) + tail;
+}
+
+float aimath_f32_default_pairwise_sum(const float *x, uint32_t count)
+{
+	return aimath_f32_default_pairwise_sum_centered(x, count, 0);
+}
+
+float aimath_f32_default_pairwise_sum_squares(const float *x, uint32_t count, float center)
+{
+	uint16_t l;
+	float centers[AIMATH_F32_REDUCE_LANES];
+
+	for(l = 0; l < AIMATH_F32_REDUCE_LANES; l++)
+	{
+		centers[l] = center;
+	}
+	return aimath_f32_default_pairwise_sum_centered(x, count, centers);
+}
+
+// View the tensor as [outer x n x inner] with n = shape[axis]
+static void aimath_f32_default_axis_view(const aitensor_t *x, uint8_t axis, uint32_t *outer, uint32_t *n, uint32_t *inner)
+{
+	uint8_t i;
+
+	*outer = 1;
+	*inner = 1;
+	for(i = 0; i < axis; i++)
+	{
+		*outer *= x->shape[i];
+	}
+	*n = x->shape[axis];
+	for(i = axis + 1; i < x->dim; i++)
+	{
+		*inner *= x->shape[i];
+	}
+	return;
+}
+
+#ifdef SHAPE_CHECK
+static uint8_t aimath_f32_default_check_reduce_shape(const aitensor_t *x, uint8_t axis, uint32_t result_elements)
+{
+	if(axis >= x->dim)
+	{
+		LOG_E("Reduction axis is out of range.\n");
+		return 1;
+	}
+	if(result_elements != aimath_tensor_elements(x) / x->shape[axis])
+	{
+		LOG_E("Reduction output shape doesn't match.\n");
+		return 1;
+	}
+	return 0;
+}
+#endif
+
+void aimath_f32_default_reduce_sum(const aitensor_t *x, uint8_t axis, aitensor_t *result)
+{
+	uint32_t o, c, outer, n, inner;
+	uint16_t l, lanes;
+	float acc[AIMATH_F32_REDUCE_LANES];
+	float *x_data = (float *) x->data;
+	float *result_data = (float *) result->data;
+
+#ifdef SHAPE_CHECK
+	if(aimath_f32_default_check_reduce_shape(x, axis, aimath_tensor_elements(result))) return;
+#endif
+
+	aimath_f32_default_axis_view(x, axis, &outer, &n, &inner);
+	for(o = 0; o < outer; o++)
+	{
+		if(inner == 1){
+			result_data[o] = aimath_f32_default_pairwise_sum(&x_data[o * n], n);
+			continue;
+		}
+		for(c = 0; c < inner; c += AIMATH_F32_REDUCE_LANES)
+		{
+			lanes = inner - c < AIMATH_F32_REDUCE_LANES ? inner - c : AIMATH_F32_REDUCE_LANES;
+			aimath_f32_default_pairwise_rows(&x_data[o * n * inner + c], n, inner, lanes, 0, acc);
+			for(l = 0; l < lanes; l++)
+			{
+				result_data[o * inner + c + l] = acc[l];
+			}
+		}
+	}
+	return;
+}
+
+void aimath_f32_default_reduce_mean(const aitensor_t *x, uint8_t axis, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(result);
+	float *result_data = (float *) result->data;
+	float scale = 1.0f / (float) x->shape[axis];
+
+	aimath_f32_default_reduce_sum(x, axis, result);
+	for(i = 0; i < elements; i++)
+	{
+		result_data[i] *= scale;
+	}
+	return;
+}
+
+void aimath_f32_default_reduce_variance(const aitensor_t *x, uint8_t axis, aitensor_t *result)
+{
+	uint32_t o, c, outer, n, inner;
+	uint16_t l, lanes;
+	float mean[AIMATH_F32_REDUCE_LANES];
+	float acc[AIMATH_F32_REDUCE_LANES];
+	float scale;
+	float *x_data = (float *) x->data;
+	float *result_data = (float *) result->data;
+
+#ifdef SHAPE_CHECK
+	if(aimath_f32_default_check_reduce_shape(x, axis, aimath_tensor_elements(result))) return;
+#endif
+
+	aimath_f32_default_axis_view(x, axis, &outer, &n, &inner);
+	scale = 1.0f / (float) n;
+	for(o = 0; o < outer; o++)
+	{
+		// Two passes for a numerically stable variance
+		if(inner == 1){
+			mean[0] = aimath_f32_default_pairwise_sum(&x_data[o * n], n) * scale;
+			result_data[o] = aimath_f32_default_pairwise_sum_squares(&x_data[o * n], n, mean[0]) * scale;
+			continue;
+		}
+		for(c = 0; c < inner; c += AIMATH_F32_REDUCE_LANES)
+		{
+			lanes = inner - c < AIMATH_F32_REDUCE_LANES ? inner - c : AIMATH_F32_REDUCE_LANES;
+			aimath_f32_default_pairwise_rows(&x_data[o * n * inner + c], n, inner, lanes, 0, mean);
+			for(l = 0; l < lanes; l++)
+			{
+				mean[l] *= scale;
+			}
+			aimath_f32_default_pairwise_rows(&x_data[o * n * inner + c], n, inner, lanes, mean, acc);
+			for(l = 0; l < lanes; l++)
+			{
+				result_data[o * inner + c + l] = acc[l] * scale;
+			}
+		}
+	}
+	return;
+}
+
+void aimath_f32_default_reduce_max(const aitensor_t *x, uint8_t axis, aitensor_t *result)
 {
-	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(a); i++)
+	uint32_t o, i, j, outer, n, inner;
+	float *x_data = (float *) x->data;
+	float *result_data = (float *) result->data;
+	const float *row;
+	float *max_row;
+
+#ifdef SHAPE_CHECK
+	if(aimath_f32_default_check_reduce_shape(x, axis, aimath_tensor_elements(result))) return;
+#endif
+
+	aimath_f32_default_axis_view(x, axis, &outer, &n, &inner);
+	for(o = 0; o < outer; o++)
 	{
-		((float *) result->data)[i] = ((float *) a->data)[i] * ((float *) b->data)[i];
+		max_row = &result_data[o * inner];
+		for(j = 0; j < inner; j++)
+		{
+			max_row[j] = x_data[o * n * inner + j];
+		}
+		for(i = 1; i < n; i++)
+		{
+			row = &x_data[(o * n + i) * inner];
+			for(j = 0; j < inner; j++)
+			{
+				max_row[j] = row[j] > max_row[j] ? row[j] : max_row[j];
+			}
+		}
 	}
 	return;
 }
 
-void aimath_f32_default_divide(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+void aimath_f32_default_reduce_argmax(const aitensor_t *x, uint8_t axis, uint16_t *indices)
 {
-	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(a); i++)
+	uint32_t o, i, j, outer, n, inner;
+	float *x_data = (float *) x->data;
+	const float *row;
+	uint16_t *index_row;
+
+#ifdef SHAPE_CHECK
+	if(axis >= x->dim)
 	{
-		((float *) result->data)[i] = ((float *) a->data)[i] / ((float *) b->data)[i];
+		LOG_E("Reduction axis is out of range.\n");
+		return;
+	}
+#endif
+
+	aimath_f32_default_axis_view(x, axis, &outer, &n, &inner);
+	for(o = 0; o < outer; o++)
+	{
+		index_row = &indices[o * inner];
+		for(j = 0; j < inner; j++)
+		{
+			index_row[j] = 0;
+		}
+		for(i = 1; i < n; i++)
+		{
+			row = &x_data[(o * n + i) * inner];
+			for(j = 0; j < inner; j++)
+			{
+				// The first maximum is kept
+				if(row[j] > x_data[(o * n + index_row[j]) * inner + j]){
+					index_row[j] = i;
+				}
+			}
+		}
 	}
 	return;
 }
 
-void aimath_f32_default_scalar_mul(const void *scalar, const aitensor_t *a, aitensor_t *result)
+void aimath_f32_default_top_k(const aitensor_t *x, uint16_t k, uint16_t *indices)
 {
 	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(a); i++)
+	uint32_t elements = aimath_tensor_elements(x);
+	uint16_t j, count = 0;
+	float *x_data = (float *) x->data;
+
+#ifdef SHAPE_CHECK
+	if(k > elements)
 	{
-		((float *) result->data)[i] = *((float *) scalar) * ((float *) a->data)[i];
+		LOG_E("Top k: k is larger than the number of elements.\n");
+		return;
+	}
+#endif
+	if(k == 0) return;
+
+	for(i = 0; i < elements; i++)
+	{
+		if(count == k && x_data[i] <= x_data[indices[k - 1]]) continue;
+
+		// Insert the index into the sorted list
+		j = count < k ? count++ : k - 1;
+		while(j > 0 && x_data[indices[j - 1]] < x_data[i])
+		{
+			indices[j] = indices[j - 1];
+			j--;
+		}
+		indices[j] = i;
 	}
 	return;
 }
 
-void aimath_f32_default_scalar_add(const void *scalar, const aitensor_t *a, aitensor_t *result)
+void aimath_f32_default_softmax_selected(const aitensor_t *x, uint16_t k, const uint16_t *indices, float *result)
 {
 	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(a); i++)
+	uint32_t elements = aimath_tensor_elements(x);
+	float max;
+	float exp_sum = 0.0f;
+	float *x_data = (float *) x->data;
+
+	aimath_f32_default_max(x, &max);
+	for(i = 0; i < elements; i++)
 	{
-		((float *) result->data)[i] = *((float *) scalar) + ((float *) a->data)[i];
+		exp_sum += aimath_f32_default_expf_fast(x_data[i] - max);
+	}
+	for(i = 0; i < k; i++)
+	{
+		result[i] = aimath_f32_default_expf_fast(x_data[indices[i]] - max) / exp_sum;
 	}
 	return;
 }
 
-/**
-* Add 2D tensors
-*/
-void aimath_f32_default_tensor_add(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+
+void aimath_f32_default_sigmoid(const aitensor_t *x, aitensor_t *result)
 {
 	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(a); i++)
+	uint32_t elements = aimath_tensor_elements(x);
+
+	for(i = 0; i < elements; i++)
 	{
-		((float *) result->data)[i] = ((float *) a->data)[i] + ((float *) b->data)[i];
+		((float *) result->data)[i] = 1.0f / (1.0f + expf(- ((float *) x->data)[i]));
 	}
 	return;
 }
 
-void aimath_f32_default_tensor_sub(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+void aimath_f32_default_d_sigmoid(const aitensor_t *sigmoid_x, aitensor_t *result)
 {
 	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(a); i++)
+	uint32_t elements = aimath_tensor_elements(sigmoid_x);
+	for(i = 0; i < elements; i++)
 	{
-		((float *) result->data)[i] = ((float *) a->data)[i] - ((float *) b->data)[i];
+		// sigmoid'(x) = sigmoid(x) * (1 - sigmoid(x))
+		((float *) result->data)[i] = ((float *) sigmoid_x->data)[i] * (1.0f - ((float *) sigmoid_x->data)[i]);
 	}
 	return;
 }
 
-// only for 2D tensors
-// a: f32
-// b: u8
-// result: f32
-void aimath_f32_default_tensor_sub_sparse8(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+void aimath_f32_default_sigmoid_backward(const aitensor_t *x, const aitensor_t *delta_out, aitensor_t *delta_in)
 {
-	uint32_t i, index;
-	for(i = 0; i < a->shape[0]; i++)
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	float s;
+	float *x_data = (float *) x->data;
+	float *delta_out_data = (float *) delta_out->data;
+	float *delta_in_data = (float *) delta_in->data;
+
+	for(i = 0; i < elements; i++)
 	{
-	    index = a->shape[1] * i + ((uint8_t *) b->data)[i];
-		((float *) result->data)[index] = ((float *) a->data)[index] - 1.0f;
+		s = 1.0f / (1.0f + expf(- x_data[i]));
+		delta_in_data[i] = delta_out_data[i] * s * (1.0f - s);
 	}
 	return;
 }
 
-void aimath_f32_default_copy_tensor(const aitensor_t *from, aitensor_t *to)
+void aimath_f32_default_tanh(const aitensor_t *x, aitensor_t *result)
 {
 	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(from); i++)
+	uint32_t elements = aimath_tensor_elements(x);
+	float temp;
+	for(i = 0; i < elements; i++)
 	{
-		((float *) to->data)[i] = ((float *) from->data)[i];
+	    temp = expf(((float *) x->data)[i]);
+		((float *) result->data)[i] = (temp - (1.0f/temp)) / (temp + (1.0f/temp));
 	}
 	return;
 }
 
-void aimath_f32_default_transpose_vector(aitensor_t *vector)
+void aimath_f32_default_d_tanh(const aitensor_t *tanh_x, aitensor_t *result)
 {
-	uint16_t temp;
-	temp = vector->shape[0];
-	vector->shape[0] = vector->shape[1];
-	vector->shape[1] = temp;
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(tanh_x);
+	for(i = 0; i < elements; i++)
+	{
+		// tanh'(x) = 1 - (tanh(x))^2
+		((float *) result->data)[i] = 1.0f - (((float *) tanh_x->data)[i] * ((float *) tanh_x->data)[i]);
+	}
 	return;
 }
 
-void aimath_f32_default_norm_squared(const aitensor_t *x, void *result)
+void aimath_f32_default_tanh_backward(const aitensor_t *x, const aitensor_t *delta_out, aitensor_t *delta_in)
 {
 	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	float t;
+	float *x_data = (float *) x->data;
+	float *delta_out_data = (float *) delta_out->data;
+	float *delta_in_data = (float *) delta_in->data;
 
-	*((float *) result) = 0.0f;
-
-	for(i = 0; i < x->shape[0] * x->shape[1]; i++)
+	for(i = 0; i < elements; i++)
 	{
-		*((float *) result) += ((float *) x->data)[i] * ((float *) x->data)[i];
+		t = tanhf(x_data[i]);
+		delta_in_data[i] = delta_out_data[i] * (1.0f - t * t);
 	}
 	return;
 }
 
-void aimath_f32_default_sum(const aitensor_t *x, void *result)
+void aimath_f32_default_relu(const aitensor_t *x, aitensor_t *result)
 {
 	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
 
-	*((float *) result) = 0.0f;
-
-	for(i = 0; i < x->shape[0] * x->shape[1]; i++)
+	for(i = 0; i < elements; i++)
 	{
-		*((float *) result) += ((float *) x->data)[i];
+		((float *) result->data)[i] = ((float *) x->data)[i] > 0.0f ? ((float *) x->data)[i] : 0.0f;
 	}
 	return;
 }
 
-void aimath_f32_default_min(const aitensor_t *x, void *result)
+void aimath_f32_default_d_relu(const aitensor_t *x, aitensor_t *result)
 {
-    uint32_t i;
-    float min_value = FLT_MAX;
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
 
-	for(i = 0; i < aimath_tensor_elements(x); i++)
+	for(i = 0; i < elements; i++)
 	{
-		if(((float *) x->data)[i] < min_value){
-            min_value = ((float *) x->data)[i];
-		}
+		((float *) result->data)[i] = ((float *) x->data)[i] >= 0.0f ? 1.0f : 0.0f;
 	}
-	*((float *) result) = min_value;
 	return;
 }
 
-
-void aimath_f32_default_max(const aitensor_t *x, void *result)
+void aimath_f32_default_relu_backward(const aitensor_t *x, const aitensor_t *delta_out, aitensor_t *delta_in)
 {
-    uint32_t i;
-    float max_value = -FLT_MAX;
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	float *x_data = (float *) x->data;
+	float *delta_out_data = (float *) delta_out->data;
+	float *delta_in_data = (float *) delta_in->data;
 
-	for(i = 0; i < aimath_tensor_elements(x); i++)
+	for(i = 0; i < elements; i++)
 	{
-		if(((float *) x->data)[i] > max_value){
-            max_value = ((float *) x->data)[i];
-		}
+		delta_in_data[i] = x_data[i] >= 0.0f ? delta_out_data[i] : 0.0f;
 	}
-	*((float *) result) = max_value;
 	return;
 }
 
-
-void aimath_f32_default_sigmoid(const aitensor_t *x, aitensor_t *result)
+void aimath_f32_default_relu_mask(const aitensor_t *x, aitensor_t *result, uint8_t *mask)
 {
 	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	float *x_data = (float *) x->data;
+	float *result_data = (float *) result->data;
+	uint8_t bits = 0;
 
-	for(i = 0; i < aimath_tensor_elements(x); i++)
+	for(i = 0; i < elements; i++)
 	{
-		((float *) result->data)[i] = 1.0f / (1.0f + expf(- ((float *) x->data)[i]));
+		if(x_data[i] >= 0.0f){
+			bits |= (uint8_t) (1 << (i % 8));
+			result_data[i] = x_data[i];
+		} else {
+			result_data[i] = 0.0f;
+		}
+		if(i % 8 == 7){
+			mask[i / 8] = bits;
+			bits = 0;
+		}
+	}
+	if(elements % 8 != 0){
+		mask[elements / 8] = bits;
 	}
 	return;
 }
 
-void aimath_f32_default_d_sigmoid(const aitensor_t *sigmoid_x, aitensor_t *result)
+void aimath_f32_default_relu_backward_mask(const uint8_t *mask, const aitensor_t *delta_out, aitensor_t *delta_in)
 {
 	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(sigmoid_x); i++)
+	uint32_t elements = aimath_tensor_elements(delta_out);
+	float *delta_out_data = (float *) delta_out->data;
+	float *delta_in_data = (float *) delta_in->data;
+
+	for(i = 0; i < elements; i++)
 	{
-		// sigmoid'(x) = sigmoid(x) * (1 - sigmoid(x))
-		((float *) result->data)[i] = ((float *) sigmoid_x->data)[i] * (1.0f - ((float *) sigmoid_x->data)[i]);
+		delta_in_data[i] = (mask[i / 8] >> (i % 8)) & 1 ? delta_out_data[i] : 0.0f;
 	}
 	return;
 }
 
-void aimath_f32_default_tanh(const aitensor_t *x, aitensor_t *result)
+void aimath_f32_default_leaky_relu(const aitensor_t *x, const void *alpha, aitensor_t *result)
 {
 	uint32_t i;
-	float temp;
-	for(i = 0; i < aimath_tensor_elements(x); i++)
+	uint32_t elements = aimath_tensor_elements(x);
+
+	for(i = 0; i < elements; i++)
 	{
-	    temp = expf(((float *) x->data)[i]);
-		((float *) result->data)[i] = (temp - (1.0f/temp)) / (temp + (1.0f/temp));
+		((float *) result->data)[i] = ((float *) x->data)[i] >= 0.0f ? ((float *) x->data)[i] : ((float *) x->data)[i] * *((float *) alpha);
 	}
 	return;
 }
 
-void aimath_f32_default_d_tanh(const aitensor_t *tanh_x, aitensor_t *result)
+void aimath_f32_default_d_leaky_relu(const aitensor_t *x, const void *alpha, aitensor_t *result)
 {
 	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(tanh_x); i++)
+	uint32_t elements = aimath_tensor_elements(x);
+
+	for(i = 0; i < elements; i++)
 	{
-		// tanh'(x) = 1 - (tanh(x))^2
-		((float *) result->data)[i] = 1.0f - (((float *) tanh_x->data)[i] * ((float *) tanh_x->data)[i]);
+		((float *) result->data)[i] = ((float *) x->data)[i] >= 0.0f ? 1.0f : *((float *) alpha);
 	}
 	return;
 }
 
-void aimath_f32_default_relu(const aitensor_t *x, aitensor_t *result)
+void aimath_f32_default_leaky_relu_backward(const aitensor_t *x, const void *alpha, const aitensor_t *delta_out, aitensor_t *delta_in)
 {
 	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	float a = *((float *) alpha);
+	float *x_data = (float *) x->data;
+	float *delta_out_data = (float *) delta_out->data;
+	float *delta_in_data = (float *) delta_in->data;
 
-	for(i = 0; i < aimath_tensor_elements(x); i++)
+	for(i = 0; i < elements; i++)
 	{
-		((float *) result->data)[i] = ((float *) x->data)[i] > 0.0f ? ((float *) x->data)[i] : 0.0f;
+		delta_in_data[i] = x_data[i] >= 0.0f ? delta_out_data[i] : delta_out_data[i] * a;
 	}
 	return;
 }
 
-void aimath_f32_default_d_relu(const aitensor_t *x, aitensor_t *result)
+void aimath_f32_default_leaky_relu_mask(const aitensor_t *x, const void *alpha, aitensor_t *result, uint8_t *mask)
 {
 	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	float a = *((float *) alpha);
+	float *x_data = (float *) x->data;
+	float *result_data = (float *) result->data;
+	uint8_t bits = 0;
 
-	for(i = 0; i < aimath_tensor_elements(x); i++)
+	for(i = 0; i < elements; i++)
 	{
-		((float *) result->data)[i] = ((float *) x->data)[i] >= 0.0f ? 1.0f : 0.0f;
+		if(x_data[i] >= 0.0f){
+			bits |= (uint8_t) (1 << (i % 8));
+			result_data[i] = x_data[i];
+		} else {
+			result_data[i] = x_data[i] * a;
+		}
+		if(i % 8 == 7){
+			mask[i / 8] = bits;
+			bits = 0;
+		}
+	}
+	if(elements % 8 != 0){
+		mask[elements / 8] = bits;
 	}
 	return;
 }
 
-void aimath_f32_default_leaky_relu(const aitensor_t *x, const void *alpha, aitensor_t *result)
+void aimath_f32_default_leaky_relu_backward_mask(const uint8_t *mask, const void *alpha, const aitensor_t *delta_out, aitensor_t *delta_in)
 {
 	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(delta_out);
+	float a = *((float *) alpha);
+	float *delta_out_data = (float *) delta_out->data;
+	float *delta_in_data = (float *) delta_in->data;
 
-	for(i = 0; i < aimath_tensor_elements(x); i++)
+	for(i = 0; i < elements; i++)
 	{
-		((float *) result->data)[i] = ((float *) x->data)[i] >= 0.0f ? ((float *) x->data)[i] : ((float *) x->data)[i] * *((float *) alpha);
+		delta_in_data[i] = (mask[i / 8] >> (i % 8)) & 1 ? delta_out_data[i] : delta_out_data[i] * a;
 	}
 	return;
 }
 
-void aimath_f32_default_d_leaky_relu(const aitensor_t *x, const void *alpha, aitensor_t *result)
+void aimath_f32_default_elu(const aitensor_t *x, const void *alpha, aitensor_t *result)
 {
 	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
 
-	for(i = 0; i < aimath_tensor_elements(x); i++)
+	for(i = 0; i < elements; i++)
 	{
-		((float *) result->data)[i] = ((float *) x->data)[i] >= 0.0f ? 1.0f : *((float *) alpha);
+		((float *) result->data)[i] = ((float *) x->data)[i] > 0.0f ? ((float *) x->data)[i] : (*((float *) alpha) * (exp(((float *) x->data)[i]) - 1.0f));
 	}
 	return;
 }
 
-void aimath_f32_default_elu(const aitensor_t *x, const void *alpha, aitensor_t *result)
+void aimath_f32_default_d_elu(const aitensor_t *x, const void *alpha, aitensor_t *result)
 {
 	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
 
-	for(i = 0; i < aimath_tensor_elements(x); i++)
+	for(i = 0; i < elements; i++)
 	{
-		((float *) result->data)[i] = ((float *) x->data)[i] > 0.0f ? ((float *) x->data)[i] : (*((float *) alpha) * (exp(((float *) x->data)[i]) - 1.0f));
+		((float *) result->data)[i] = ((float *) x->data)[i] > 0.0f ? 1.0f : (*((float *) alpha) * expf(((float *) x->data)[i]));
 	}
 	return;
 }
 
-void aimath_f32_default_d_elu(const aitensor_t *x, const void *alpha, aitensor_t *result)
+void aimath_f32_default_elu_backward(const aitensor_t *x, const void *alpha, const aitensor_t *delta_out, aitensor_t *delta_in)
 {
 	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	float a = *((float *) alpha);
+	float *x_data = (float *) x->data;
+	float *delta_out_data = (float *) delta_out->data;
+	float *delta_in_data = (float *) delta_in->data;
 
-	for(i = 0; i < aimath_tensor_elements(x); i++)
+	for(i = 0; i < elements; i++)
 	{
-		((float *) result->data)[i] = ((float *) x->data)[i] > 0.0f ? 1.0f : (*((float *) alpha) * expf(((float *) x->data)[i]));
+		delta_in_data[i] = x_data[i] > 0.0f ? delta_out_data[i] : delta_out_data[i] * a * expf(x_data[i]);
 	}
 	return;
 }
@@ -356,7 +1346,7 @@ void aimath_f32_default_softmax(const aitensor_t *x, aitensor_t *result)
  	// Do for every dataset. (0 is batch dimension)
  	for(i = 0; i < x->shape[0]; i++){
         // calc max value for numeric stability
-        max = x_data[0];
+        max = x_data[i * multiplier];
         for(j = 0; j < multiplier; j++)
         {
             if(x_data[i * multiplier + j] > max) max = x_data[i * multiplier + j];
@@ -380,8 +1370,9 @@ void aimath_f32_default_softmax(const aitensor_t *x, aitensor_t *result)
 void aimath_f32_default_softsign(const aitensor_t *x, aitensor_t *result)
 {
 	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
 
-	for(i = 0; i < aimath_tensor_elements(x); i++)
+	for(i = 0; i < elements; i++)
 	{
 		((float *) result->data)[i] = ((float *) x->data)[i] / (1.0f + fabs(((float *) x->data)[i]));
 	}
@@ -391,20 +1382,39 @@ void aimath_f32_default_softsign(const aitensor_t *x, aitensor_t *result)
 void aimath_f32_default_d_softsign(const aitensor_t *x, aitensor_t *result)
 {
 	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
 
-	for(i = 0; i < aimath_tensor_elements(x); i++)
+	for(i = 0; i < elements; i++)
 	{
 		((float *) result->data)[i] = 1.0f / pow((1.0f + abs(((float *) x->data)[i])), 2);
 	}
 	return;
 }
 
+void aimath_f32_default_softsign_backward(const aitensor_t *x, const aitensor_t *delta_out, aitensor_t *delta_in)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	float s;
+	float *x_data = (float *) x->data;
+	float *delta_out_data = (float *) delta_out->data;
+	float *delta_in_data = (float *) delta_in->data;
+
+	for(i = 0; i < elements; i++)
+	{
+		s = 1.0f / (1.0f + fabsf(x_data[i]));
+		delta_in_data[i] = delta_out_data[i] * s * s;
+	}
+	return;
+}
+
 // predicted data: f32
 // target_data: f32
 void aimath_f32_default_binary_crossentropy(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result)
 {
 	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(predicted_data); i++)
+	uint32_t elements = aimath_tensor_elements(predicted_data);
+	for(i = 0; i < elements; i++)
 	{
         if(((float *) target_data->data)[i] != 0){
             *((float *) result) -= ((float *) target_data->data)[i] * log(((float *) predicted_data->data)[i])
@@ -419,7 +1429,8 @@ void aimath_f32_default_binary_crossentropy(const aitensor_t *predicted_data, co
 void aimath_f32_default_categorical_crossentropy(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result)
 {
 	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(predicted_data); i++)
+	uint32_t elements = aimath_tensor_elements(predicted_data);
+	for(i = 0; i < elements; i++)
 	{
         if(((float *) target_data->data)[i] != 0){
             *((float *) result) -= ((float *) target_data->data)[i] * log(((float *) predicted_data->data)[i]);
@@ -442,20 +1453,260 @@ void aimath_f32_default_categorical_crossentropy_sparse8(const aitensor_t *predi
 	return;
 }
 
+// Writes softmax(x / temperature) of a row to result and returns log(sum(exp((x - max) / temperature)))
+static float aimath_f32_default_softmax_temperature_row(const float *x, uint16_t count, float inv_temperature, float *max_value, float *result)
+{
+	uint16_t j;
+	float max = x[0];
+	float exp_sum = 0.0f;
+
+	for(j = 1; j < count; j++)
+	{
+		if(x[j] > max) max = x[j];
+	}
+	for(j = 0; j < count; j++)
+	{
+		result[j] = expf((x[j] - max) * inv_temperature);
+		exp_sum += result[j];
+	}
+	for(j = 0; j < count; j++)
+	{
+		result[j] /= exp_sum;
+	}
+	*max_value = max;
+	return logf(exp_sum);
+}
+
+void aimath_f32_default_distillation_delta(const aitensor_t *logits, const aitensor_t *probabilities, const aitensor_t *target_data,
+										   const aitensor_t *teacher_logits, const void *temperature, const void *alpha, aitensor_t *result)
+{
+	uint16_t i, j;
+	uint16_t rows = logits->shape[0];
+	uint16_t cols = logits->shape[1];
+	float t = *((float *) temperature);
+	float a = *((float *) alpha);
+	float max;
+	float soft_student[cols];
+	float soft_teacher[cols];
+
+	float *z = (float *) logits->data;
+	float *p = (float *) probabilities->data;
+	float *y = (float *) target_data->data;
+	float *teacher = (float *) teacher_logits->data;
+	float *result_data = (float *) result->data;
+
+	for(i = 0; i < rows; i++)
+	{
+		aimath_f32_default_softmax_temperature_row(&z[i * cols], cols, 1.0f / t, &max, soft_student);
+		aimath_f32_default_softmax_temperature_row(&teacher[i * cols], cols, 1.0f / t, &max, soft_teacher);
+		for(j = 0; j < cols; j++)
+		{
+			result_data[i * cols + j] = a * t * (soft_student[j] - soft_teacher[j]) + (1.0f - a) * (p[i * cols + j] - y[i * cols + j]);
+		}
+	}
+	return;
+}
+
+void aimath_f32_default_distillation_loss(const aitensor_t *logits, const aitensor_t *probabilities, const aitensor_t *target_data,
+										  const aitensor_t *teacher_logits, const void *temperature, const void *alpha, void *result)
+{
+	uint16_t i, j;
+	uint16_t rows = logits->shape[0];
+	uint16_t cols = logits->shape[1];
+	float t = *((float *) temperature);
+	float a = *((float *) alpha);
+	float max_student, max_teacher, log_sum_student, log_sum_teacher;
+	float log_student, log_teacher;
+	float kl = 0.0f, crossentropy = 0.0f;
+	float soft_student[cols];
+	float soft_teacher[cols];
+
+	float *z = (float *) logits->data;
+	float *p = (float *) probabilities->data;
+	float *y = (float *) target_data->data;
+	float *teacher = (float *) teacher_logits->data;
+
+	for(i = 0; i < rows; i++)
+	{
+		log_sum_student = aimath_f32_default_softmax_temperature_row(&z[i * cols], cols, 1.0f / t, &max_student, soft_student);
+		log_sum_teacher = aimath_f32_default_softmax_temperature_row(&teacher[i * cols], cols, 1.0f / t, &max_teacher, soft_teacher);
+		for(j = 0; j < cols; j++)
+		{
+			log_student = (z[i * cols + j] - max_student) / t - log_sum_student;
+			log_teacher = (teacher[i * cols + j] - max_teacher) / t - log_sum_teacher;
+			kl += soft_teacher[j] * (log_teacher - log_student);
+			if(y[i * cols + j] != 0.0f){
+				crossentropy -= y[i * cols + j] * logf(p[i * cols + j] > FLT_MIN ? p[i * cols + j] : FLT_MIN);
+			}
+		}
+	}
+	*((float *) result) = a * t * t * kl + (1.0f - a) * crossentropy;
+	return;
+}
+
 void aimath_f32_default_sqrt(const aitensor_t *x, aitensor_t *result)
 {
 	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(x); i++)
+	uint32_t elements = aimath_tensor_elements(x);
+	for(i = 0; i < elements; i++)
 	{
 		((float *) result->data)[i] = sqrt(((float *) x->data)[i]);
 	}
 	return;
 }
 
+void aimath_f32_default_window(const aitensor_t *x, const aitensor_t *window, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(result);
+	uint32_t length = aimath_tensor_elements(window);
+	float *x_data = (float *) x->data;
+	float *window_data = (float *) window->data;
+	float *result_data = (float *) result->data;
+
+	for(i = 0; i < length; i++)
+	{
+		result_data[i] = x_data[i] * window_data[i];
+	}
+	for(i = length; i < elements; i++)
+	{
+		result_data[i] = 0.0f;
+	}
+	return;
+}
+
+void aimath_f32_default_rfft(aitensor_t *x, const aitensor_t *twiddles)
+{
+	uint32_t i, j, k, half, step;
+	uint32_t length = aimath_tensor_elements(x);
+	uint32_t complex_length = length / 2;
+	float *data = (float *) x->data;
+	float *twiddle_data = (float *) twiddles->data;
+	float temp, wr, wi, tr, ti, er, ei, or, oi;
+
+	// Bit reversal permutation of the complex values z_n = x_2n + i * x_2n+1
+	for(i = 1, j = 0; i < complex_length; i++)
+	{
+		k = complex_length >> 1;
+		while(j & k){
+			j ^= k;
+			k >>= 1;
+		}
+		j |= k;
+		if(i < j){
+			temp = data[2*i]; data[2*i] = data[2*j]; data[2*j] = temp;
+			temp = data[2*i+1]; data[2*i+1] = data[2*j+1]; data[2*j+1] = temp;
+		}
+	}
+
+	// Complex radix-2 FFT of length N/2 (W_N/2^j = W_N^2j)
+	for(half = 1; half < complex_length; half <<= 1)
+	{
+		step = complex_length / half;
+		for(i = 0; i < complex_length; i += 2 * half)
+		{
+			for(j = 0; j < half; j++)
+			{
+				wr = twiddle_data[2*j*step];
+				wi = -twiddle_data[2*j*step + 1];
+				k = i + j + half;
+				tr = wr * data[2*k] - wi * data[2*k+1];
+				ti = wr * data[2*k+1] + wi * data[2*k];
+				data[2*k] = data[2*(i+j)] - tr;
+				data[2*k+1] = data[2*(i+j)+1] - ti;
+				data[2*(i+j)] += tr;
+				data[2*(i+j)+1] += ti;
+			}
+		}
+	}
+
+	// Split step: X_k = E_k + W_N^k * O_k and X_N/2-k = conj(E_k - W_N^k * O_k)
+	temp = data[0];
+	data[0] = temp + data[1];
+	data[1] = temp - data[1];
+	for(k = 1; k <= complex_length / 2; k++)
+	{
+		j = complex_length - k;
+		er = 0.5f * (data[2*k] + data[2*j]);
+		ei = 0.5f * (data[2*k+1] - data[2*j+1]);
+		or = 0.5f * (data[2*k+1] + data[2*j+1]);
+		oi = -0.5f * (data[2*k] - data[2*j]);
+		wr = twiddle_data[2*k];
+		wi = -twiddle_data[2*k+1];
+		tr = wr * or - wi * oi;
+		ti = wr * oi + wi * or;
+		data[2*k] = er + tr;
+		data[2*k+1] = ei + ti;
+		if(j != k){
+			data[2*j] = er - tr;
+			data[2*j+1] = ti - ei;
+		}
+	}
+	return;
+}
+
+void aimath_f32_default_power_spectrum(const aitensor_t *x, aitensor_t *result)
+{
+	uint32_t k;
+	uint32_t complex_length = aimath_tensor_elements(x) / 2;
+	float *x_data = (float *) x->data;
+	float *result_data = (float *) result->data;
+
+	result_data[0] = x_data[0] * x_data[0];
+	result_data[complex_length] = x_data[1] * x_data[1];
+	for(k = 1; k < complex_length; k++)
+	{
+		result_data[k] = x_data[2*k] * x_data[2*k] + x_data[2*k+1] * x_data[2*k+1];
+	}
+	return;
+}
+
+void aimath_f32_default_mel_filterbank(const aitensor_t *power, const int16_t *mel_index, const aitensor_t *mel_weights, aitensor_t *result)
+{
+	uint32_t k;
+	int16_t j;
+	int16_t mel_count = aimath_tensor_elements(result);
+	float *power_data = (float *) power->data;
+	float *weights_data = (float *) mel_weights->data;
+	float *result_data = (float *) result->data;
+
+	for(j = 0; j < mel_count; j++)
+	{
+		result_data[j] = 0.0f;
+	}
+	for(k = 0; k < aimath_tensor_elements(power); k++)
+	{
+		j = mel_index[k];
+		if(j < 0) continue;
+		if(j < mel_count){
+			result_data[j] += weights_data[k] * power_data[k];
+		}
+		if(j > 0){
+			result_data[j - 1] += (1.0f - weights_data[k]) * power_data[k];
+		}
+	}
+	return;
+}
+
+void aimath_f32_default_log(const aitensor_t *x, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	float *x_data = (float *) x->data;
+	float *result_data = (float *) result->data;
+
+	for(i = 0; i < elements; i++)
+	{
+		result_data[i] = logf(x_data[i] > FLT_MIN ? x_data[i] : FLT_MIN);
+	}
+	return;
+}
+
 void aimath_f32_default_zero_tensor(aitensor_t *tensor)
 {
 	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(tensor); i++)
+	uint32_t elements = aimath_tensor_elements(tensor);
+	for(i = 0; i < elements; i++)
 	{
 		((float *) tensor->data)[i] = 0.0f;
 	}
@@ -471,7 +1722,8 @@ void aimath_f32_default_init_zeros(aitensor_t *tensor)
 void aimath_f32_default_tensor_init_uniform(aitensor_t *tensor, float from, float to)
 {
 	uint32_t i;
-	for(i = 0; i < aimath_tensor_elements(tensor); i++)
+	uint32_t elements = aimath_tensor_elements(tensor);
+	for(i = 0; i < elements; i++)
 	{
 		((float *) tensor->data)[i] = ((float) rand() / (float) RAND_MAX) * (to - from) + from;
 	}
@@ -495,6 +1747,11 @@ void aimath_f32_default_init_glorot_uniform(aitensor_t *tensor)
 		fan_in = tensor->shape[0];
 		fan_out = tensor->shape[1];
 	}
+	else if(tensor->dim == 3)
+	{
+		fan_in = tensor->shape[1]; // Stacked weight matrices [models x inputs x outputs]
+		fan_out = tensor->shape[2];
+	}
 	else if(tensor->dim == 4)
 	{
 		fan_in = tensor->shape[1] * tensor->shape[2] * tensor->shape[3]; // In channel * kernel_elems
@@ -520,6 +1777,10 @@ void aimath_f32_default_init_he_uniform(aitensor_t *tensor)
 	{
 		fan_in = tensor->shape[0];
 	}
+	else if(tensor->dim == 3)
+	{
+		fan_in = tensor->shape[1]; // Stacked weight matrices [models x inputs x outputs]
+	}
 	else if(tensor->dim == 4)
 	{
 		fan_in = tensor->shape[1] * tensor->shape[2] * tensor->shape[3]; // In channel * kernel_elems
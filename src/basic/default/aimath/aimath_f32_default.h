@@ -35,6 +35,9 @@
 
 #include "basic/base/aimath/aimath_f32.h"
 
+#define AIMATH_F32_REDUCE_LANES     8 /**< Number of independent accumulators in the reductions (fixed, the lanes are added as a tree of 8) */
+#define AIMATH_F32_PAIRWISE_BLOCK   32 /**< Number of rows that are summed up sequentially before the pairwise summation splits a block */
+
 /** @brief Performs a matrix multiplication of \link aimath_f32.h F32 \endlink matrices a and b and adds a vector c to each row
  *
  * The addition of the horizontal vector c is performed via broadcast, i.e. element wise in each column
@@ -136,6 +139,98 @@
  */
 void aimath_f32_default_linear(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
 
+/** @brief Performs the linear transformations of N stacked \link aimath_f32.h F32 \endlink models with one call
+  *
+  * The weight matrices of the models are stored in one 3D tensor and every model n calculates
+  * @f[
+  *  result_n = a_n \cdot b_n \oplus c_n
+  * @f]
+  * on its own part of the inputs. The results of the models are concatenated in the rows of the result.
+  * If a has only the inputs of one model (a->shape[1] equals the inputs of b), all models read the same inputs.
+  *
+  * @param *a       F32 matrix with the inputs (2D tensor of shape [B x N*K] or [B x K] for shared inputs)
+  * @param *b       F32 weights of the models (3D tensor of shape [N x K x M])
+  * @param *c       F32 bias of the models (2D tensor of shape [N x M]) or 0 for no bias
+  * @param *result  Resulting F32 matrix (2D tensor of shape [B x N*M])
+  */
+void aimath_f32_default_linear_stacked(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
+
+/** @brief Calculates the gradients and the input deltas of N stacked \link aimath_f32.h F32 \endlink linear transformations in one pass
+  *
+  * For every model n:
+  * @f[
+  *  \partial w_n \leftarrow \partial w_n + x_n^T \cdot \delta_{out,n}, \quad
+  *  \partial b_n \leftarrow \partial b_n + \sum_{rows} \delta_{out,n}, \quad
+  *  \delta_{in,n} \leftarrow \delta_{out,n} \cdot w_n^T
+  * @f]
+  *
+  * With shared inputs (x has only the inputs of one model), the input deltas of all models are summed.
+  * The gradients are calculated before the input deltas, so delta_in may share the memory with x.
+  *
+  * @param *x           F32 matrix with the inputs of the forward pass (2D tensor of shape [B x N*K] or [B x K])
+  * @param *delta_out   F32 matrix with the output deltas (2D tensor of shape [B x N*M])
+  * @param *weights     F32 weights of the models (3D tensor of shape [N x K x M])
+  * @param *d_weights   F32 weight gradients (3D tensor of shape [N x K x M], accumulated)
+  * @param *d_bias      F32 bias gradients (2D tensor of shape [N x M], accumulated)
+  * @param *delta_in    Resulting F32 input deltas (same shape as x) or 0 if not needed
+  */
+void aimath_f32_default_linear_stacked_backward(const aitensor_t *x, const aitensor_t *delta_out, const aitensor_t *weights,
+												aitensor_t *d_weights, aitensor_t *d_bias, aitensor_t *delta_in);
+
+/** @brief Calculates the input deltas of a \link aimath_f32.h F32 \endlink linear transformation and applies a SGD update to the parameters in one pass
+  *
+  * @f[
+  *  \delta_{in} \leftarrow \delta_{out} \cdot w^T, \quad
+  *  w \leftarrow w - \eta \cdot x^T \cdot \delta_{out}, \quad
+  *  b \leftarrow b - \eta \cdot \sum_{rows} \delta_{out}
+  * @f]
+  *
+  * The weights are processed row by row: The input deltas of row k are calculated with the old weights before the row
+  * is updated, so every weight is read and written only once. Column k of x is only read before the column k of
+  * delta_in is written, so delta_in may share the memory with x.
+  *
+  * @param *x             F32 matrix with the inputs of the forward pass (2D tensor of shape [N x K])
+  * @param *delta_out     F32 matrix with the output deltas (2D tensor of shape [N x M])
+  * @param *learning_rate Learning rate \f$ \eta \f$ (type aiscalar_f32_t / float)
+  * @param *weights       F32 weights (2D tensor of shape [K x M], updated)
+  * @param *bias          F32 bias (2D tensor of shape [1 x M], updated)
+  * @param *delta_in      Resulting F32 input deltas (2D tensor of shape [N x K])
+  */
+void aimath_f32_default_linear_backward_sgd(const aitensor_t *x, const aitensor_t *delta_out, const void *learning_rate,
+											aitensor_t *weights, aitensor_t *bias, aitensor_t *delta_in);
+
+/** @brief Updates the result of a matrix multiplication for changed elements of the \link aimath_f32.h F32 \endlink matrix a (rank-k update)
+ *
+ * For every element of a that differs from the previous value in a_prev, the result is updated with the difference:
+ * @f[
+ *  result_{i,:} \leftarrow result_{i,:} + (a_{ik} - a\_prev_{ik}) \cdot b_{k,:} \quad \forall \; a_{ik} \neq a\_prev_{ik}
+ * @f]
+ * and a_prev is set to the new value. So the result stays equal to \f$ a \cdot b + c \f$ of a former linear
+ * transformation, but only the changed elements cost operations (K times less than a full multiplication for one
+ * changed element).
+ *
+ * If more than max_changes elements have changed, nothing is updated (the full calculation is cheaper then).
+ *
+ * Example:
+ * \code{.c}
+ * uint32_t changed;
+ *
+ * changed = aimath_f32_default_linear_incremental(&a, &a_prev, &b, &result, 4);
+ * if(changed > 4){
+ *     aimath_f32_default_linear(&a, &b, &c, &result);
+ *     aimath_f32_default_copy_tensor(&a, &a_prev);
+ * }
+ * \endcode
+ *
+ * @param *a            F32 matrix a with the new values (2D tensor of shape [N x K])
+ * @param *a_prev       F32 matrix with the previous values of a (2D tensor of shape [N x K]), updated to a
+ * @param *b            F32 matrix b (2D tensor of shape [K x M])
+ * @param *result       F32 matrix with the previous result (2D tensor of shape [N x M]), updated in place
+ * @param max_changes   Maximum number of changed elements for the update
+ * @return              Number of changed elements of a
+ */
+uint32_t aimath_f32_default_linear_incremental(const aitensor_t *a, aitensor_t *a_prev, const aitensor_t *b, aitensor_t *result, uint32_t max_changes);
+
 /** @brief Performs a matrix multiplication of \link aimath_f32.h F32 \endlink matrices a and b
   *
   * @f[
@@ -367,6 +462,99 @@ void aimath_f32_default_tensor_add(const aitensor_t *a, const aitensor_t *b, ait
   */
 void aimath_f32_default_tensor_sub(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
 
+/** @brief Performs an element wise operation of two \link aimath_f32.h F32 \endlink tensors with broadcasting and a precomputed plan
+  *
+  * The shapes of a and b are broadcast to the shape of the result with the numpy rules (see aimath_broadcast_plan).
+  * The innermost merged dimension is calculated in a contiguous loop. Scalar, row vector ([N x K] and [1 x K])
+  * and column vector ([N x K] and [N x 1]) operands (see aimath_broadcast_plan.kind) are calculated directly row by row,
+  * only the other shapes (AIMATH_BROADCAST_GENERAL) step through the outer dimensions with an index counter.
+  *
+  * Calculate the plan once with aimath_broadcast_plan() if the operation is executed repeatedly on tensors with
+  * the same shapes (for example in the forward pass of a layer).
+  *
+  * Example:
+  * \code{.c}
+  * uint16_t x_shape[2] = {2, 3};
+  * float x_data[2*3] = {1.0f, 2.0f, 3.0f,
+  *                      4.0f, 5.0f, 6.0f};
+  * aitensor_t x = AITENSOR_2D_F32(x_shape, x_data);
+  *
+  * uint16_t mean_shape[2] = {2, 1};
+  * float mean_data[2*1] = {2.0f, 5.0f};
+  * aitensor_t mean = AITENSOR_2D_F32(mean_shape, mean_data);
+  *
+  * aimath_broadcast_plan_t plan;
+  * aimath_broadcast_plan(&x, &mean, &plan); // AIMATH_BROADCAST_COLUMN_B
+  *
+  * aimath_f32_default_broadcast(&plan, AIMATH_BROADCAST_SUB, &x, &mean, &x);
+  *
+  * print_aitensor(&x);
+  * \endcode
+  *
+  * @param *plan        Plan calculated with aimath_broadcast_plan() for the shapes of a and b
+  * @param operation    AIMATH_BROADCAST_ADD, AIMATH_BROADCAST_SUB, AIMATH_BROADCAST_MULTIPLY or AIMATH_BROADCAST_DIVIDE
+  * @param *a           F32 tensor a (N-D tensor)
+  * @param *b           F32 tensor b (N-D tensor)
+  * @param *result      Resulting F32 tensor with the broadcast shape (N-D tensor, may be the same tensor as a or b if it has the broadcast shape)
+  */
+void aimath_f32_default_broadcast(const aimath_broadcast_plan_t *plan, uint8_t operation, const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
+
+/** @brief Adds two \link aimath_f32.h F32 \endlink tensors element wise with broadcasting
+  *
+  * @f[
+  *  result = a + b
+  * @f]
+  *
+  * The plan is calculated in every call, see aimath_f32_default_broadcast().
+  *
+  * @param *a       F32 tensor a (N-D tensor)
+  * @param *b       F32 tensor b (N-D tensor)
+  * @param *result  Resulting F32 tensor with the broadcast shape (N-D tensor)
+  */
+void aimath_f32_default_broadcast_add(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
+
+/** @brief Subtracts two \link aimath_f32.h F32 \endlink tensors element wise with broadcasting
+  *
+  * @f[
+  *  result = a - b
+  * @f]
+  *
+  * The plan is calculated in every call, see aimath_f32_default_broadcast().
+  *
+  * @param *a       F32 tensor a (N-D tensor)
+  * @param *b       F32 tensor b (N-D tensor)
+  * @param *result  Resulting F32 tensor with the broadcast shape (N-D tensor)
+  */
+void aimath_f32_default_broadcast_sub(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
+
+/** @brief Multiplies two \link aimath_f32.h F32 \endlink tensors element wise with broadcasting
+  *
+  * @f[
+  *  result = a \circ b
+  * @f]
+  *
+  * The plan is calculated in every call, see aimath_f32_default_broadcast().
+  *
+  * @param *a       F32 tensor a (N-D tensor)
+  * @param *b       F32 tensor b (N-D tensor)
+  * @param *result  Resulting F32 tensor with the broadcast shape (N-D tensor)
+  */
+void aimath_f32_default_broadcast_multiply(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
+
+/** @brief Divides two \link aimath_f32.h F32 \endlink tensors element wise with broadcasting
+  *
+  * @f[
+  *  result = a \oslash b
+  * @f]
+  *
+  * The plan is calculated in every call, see aimath_f32_default_broadcast().
+  *
+  * @param *a       F32 tensor a (N-D tensor)
+  * @param *b       F32 tensor b (N-D tensor)
+  * @param *result  Resulting F32 tensor with the broadcast shape (N-D tensor)
+  */
+void aimath_f32_default_broadcast_divide(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
+
 /** @brief Performs a subtraction between a \link aimath_f32.h F32 \endlink matrix a and a \link aimath_u8.h U8 \endlink sparse matrix b
   *
   * This function can subtract a row wise one-hot encoded matrix in sparse representation
@@ -416,6 +604,72 @@ void aimath_f32_default_tensor_sub(const aitensor_t *a, const aitensor_t *b, ait
   */
 void aimath_f32_default_tensor_sub_sparse8(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
 
+/** @brief Scales the columns of a \link aimath_f32.h F32 \endlink matrix and adds an offset vector to each row
+  *
+  * @f[
+  *  result_{ij} = x_{ij} \cdot scale_j + offset_j
+  * @f]
+  *
+  * Example:
+  * \code{.c}
+  * uint16_t x_shape[2] = {2, 3};
+  * float x_data[2*3] = {1.0f, 2.0f, 3.0f,
+  *                      4.0f, 5.0f, 6.0f};
+  * aitensor_t x = AITENSOR_2D_F32(x_shape, x_data);
+  *
+  * uint16_t scale_shape[2] = {1, 3};
+  * float scale_data[1*3] = {0.5f, 1.0f, 2.0f};
+  * aitensor_t scale = AITENSOR_2D_F32(scale_shape, scale_data);
+  *
+  * uint16_t offset_shape[2] = {1, 3};
+  * float offset_data[1*3] = {-1.0f, 0.0f, 1.0f};
+  * aitensor_t offset = AITENSOR_2D_F32(offset_shape, offset_data);
+  *
+  * uint16_t result_shape[2] = {2, 3};
+  * float result_data[2*3];
+  * aitensor_t result = AITENSOR_2D_F32(result_shape, result_data);
+  *
+  * aimath_f32_default_scale_offset(&x, &scale, &offset, &result);
+  *
+  * print_aitensor(&result);
+  * \endcode
+  *
+  * @param *x       F32 matrix x (2D tensor of shape [N x K])
+  * @param *scale   F32 vector scale (2D tensor of shape [1 x K])
+  * @param *offset  F32 vector offset (2D tensor of shape [1 x K]) or 0 for no offset
+  * @param *result  Resulting F32 matrix (2D tensor of shape [N x K])
+  */
+void aimath_f32_default_scale_offset(const aitensor_t *x, const aitensor_t *scale, const aitensor_t *offset, aitensor_t *result);
+
+/** @brief Calculates the scale and offset that standardize the columns of a \link aimath_f32.h F32 \endlink matrix
+  *
+  * @f[
+  *  scale_j = \frac{1}{\sigma_j}, \quad offset_j = - \frac{\mu_j}{\sigma_j}
+  * @f]
+  *
+  * \f$ \mu_j \f$ and \f$ \sigma_j \f$ are the mean and the (population) standard deviation of column j.
+  * Columns with a standard deviation of zero get a scale of 1.
+  *
+  * @param *x       F32 matrix x with one sample per row (2D tensor of shape [N x K])
+  * @param *scale   Resulting F32 vector scale (2D tensor of shape [1 x K])
+  * @param *offset  Resulting F32 vector offset (2D tensor of shape [1 x K])
+  */
+void aimath_f32_default_standardization(const aitensor_t *x, aitensor_t *scale, aitensor_t *offset);
+
+/** @brief Folds a column scaling and offset of the inputs into the weights and bias of a linear transformation (\link aimath_f32.h F32 \endlink)
+  *
+  * Afterwards \f$ x \cdot W' + b' = (x \circ scale + offset) \cdot W + b \f$ for every row vector x:
+  * @f[
+  *  b'_j = b_j + \sum_i offset_i \cdot W_{ij}, \quad W'_{ij} = scale_i \cdot W_{ij}
+  * @f]
+  *
+  * @param *scale   F32 vector scale (2D tensor of shape [1 x K])
+  * @param *offset  F32 vector offset (2D tensor of shape [1 x K])
+  * @param *weights F32 matrix W (2D tensor of shape [K x M]), modified in place
+  * @param *bias    F32 vector b (2D tensor of shape [1 x M]), modified in place
+  */
+void aimath_f32_default_fold_scale_offset(const aitensor_t *scale, const aitensor_t *offset, aitensor_t *weights, aitensor_t *bias);
+
 /** @brief Performs an element wise copy of \link aimath_f32.h F32 \endlink tensors
   *
   * @f[
@@ -493,6 +747,21 @@ void aimath_f32_default_transpose_vector(aitensor_t *vector);
   */
 void aimath_f32_default_norm_squared(const aitensor_t *x, void *result);
 
+/** @brief Subtracts two \link aimath_f32.h F32 \endlink tensors element wise and calculates the squared sum of the differences in one pass
+  *
+  * @f[
+  *  result = a - b, \quad norm = \sum_i (a_i - b_i)^2
+  * @f]
+  *
+  * result may be the same tensor as a or b.
+  *
+  * @param *a       F32 tensor a (N-D tensor)
+  * @param *b       F32 tensor b (N-D tensor)
+  * @param *result  Resulting F32 tensor of the element wise subtraction (N-D tensor)
+  * @param *norm    Resulting F32 squared sum (type aiscalar_f32_t / float)
+  */
+void aimath_f32_default_tensor_sub_norm_squared(const aitensor_t *a, const aitensor_t *b, aitensor_t *result, void *norm);
+
 /** @brief Calculates the sum of all elements in a \link aimath_f32.h F32 \endlink tensor
   *
   * @f[
@@ -570,6 +839,159 @@ void aimath_f32_default_min(const aitensor_t *x, void *result);
   */
 void aimath_f32_default_max(const aitensor_t *x, void *result);
 
+/** @brief Calculates the sum of a \link aimath_f32.h F32 \endlink array with pairwise summation
+  *
+  * The array is summed up in AIMATH_F32_REDUCE_LANES independent accumulators (which can be mapped to SIMD registers
+  * by the compiler). Blocks of more than AIMATH_F32_PAIRWISE_BLOCK rows are split into halves that are summed up
+  * separately, so the rounding error grows with \f$ O(\log N) \f$ instead of \f$ O(N) \f$ for the naive sum.
+  *
+  * @param *x       F32 array
+  * @param count    Number of elements
+  * @return         Sum of the elements
+  */
+float aimath_f32_default_pairwise_sum(const float *x, uint32_t count);
+
+/** @brief Calculates the sum of the squared differences to a center of a \link aimath_f32.h F32 \endlink array with pairwise summation
+  *
+  * @f[
+  *  result = \sum_i (x_i - center)^2
+  * @f]
+  *
+  * See aimath_f32_default_pairwise_sum() for the summation.
+  *
+  * @param *x       F32 array
+  * @param count    Number of elements
+  * @param center   Value that is subtracted from every element (0 for the squared sum)
+  * @return         Sum of the squared differences
+  */
+float aimath_f32_default_pairwise_sum_squares(const float *x, uint32_t count, float center);
+
+/** @brief Calculates the sum of a \link aimath_f32.h F32 \endlink tensor along an axis
+  *
+  * @f[
+  *  result_{o,i} = \sum_{k} x_{o,k,i}
+  * @f]
+  *
+  * The tensor is viewed as [outer x shape[axis] x inner]. The result has the same dimension as x with a shape of 1 at
+  * the reduced axis (it has aimath_tensor_elements(x) / shape[axis] elements). The summation is pairwise (see
+  * aimath_f32_default_pairwise_sum()); for inner > 1, AIMATH_F32_REDUCE_LANES neighboring columns are summed up together.
+  *
+  * Example:
+  * \code{.c}
+  * uint16_t x_shape[2] = {2, 3};
+  * float x_data[2*3] = {0.0f, 1.0f, 2.0f,
+  *                      3.0f, 4.0f, 5.0f};
+  * aitensor_t x = AITENSOR_2D_F32(x_shape, x_data);
+  *
+  * uint16_t result_shape[2] = {1, 3};
+  * float result_data[1*3];
+  * aitensor_t result = AITENSOR_2D_F32(result_shape, result_data);
+  *
+  * aimath_f32_default_reduce_sum(&x, 0, &result); // {3.0f, 5.0f, 7.0f}
+  * \endcode
+  *
+  * @param *x       F32 tensor x (N-D tensor)
+  * @param axis     Axis to reduce (0 ... x->dim - 1)
+  * @param *result  Resulting F32 tensor (N-D tensor with shape[axis] = 1)
+  */
+void aimath_f32_default_reduce_sum(const aitensor_t *x, uint8_t axis, aitensor_t *result);
+
+/** @brief Calculates the mean of a \link aimath_f32.h F32 \endlink tensor along an axis
+  *
+  * @f[
+  *  result_{o,i} = \frac{1}{K} \sum_{k} x_{o,k,i}
+  * @f]
+  *
+  * See aimath_f32_default_reduce_sum() for the shapes.
+  *
+  * @param *x       F32 tensor x (N-D tensor)
+  * @param axis     Axis to reduce (0 ... x->dim - 1)
+  * @param *result  Resulting F32 tensor (N-D tensor with shape[axis] = 1)
+  */
+void aimath_f32_default_reduce_mean(const aitensor_t *x, uint8_t axis, aitensor_t *result);
+
+/** @brief Calculates the (population) variance of a \link aimath_f32.h F32 \endlink tensor along an axis
+  *
+  * @f[
+  *  result_{o,i} = \frac{1}{K} \sum_{k} (x_{o,k,i} - \mu_{o,i})^2
+  * @f]
+  *
+  * The mean and the variance are calculated in two pairwise summed passes for a numerically stable result.
+  * See aimath_f32_default_reduce_sum() for the shapes.
+  *
+  * @param *x       F32 tensor x (N-D tensor)
+  * @param axis     Axis to reduce (0 ... x->dim - 1)
+  * @param *result  Resulting F32 tensor (N-D tensor with shape[axis] = 1)
+  */
+void aimath_f32_default_reduce_variance(const aitensor_t *x, uint8_t axis, aitensor_t *result);
+
+/** @brief Identifies the maximum values of a \link aimath_f32.h F32 \endlink tensor along an axis
+  *
+  * @f[
+  *  result_{o,i} = \max_{k} x_{o,k,i}
+  * @f]
+  *
+  * See aimath_f32_default_reduce_sum() for the shapes.
+  *
+  * @param *x       F32 tensor x (N-D tensor)
+  * @param axis     Axis to reduce (0 ... x->dim - 1)
+  * @param *result  Resulting F32 tensor (N-D tensor with shape[axis] = 1)
+  */
+void aimath_f32_default_reduce_max(const aitensor_t *x, uint8_t axis, aitensor_t *result);
+
+/** @brief Identifies the indices of the maximum values of a \link aimath_f32.h F32 \endlink tensor along an axis
+  *
+  * @f[
+  *  indices_{o,i} = \arg\max_{k} x_{o,k,i}
+  * @f]
+  *
+  * The index of the first maximum is returned. For a batch of class scores of shape [N x K], axis 1 gives the
+  * predicted class of every sample.
+  *
+  * @param *x       F32 tensor x (N-D tensor)
+  * @param axis     Axis to reduce (0 ... x->dim - 1)
+  * @param *indices Array with aimath_tensor_elements(x) / shape[axis] elements for the resulting indices
+  */
+void aimath_f32_default_reduce_argmax(const aitensor_t *x, uint8_t axis, uint16_t *indices);
+
+/** @brief Identifies the indices of the k largest values in a \link aimath_f32.h F32 \endlink tensor
+  *
+  * The indices (of the flattened tensor) are sorted in descending order of the values. For k = 1 this is the argmax.
+  * The selection needs \f$ O(N \cdot k) \f$ comparisons and no exponential functions.
+  *
+  * Example:
+  * \code{.c}
+  * uint16_t x_shape[2] = {1, 4};
+  * float x_data[1*4] = {0.5f, 2.0f, -1.0f, 1.0f};
+  * aitensor_t x = AITENSOR_2D_F32(x_shape, x_data);
+  *
+  * uint16_t indices[2];
+  *
+  * aimath_f32_default_top_k(&x, 2, indices); // indices = {1, 3}
+  * \endcode
+  *
+  * @param *x       F32 tensor x (N-D tensor of one sample)
+  * @param k        Number of indices to find (not more than the number of elements of x, nothing is done for 0)
+  * @param *indices Array with k elements for the resulting indices
+  */
+void aimath_f32_default_top_k(const aitensor_t *x, uint16_t k, uint16_t *indices);
+
+/** @brief Calculates the softmax probabilities of selected elements of a \link aimath_f32.h F32 \endlink tensor
+  *
+  * @f[
+  *  result_i = \frac{e^{x_{indices_i}}}{\sum_j e^{x_j}}
+  * @f]
+  *
+  * The probabilities are equal to the values of aimath_f32_default_softmax() at the given indices, but only k
+  * divisions are needed and no result tensor is written.
+  *
+  * @param *x           F32 tensor x with the logits (N-D tensor of one sample)
+  * @param k            Number of selected elements
+  * @param *indices     Indices of the selected elements (k elements)
+  * @param *result      Array with k elements for the resulting probabilities
+  */
+void aimath_f32_default_softmax_selected(const aitensor_t *x, uint16_t k, const uint16_t *indices, float *result);
+
 /** @brief Calculates the sigmoid of each element in a \link aimath_f32.h F32 \endlink tensor
   *
   * @f[
@@ -625,6 +1047,22 @@ void aimath_f32_default_sigmoid(const aitensor_t *x, aitensor_t *result);
   */
 void aimath_f32_default_d_sigmoid(const aitensor_t *sigmoid_x, aitensor_t *result);
 
+/** @brief Calculates the backward pass of the Sigmoid activation on a \link aimath_f32.h F32 \endlink tensor in one pass
+  *
+  * Fused version of the derivative and the element wise multiplication with the output deltas
+  * (without an intermediate tensor):
+  * @f[
+  *  \delta_{in,i} = \delta_{out,i} \cdot sigmoid(x_i) \cdot (1 - sigmoid(x_i))
+  * @f]
+  *
+  * delta_in may be the same tensor as x or delta_out.
+  *
+  * @param *x         F32 tensor with the inputs of the activation (N-D tensor)
+  * @param *delta_out F32 tensor with the deltas of the next layer (N-D tensor)
+  * @param *delta_in  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_sigmoid_backward(const aitensor_t *x, const aitensor_t *delta_out, aitensor_t *delta_in);
+
 /** @brief Calculates the tanh of each element in a \link aimath_f32.h F32 \endlink tensor
  *
  * @f[
@@ -680,6 +1118,22 @@ void aimath_f32_default_tanh(const aitensor_t *x, aitensor_t *result);
  */
 void aimath_f32_default_d_tanh(const aitensor_t *tanh_x, aitensor_t *result);
 
+/** @brief Calculates the backward pass of the Tanh activation on a \link aimath_f32.h F32 \endlink tensor in one pass
+  *
+  * Fused version of the derivative and the element wise multiplication with the output deltas
+  * (without an intermediate tensor):
+  * @f[
+  *  \delta_{in,i} = \delta_{out,i} \cdot (1 - tanh(x_i)^2)
+  * @f]
+  *
+  * delta_in may be the same tensor as x or delta_out.
+  *
+  * @param *x         F32 tensor with the inputs of the activation (N-D tensor)
+  * @param *delta_out F32 tensor with the deltas of the next layer (N-D tensor)
+  * @param *delta_in  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_tanh_backward(const aitensor_t *x, const aitensor_t *delta_out, aitensor_t *delta_in);
+
 /** @brief Calculates the rectifier (ReLU) value of each element in a \link aimath_f32.h F32 \endlink tensor
   *
   * @f[
@@ -738,6 +1192,53 @@ void aimath_f32_default_relu(const aitensor_t *x, aitensor_t *result);
   */
 void aimath_f32_default_d_relu(const aitensor_t *x, aitensor_t *result);
 
+/** @brief Calculates the backward pass of the ReLU activation on a \link aimath_f32.h F32 \endlink tensor in one pass
+  *
+  * Fused version of the derivative and the element wise multiplication with the output deltas
+  * (without an intermediate tensor):
+  * @f[
+  *  \delta_{in,i} = \delta_{out,i} \cdot relu'(x_i)
+  * @f]
+  *
+  * delta_in may be the same tensor as x or delta_out.
+  *
+  * @param *x         F32 tensor with the inputs of the activation (N-D tensor)
+  * @param *delta_out F32 tensor with the deltas of the next layer (N-D tensor)
+  * @param *delta_in  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_relu_backward(const aitensor_t *x, const aitensor_t *delta_out, aitensor_t *delta_in);
+
+/** @brief Calculates the ReLU of each element in a \link aimath_f32.h F32 \endlink tensor and stores the signs in a bit mask
+  *
+  * @f[
+  *  result_{i} = max(0, x_{i}), \quad mask_{i} = \begin{cases}
+                    0 & \text{if } x_i < 0\\
+                    1 & \text{if } x_i \geq 0
+                    \end{cases}
+  * @f]
+  *
+  * Bit i of the mask is stored in byte i / 8 at bit position i % 8. result may be the same tensor as x.
+  *
+  * @param *x       F32 tensor to calculate the ReLU from (N-D tensor)
+  * @param *result  Resulting F32 tensor (N-D tensor)
+  * @param *mask    Resulting sign mask with at least (elements + 7) / 8 bytes
+  */
+void aimath_f32_default_relu_mask(const aitensor_t *x, aitensor_t *result, uint8_t *mask);
+
+/** @brief Calculates the backward pass of the ReLU activation on a \link aimath_f32.h F32 \endlink tensor from a sign mask
+  *
+  * @f[
+  *  \delta_{in,i} = \delta_{out,i} \cdot mask_i
+  * @f]
+  *
+  * delta_in may be the same tensor as delta_out.
+  *
+  * @param *mask      Sign mask of aimath_f32_default_relu_mask()
+  * @param *delta_out F32 tensor with the deltas of the next layer (N-D tensor)
+  * @param *delta_in  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_relu_backward_mask(const uint8_t *mask, const aitensor_t *delta_out, aitensor_t *delta_in);
+
 /** @brief Calculates the leaky rectifier (leaky ReLU) value of each element in a \link aimath_f32.h F32 \endlink tensor
  *
  * @f[
@@ -804,6 +1305,53 @@ void aimath_f32_default_leaky_relu(const aitensor_t *x, const void *alpha, aiten
  */
 void aimath_f32_default_d_leaky_relu(const aitensor_t *x, const void *alpha, aitensor_t *result);
 
+/** @brief Calculates the backward pass of the Leaky ReLU activation on a \link aimath_f32.h F32 \endlink tensor in one pass
+  *
+  * Fused version of the derivative and the element wise multiplication with the output deltas
+  * (without an intermediate tensor):
+  * @f[
+  *  \delta_{in,i} = \delta_{out,i} \cdot leaky\_relu'(x_i)
+  * @f]
+  *
+  * delta_in may be the same tensor as x or delta_out.
+  *
+  * @param *x         F32 tensor with the inputs of the activation (N-D tensor)
+  * @param *alpha     Scalar \f$ \alpha \f$ (type aiscalar_f32_t / float)
+  * @param *delta_out F32 tensor with the deltas of the next layer (N-D tensor)
+  * @param *delta_in  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_leaky_relu_backward(const aitensor_t *x, const void *alpha, const aitensor_t *delta_out, aitensor_t *delta_in);
+
+/** @brief Calculates the Leaky ReLU of each element in a \link aimath_f32.h F32 \endlink tensor and stores the signs in a bit mask
+  *
+  * Like aimath_f32_default_leaky_relu(), additionally bit i of the mask (byte i / 8, bit position i % 8)
+  * is set to 1 if \f$ x_i \geq 0 \f$, else to 0. result may be the same tensor as x.
+  *
+  * @param *x        F32 tensor to calculate the leaky ReLU from (N-D tensor)
+  * @param *alpha    Scalar \f$ \alpha \f$ (type aiscalar_f32_t / float) for the leakage
+  * @param *result   Resulting F32 tensor (N-D tensor)
+  * @param *mask     Resulting sign mask with at least (elements + 7) / 8 bytes
+  */
+void aimath_f32_default_leaky_relu_mask(const aitensor_t *x, const void *alpha, aitensor_t *result, uint8_t *mask);
+
+/** @brief Calculates the backward pass of the Leaky ReLU activation on a \link aimath_f32.h F32 \endlink tensor from a sign mask
+  *
+  * @f[
+  *  \delta_{in,i} = \begin{cases}
+                \alpha \cdot \delta_{out,i} & \text{if } mask_i = 0\\
+                \delta_{out,i} & \text{if } mask_i = 1
+                \end{cases}
+  * @f]
+  *
+  * delta_in may be the same tensor as delta_out.
+  *
+  * @param *mask      Sign mask of aimath_f32_default_leaky_relu_mask()
+  * @param *alpha     Scalar \f$ \alpha \f$ (type aiscalar_f32_t / float)
+  * @param *delta_out F32 tensor with the deltas of the next layer (N-D tensor)
+  * @param *delta_in  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_leaky_relu_backward_mask(const uint8_t *mask, const void *alpha, const aitensor_t *delta_out, aitensor_t *delta_in);
+
 /** @brief Calculates the exponential rectifier (ELU) value of each element in a \link aimath_f32.h F32 \endlink tensor
  *
  * @f[
@@ -870,6 +1418,23 @@ void aimath_f32_default_elu(const aitensor_t *x, const void *alpha, aitensor_t *
  */
 void aimath_f32_default_d_elu(const aitensor_t *x, const void *alpha, aitensor_t *result);
 
+/** @brief Calculates the backward pass of the ELU activation on a \link aimath_f32.h F32 \endlink tensor in one pass
+  *
+  * Fused version of the derivative and the element wise multiplication with the output deltas
+  * (without an intermediate tensor):
+  * @f[
+  *  \delta_{in,i} = \delta_{out,i} \cdot elu'(x_i)
+  * @f]
+  *
+  * delta_in may be the same tensor as x or delta_out.
+  *
+  * @param *x         F32 tensor with the inputs of the activation (N-D tensor)
+  * @param *alpha     Scalar \f$ \alpha \f$ (type aiscalar_f32_t / float)
+  * @param *delta_out F32 tensor with the deltas of the next layer (N-D tensor)
+  * @param *delta_in  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_elu_backward(const aitensor_t *x, const void *alpha, const aitensor_t *delta_out, aitensor_t *delta_in);
+
 /** @brief Calculates the softmax value of each row of a \link aimath_f32.h F32 \endlink matrix
  *
  * @f[
@@ -951,6 +1516,22 @@ void aimath_f32_default_softsign(const aitensor_t *x, aitensor_t *result);
  */
 void aimath_f32_default_d_softsign(const aitensor_t *x, aitensor_t *result);
 
+/** @brief Calculates the backward pass of the Softsign activation on a \link aimath_f32.h F32 \endlink tensor in one pass
+  *
+  * Fused version of the derivative and the element wise multiplication with the output deltas
+  * (without an intermediate tensor):
+  * @f[
+  *  \delta_{in,i} = \delta_{out,i} \cdot \frac{1}{(1 + |x_i|)^2}
+  * @f]
+  *
+  * delta_in may be the same tensor as x or delta_out.
+  *
+  * @param *x         F32 tensor with the inputs of the activation (N-D tensor)
+  * @param *delta_out F32 tensor with the deltas of the next layer (N-D tensor)
+  * @param *delta_in  Resulting F32 tensor (N-D tensor)
+  */
+void aimath_f32_default_softsign_backward(const aitensor_t *x, const aitensor_t *delta_out, aitensor_t *delta_in);
+
 /** @brief Calculates the binary cross entropy between the \link aimath_f32.h F32 \endlink predicted and the target data
   *
   * @f[
@@ -1057,6 +1638,52 @@ void aimath_f32_default_categorical_crossentropy(const aitensor_t *predicted_dat
   */
 void aimath_f32_default_categorical_crossentropy_sparse8(const aitensor_t *predicted_data, const aitensor_t *target_data, void *result);
 
+/** @brief Calculates the combined deltas of a knowledge distillation loss with respect to the logits of the student
+  *
+  * For every row, the soft targets of the teacher and the soft predictions of the student are calculated with the
+  * temperature T:
+  * @f[
+  *  q = softmax \left( \frac{t}{T} \right), \quad p_T = softmax \left( \frac{z}{T} \right)
+  * @f]
+  *
+  * The deltas are the derivative of the loss (see aimath_f32_default_distillation_loss()) with respect to the logits z:
+  * @f[
+  *  result = \alpha \cdot T \cdot (p_T - q) + (1 - \alpha) \cdot (p - y)
+  * @f]
+  *
+  * @param *logits          F32 matrix with the logits z of the student (2D tensor of shape [N x M])
+  * @param *probabilities   F32 matrix with the softmax probabilities p of the student (2D tensor of shape [N x M])
+  * @param *target_data     F32 matrix with the one-hot encoded hard labels y (2D tensor of shape [N x M])
+  * @param *teacher_logits  F32 matrix with the logits t of the teacher (2D tensor of shape [N x M])
+  * @param *temperature     F32 scalar with the temperature T (type aiscalar_f32_t / float)
+  * @param *alpha           F32 scalar with the weight of the soft target loss (type aiscalar_f32_t / float)
+  * @param *result          Resulting F32 matrix (2D tensor of shape [N x M])
+  */
+void aimath_f32_default_distillation_delta(const aitensor_t *logits, const aitensor_t *probabilities, const aitensor_t *target_data,
+										   const aitensor_t *teacher_logits, const void *temperature, const void *alpha, aitensor_t *result);
+
+/** @brief Calculates a knowledge distillation loss from the logits of a student and a teacher
+  *
+  * Combines the Kullback-Leibler divergence between the soft targets of the teacher and the soft predictions of the
+  * student (scaled by \f$ T^2 \f$ to keep the gradient magnitude independent of the temperature) with the
+  * categorical Cross-Entropy on the hard labels:
+  * @f[
+  *  result = \alpha \cdot T^2 \cdot \sum_i q_i (\log(q_i) - \log(p_{T,i})) - (1 - \alpha) \cdot \sum_i y_i \log(p_i)
+  * @f]
+  *
+  * The logarithms of the soft values are calculated directly from the logits for numerical stability.
+  *
+  * @param *logits          F32 matrix with the logits z of the student (2D tensor of shape [N x M])
+  * @param *probabilities   F32 matrix with the softmax probabilities p of the student (2D tensor of shape [N x M])
+  * @param *target_data     F32 matrix with the one-hot encoded hard labels y (2D tensor of shape [N x M])
+  * @param *teacher_logits  F32 matrix with the logits t of the teacher (2D tensor of shape [N x M])
+  * @param *temperature     F32 scalar with the temperature T (type aiscalar_f32_t / float)
+  * @param *alpha           F32 scalar with the weight of the soft target loss (type aiscalar_f32_t / float)
+  * @param *result          Resulting F32 scalar (type aiscalar_f32_t / float)
+  */
+void aimath_f32_default_distillation_loss(const aitensor_t *logits, const aitensor_t *probabilities, const aitensor_t *target_data,
+										  const aitensor_t *teacher_logits, const void *temperature, const void *alpha, void *result);
+
 /** @brief Calculates the element wise square root of a \link aimath_f32.h F32 \endlink tensor
   *
   * @f[
@@ -1084,6 +1711,79 @@ void aimath_f32_default_categorical_crossentropy_sparse8(const aitensor_t *predi
   */
 void aimath_f32_default_sqrt(const aitensor_t *x, aitensor_t *result);
 
+/** @brief Multiplies a \link aimath_f32.h F32 \endlink signal frame element wise with a window function
+  *
+  * @f[
+  *  result_i = \begin{cases} x_i \cdot window_i & \text{if } i < L \\ 0 & \text{otherwise} \end{cases}
+  * @f]
+  *
+  * The result can be longer than the window (zero padding, for example to the length of a FFT).
+  *
+  * @param *x           F32 signal frame with at least L elements (N-D tensor)
+  * @param *window      F32 window function with L elements (N-D tensor)
+  * @param *result      Resulting F32 tensor with at least L elements (N-D tensor)
+  */
+void aimath_f32_default_window(const aitensor_t *x, const aitensor_t *window, aitensor_t *result);
+
+/** @brief Calculates the discrete Fourier transform of a real \link aimath_f32.h F32 \endlink signal (in place)
+  *
+  * @f[
+  *  X_k = \sum_{n=0}^{N-1} x_n \cdot e^{-2 \pi i k n / N}
+  * @f]
+  *
+  * The transform of the N real values is calculated with a complex radix-2 FFT of length N/2 and a split step.
+  * N has to be a power of two (N >= 4). The result is packed into the N elements of x:
+  * \f$ (X_0, X_{N/2}, Re(X_1), Im(X_1), \dots, Re(X_{N/2-1}), Im(X_{N/2-1})) \f$.
+  *
+  * The twiddle factors \f$ (cos(2 \pi k / N), sin(2 \pi k / N)) \f$ for \f$ k = 0 \dots N/2-1 \f$ are stored interleaved
+  * in a table with N elements.
+  *
+  * @param *x           F32 signal with N elements, replaced by the packed transform (N-D tensor)
+  * @param *twiddles    F32 twiddle factor table with N elements (N-D tensor)
+  */
+void aimath_f32_default_rfft(aitensor_t *x, const aitensor_t *twiddles);
+
+/** @brief Calculates the power spectrum of a packed real FFT result (\link aimath_f32.h F32 \endlink)
+  *
+  * @f[
+  *  result_k = |X_k|^2 \quad \text{for } k = 0 \dots N/2
+  * @f]
+  *
+  * @param *x           Packed transform from aimath_f32_default_rfft() with N elements (N-D tensor)
+  * @param *result      Resulting F32 power spectrum with N/2 + 1 elements (N-D tensor)
+  */
+void aimath_f32_default_power_spectrum(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Applies a triangular (mel) filterbank to a \link aimath_f32.h F32 \endlink power spectrum
+  *
+  * Neighboring triangular filters overlap by half, so every frequency bin k belongs to the rising edge of filter
+  * \f$ j = mel\_index_k \f$ with the weight \f$ w_k \f$ and to the falling edge of filter \f$ j - 1 \f$ with the weight
+  * \f$ 1 - w_k \f$. Bins with a negative index are ignored.
+  *
+  * @f[
+  *  result_j = \sum_{k: mel\_index_k = j} w_k \cdot power_k + \sum_{k: mel\_index_k = j + 1} (1 - w_k) \cdot power_k
+  * @f]
+  *
+  * @param *power           F32 power spectrum with K elements (N-D tensor)
+  * @param *mel_index       Index of the rising filter edge for every bin (K elements, -1 for unused bins)
+  * @param *mel_weights     F32 weights of the rising filter edges with K elements (N-D tensor)
+  * @param *result          Resulting F32 filterbank energies with M elements (N-D tensor)
+  */
+void aimath_f32_default_mel_filterbank(const aitensor_t *power, const int16_t *mel_index, const aitensor_t *mel_weights, aitensor_t *result);
+
+/** @brief Calculates the element wise natural logarithm of a \link aimath_f32.h F32 \endlink tensor
+  *
+  * @f[
+  *  result_i = ln(max(x_i, FLT\_MIN))
+  * @f]
+  *
+  * Values that are zero or negative are clamped to the smallest positive normalized float.
+  *
+  * @param *x           F32 tensor (N-D tensor)
+  * @param *result      Resulting F32 tensor of the same shape (N-D tensor)
+  */
+void aimath_f32_default_log(const aitensor_t *x, aitensor_t *result);
+
 /** @brief Fills a \link aimath_f32.h F32 \endlink tensor with zeros
   *
   * @f[
@@ -0,0 +1,683 @@
+/**
+ * \file basic/default/aimath/aimath_q15_default.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aimath_q15_default.h for documentation.
+ * \details
+ */
+
+#include "basic/default/aimath/aimath_q15_default.h"
+
+// Maximum difference of the shifts for the alignment of two values (int16 << 46 and the sum fits into int64)
+#define AIMATH_Q15_MAX_ALIGN_SHIFT	46
+
+// Maximum magnitude of the FFT inputs for which a radix-2 butterfly (|a| + sqrt(2) * |b|) fits into 16 bit
+// (with a margin for the rounding of the twiddle factors)
+#define AIMATH_Q15_FFT_MAX_INPUT	13500
+
+// ln(2) * 2^30
+#define AIMATH_Q15_LN2_Q30	744261118
+
+// State of the xorshift random number generator for the stochastic rounding
+static uint32_t aimath_q15_random_state = 2463534242u;
+
+static uint32_t aimath_q15_random(void)
+{
+	aimath_q15_random_state ^= aimath_q15_random_state << 13;
+	aimath_q15_random_state ^= aimath_q15_random_state >> 17;
+	aimath_q15_random_state ^= aimath_q15_random_state << 5;
+	return aimath_q15_random_state;
+}
+
+// Number of significant bits of the magnitude
+static int16_t aimath_q15_bits(uint64_t value)
+{
+	int16_t bits = 0;
+	while(value != 0){
+		bits++;
+		value >>= 1;
+	}
+	return bits;
+}
+
+// Shift right with rounding to nearest (shift > 0) or shift left (shift < 0)
+static int64_t aimath_q15_shift_round(int64_t value, int16_t shift)
+{
+	if(shift > 62){
+		return 0;
+	} else if(shift > 0){
+		return (value + ((int64_t) 1 << (shift - 1))) >> shift;
+	} else if(shift < 0){
+		return value * ((int64_t) 1 << (-shift));
+	}
+	return value;
+}
+
+static int16_t aimath_q15_saturate(int64_t value)
+{
+	return (int16_t) (value < -32768 ? -32768 : (value > 32767 ? 32767 : value));
+}
+
+// Right shift that normalizes the given maximum magnitude to 15 bits
+static int16_t aimath_q15_normalize_shift(uint64_t max_abs)
+{
+	return aimath_q15_bits(max_abs) - 15;
+}
+
+static uint64_t aimath_q15_abs(int64_t value)
+{
+	return value < 0 ? (uint64_t) -value : (uint64_t) value;
+}
+
+// Common shift of two values (the finer one, limited to keep the aligned values in 64 bit)
+static int16_t aimath_q15_common_shift(int16_t shift_a, int16_t shift_b)
+{
+	int16_t shift_min = shift_a < shift_b ? shift_a : shift_b;
+	int16_t shift_max = shift_a < shift_b ? shift_b : shift_a;
+
+	if(shift_max - shift_min > AIMATH_Q15_MAX_ALIGN_SHIFT){
+		return shift_min + AIMATH_Q15_MAX_ALIGN_SHIFT;
+	}
+	return shift_max;
+}
+
+void aimath_q15_default_quantize_f32(const aitensor_t *x, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	float *x_data = (float *) x->data;
+	int16_t *result_data = (int16_t *) result->data;
+	aimath_q15_params_t *params = (aimath_q15_params_t *) result->tensor_params;
+	float max_abs = 0.0f;
+	int exponent;
+
+	for(i = 0; i < elements; i++)
+	{
+		if(fabsf(x_data[i]) > max_abs) max_abs = fabsf(x_data[i]);
+	}
+
+	if(max_abs == 0.0f){
+		params->shift = 0;
+	} else {
+		// max_abs = m * 2^exponent with m in [0.5, 1)
+		frexpf(max_abs, &exponent);
+		params->shift = 15 - exponent;
+	}
+
+	for(i = 0; i < elements; i++)
+	{
+		result_data[i] = aimath_q15_saturate((int64_t) roundf(ldexpf(x_data[i], params->shift)));
+	}
+	return;
+}
+
+void aimath_q15_default_dequantize_f32(const aitensor_t *x, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	int16_t *x_data = (int16_t *) x->data;
+	float *result_data = (float *) result->data;
+	int16_t shift = ((aimath_q15_params_t *) x->tensor_params)->shift;
+
+	for(i = 0; i < elements; i++)
+	{
+		result_data[i] = ldexpf((float) x_data[i], -shift);
+	}
+	return;
+}
+
+// Sum of products for one element of the linear result, shifted to shift_common and with the bias added
+static int64_t aimath_q15_linear_element(const int16_t *a_row, const int16_t *b_data, const int16_t *c_data, uint16_t j, uint16_t inputs, uint16_t cols,
+                                         int16_t guard_bits, int16_t shift_sum, int16_t shift_c, int16_t shift_common)
+{
+	uint16_t k;
+	int32_t sum = 0;
+	int64_t value;
+
+	for(k = 0; k < inputs; k++)
+	{
+		sum += ((int32_t) a_row[k] * (int32_t) b_data[k*cols + j] + ((int32_t) 1 << (guard_bits - 1))) >> guard_bits;
+	}
+	value = aimath_q15_shift_round(sum, shift_sum - shift_common);
+	if(c_data != 0){
+		// Bias add
+		value += aimath_q15_shift_round(c_data[j], shift_c - shift_common);
+	}
+	return value;
+}
+
+// Two passes for the normalization of the result: The first pass finds the maximum magnitude, the second recomputes and stores the values
+void aimath_q15_default_linear(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result)
+{
+	uint16_t i, j;
+	uint16_t rows = a->shape[0];
+	uint16_t inputs = a->shape[1];
+	uint16_t cols = b->shape[1];
+	int64_t value;
+	uint64_t max_abs = 0;
+	int16_t guard_bits, shift_sum, shift_common, shift_norm;
+
+	int16_t *a_data = (int16_t *) a->data;
+	int16_t *b_data = (int16_t *) b->data;
+	int16_t *c_data = c != 0 ? (int16_t *) c->data : 0;
+	int16_t *result_data = (int16_t *) result->data;
+	int16_t shift_a = ((aimath_q15_params_t *) a->tensor_params)->shift;
+	int16_t shift_b = ((aimath_q15_params_t *) b->tensor_params)->shift;
+	int16_t shift_c = c != 0 ? ((aimath_q15_params_t *) c->tensor_params)->shift : 0;
+
+#ifdef SHAPE_CHECK
+	if(a->shape[1] != b->shape[0])
+	{
+		LOG_E("MatMul input shapes doesn't match.\n");
+		return;
+	}
+	if(a->shape[0] != result->shape[0] || b->shape[1] != result->shape[1])
+	{
+		LOG_E("MatMul output shape doesn't match.\n");
+		return;
+	}
+#endif
+
+	// Every product is shifted by the guard bits, so that the sum of all products fits into the Q31 accumulator
+	guard_bits = aimath_q15_bits(inputs);
+	shift_sum = shift_a + shift_b - guard_bits;
+	shift_common = shift_sum;
+	if(c != 0 && shift_sum - shift_c > AIMATH_Q15_MAX_ALIGN_SHIFT){
+		shift_common = shift_c + AIMATH_Q15_MAX_ALIGN_SHIFT;
+	}
+
+	for(i = 0; i < rows; i++)
+	{
+		for(j = 0; j < cols; j++)
+		{
+			value = aimath_q15_linear_element(&a_data[i*inputs], b_data, c_data, j, inputs, cols, guard_bits, shift_sum, shift_c, shift_common);
+			if(aimath_q15_abs(value) > max_abs) max_abs = aimath_q15_abs(value);
+		}
+	}
+
+	shift_norm = max_abs == 0 ? shift_common : aimath_q15_normalize_shift(max_abs);
+	for(i = 0; i < rows; i++)
+	{
+		for(j = 0; j < cols; j++)
+		{
+			value = aimath_q15_linear_element(&a_data[i*inputs], b_data, c_data, j, inputs, cols, guard_bits, shift_sum, shift_c, shift_common);
+			result_data[i*cols + j] = aimath_q15_saturate(aimath_q15_shift_round(value, shift_norm));
+		}
+	}
+	((aimath_q15_params_t *) result->tensor_params)->shift = shift_common - shift_norm;
+	return;
+}
+
+void aimath_q15_default_mat_mul(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	aimath_q15_default_linear(a, b, 0, result);
+	return;
+}
+
+// Element wise addition or subtraction (sign = 1 or -1), two passes for the normalization of the result
+static void aimath_q15_add_sub(const aitensor_t *a, const aitensor_t *b, int16_t sign, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(a);
+	int64_t value;
+	uint64_t max_abs = 0;
+	int16_t shift_norm;
+
+	int16_t *a_data = (int16_t *) a->data;
+	int16_t *b_data = (int16_t *) b->data;
+	int16_t *result_data = (int16_t *) result->data;
+	int16_t shift_a = ((aimath_q15_params_t *) a->tensor_params)->shift;
+	int16_t shift_b = ((aimath_q15_params_t *) b->tensor_params)->shift;
+	int16_t shift_common = aimath_q15_common_shift(shift_a, shift_b);
+
+	for(i = 0; i < elements; i++)
+	{
+		value = aimath_q15_shift_round(a_data[i], shift_a - shift_common) + sign * aimath_q15_shift_round(b_data[i], shift_b - shift_common);
+		if(aimath_q15_abs(value) > max_abs) max_abs = aimath_q15_abs(value);
+	}
+
+	shift_norm = max_abs == 0 ? shift_common : aimath_q15_normalize_shift(max_abs);
+	for(i = 0; i < elements; i++)
+	{
+		value = aimath_q15_shift_round(a_data[i], shift_a - shift_common) + sign * aimath_q15_shift_round(b_data[i], shift_b - shift_common);
+		result_data[i] = aimath_q15_saturate(aimath_q15_shift_round(value, shift_norm));
+	}
+	((aimath_q15_params_t *) result->tensor_params)->shift = shift_common - shift_norm;
+	return;
+}
+
+void aimath_q15_default_tensor_add(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	aimath_q15_add_sub(a, b, 1, result);
+	return;
+}
+
+void aimath_q15_default_tensor_sub(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	aimath_q15_add_sub(a, b, -1, result);
+	return;
+}
+
+void aimath_q15_default_multiply(const aitensor_t *a, const aitensor_t *b, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(a);
+	int32_t value;
+	uint64_t max_abs = 0;
+	int16_t shift_norm;
+
+	int16_t *a_data = (int16_t *) a->data;
+	int16_t *b_data = (int16_t *) b->data;
+	int16_t *result_data = (int16_t *) result->data;
+	int16_t shift_product = ((aimath_q15_params_t *) a->tensor_params)->shift + ((aimath_q15_params_t *) b->tensor_params)->shift;
+
+	for(i = 0; i < elements; i++)
+	{
+		value = (int32_t) a_data[i] * (int32_t) b_data[i];
+		if(aimath_q15_abs(value) > max_abs) max_abs = aimath_q15_abs(value);
+	}
+
+	shift_norm = max_abs == 0 ? shift_product : aimath_q15_normalize_shift(max_abs);
+	for(i = 0; i < elements; i++)
+	{
+		value = (int32_t) a_data[i] * (int32_t) b_data[i];
+		result_data[i] = aimath_q15_saturate(aimath_q15_shift_round(value, shift_norm));
+	}
+	((aimath_q15_params_t *) result->tensor_params)->shift = shift_product - shift_norm;
+	return;
+}
+
+void aimath_q15_default_relu(const aitensor_t *x, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	int16_t *x_data = (int16_t *) x->data;
+	int16_t *result_data = (int16_t *) result->data;
+
+	for(i = 0; i < elements; i++)
+	{
+		result_data[i] = x_data[i] > 0 ? x_data[i] : 0;
+	}
+	((aimath_q15_params_t *) result->tensor_params)->shift = ((aimath_q15_params_t *) x->tensor_params)->shift;
+	return;
+}
+
+void aimath_q15_default_d_relu(const aitensor_t *x, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	int16_t *x_data = (int16_t *) x->data;
+	int16_t *result_data = (int16_t *) result->data;
+
+	for(i = 0; i < elements; i++)
+	{
+		result_data[i] = x_data[i] >= 0 ? 16384 : 0;
+	}
+	((aimath_q15_params_t *) result->tensor_params)->shift = 14;
+	return;
+}
+
+void aimath_q15_default_norm_squared(const aitensor_t *x, void *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	int16_t *x_data = (int16_t *) x->data;
+	aiscalar_q31_t *result_q31 = (aiscalar_q31_t *) result;
+	int16_t shift = ((aimath_q15_params_t *) x->tensor_params)->shift;
+	int16_t shift_norm;
+	int64_t sum = 0;
+
+	for(i = 0; i < elements; i++)
+	{
+		sum += (int32_t) x_data[i] * (int32_t) x_data[i];
+	}
+
+	shift_norm = sum == 0 ? 2 * shift : aimath_q15_bits(sum) - 31;
+	sum = aimath_q15_shift_round(sum, shift_norm);
+	result_q31->value = (int32_t) (sum > INT32_MAX ? INT32_MAX : sum);
+	result_q31->shift = 2 * shift - shift_norm;
+	return;
+}
+
+void aimath_q15_default_zero_tensor(aitensor_t *tensor)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(tensor);
+	int16_t *tensor_data = (int16_t *) tensor->data;
+
+	for(i = 0; i < elements; i++)
+	{
+		tensor_data[i] = 0;
+	}
+	if(tensor->tensor_params != 0){
+		((aimath_q15_params_t *) tensor->tensor_params)->shift = 0;
+	}
+	return;
+}
+
+void aimath_q15_default_requantize(const aitensor_t *x, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	int16_t *x_data = (int16_t *) x->data;
+	int16_t *result_data = (int16_t *) result->data;
+	int16_t shift = ((aimath_q15_params_t *) x->tensor_params)->shift - ((aimath_q15_params_t *) result->tensor_params)->shift;
+
+	for(i = 0; i < elements; i++)
+	{
+		result_data[i] = aimath_q15_saturate(aimath_q15_shift_round(x_data[i], shift));
+	}
+	return;
+}
+
+void aimath_q15_default_window(const aitensor_t *x, const aitensor_t *window, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t length = aimath_tensor_elements(window);
+	uint32_t elements = aimath_tensor_elements(result);
+	int16_t *x_data = (int16_t *) x->data;
+	int16_t *window_data = (int16_t *) window->data;
+	int16_t *result_data = (int16_t *) result->data;
+	int16_t shift = ((aimath_q15_params_t *) x->tensor_params)->shift + ((aimath_q15_params_t *) window->tensor_params)->shift;
+	int16_t shift_norm;
+	int32_t products[length];
+	uint64_t max_abs = 0;
+
+	for(i = 0; i < length; i++)
+	{
+		products[i] = (int32_t) x_data[i] * (int32_t) window_data[i];
+		if(aimath_q15_abs(products[i]) > max_abs) max_abs = aimath_q15_abs(products[i]);
+	}
+
+	shift_norm = max_abs == 0 ? shift : aimath_q15_normalize_shift(max_abs);
+	for(i = 0; i < length; i++)
+	{
+		result_data[i] = aimath_q15_saturate(aimath_q15_shift_round(products[i], shift_norm));
+	}
+	for(i = length; i < elements; i++)
+	{
+		result_data[i] = 0;
+	}
+	((aimath_q15_params_t *) result->tensor_params)->shift = shift - shift_norm;
+	return;
+}
+
+// Scales the values down until the butterflies (|a| + sqrt(2) * |b| per component) can not overflow
+static void aimath_q15_fft_headroom(int16_t *data, uint32_t length, int16_t *shift)
+{
+	uint32_t i;
+	int16_t scale = 0;
+	uint64_t max_abs = 0;
+
+	for(i = 0; i < length; i++)
+	{
+		if(aimath_q15_abs(data[i]) > max_abs) max_abs = aimath_q15_abs(data[i]);
+	}
+	while(max_abs > AIMATH_Q15_FFT_MAX_INPUT){
+		max_abs >>= 1;
+		scale++;
+	}
+	if(scale > 0){
+		for(i = 0; i < length; i++)
+		{
+			data[i] = (int16_t) aimath_q15_shift_round(data[i], scale);
+		}
+		*shift -= scale;
+	}
+	return;
+}
+
+void aimath_q15_default_rfft(aitensor_t *x, const aitensor_t *twiddles)
+{
+	uint32_t i, j, k, half, step;
+	uint32_t length = aimath_tensor_elements(x);
+	uint32_t complex_length = length / 2;
+	int16_t *data = (int16_t *) x->data;
+	int16_t *twiddle_data = (int16_t *) twiddles->data;
+	int16_t *shift = &(((aimath_q15_params_t *) x->tensor_params)->shift);
+	int16_t twiddle_shift = ((aimath_q15_params_t *) twiddles->tensor_params)->shift;
+	int16_t temp;
+	int32_t wr, wi, tr, ti, er, ei, or, oi;
+
+	// Bit reversal permutation of the complex values z_n = x_2n + i * x_2n+1
+	for(i = 1, j = 0; i < complex_length; i++)
+	{
+		k = complex_length >> 1;
+		while(j & k){
+			j ^= k;
+			k >>= 1;
+		}
+		j |= k;
+		if(i < j){
+			temp = data[2*i]; data[2*i] = data[2*j]; data[2*j] = temp;
+			temp = data[2*i+1]; data[2*i+1] = data[2*j+1]; data[2*j+1] = temp;
+		}
+	}
+
+	// Complex radix-2 FFT of length N/2 (W_N/2^j = W_N^2j)
+	for(half = 1; half < complex_length; half <<= 1)
+	{
+		aimath_q15_fft_headroom(data, length, shift);
+		step = complex_length / half;
+		for(i = 0; i < complex_length; i += 2 * half)
+		{
+			for(j = 0; j < half; j++)
+			{
+				wr = twiddle_data[2*j*step];
+				wi = -twiddle_data[2*j*step + 1];
+				k = i + j + half;
+				tr = (int32_t) aimath_q15_shift_round(wr * data[2*k] - wi * data[2*k+1], twiddle_shift);
+				ti = (int32_t) aimath_q15_shift_round(wr * data[2*k+1] + wi * data[2*k], twiddle_shift);
+				data[2*k] = (int16_t) (data[2*(i+j)] - tr);
+				data[2*k+1] = (int16_t) (data[2*(i+j)+1] - ti);
+				data[2*(i+j)] = (int16_t) (data[2*(i+j)] + tr);
+				data[2*(i+j)+1] = (int16_t) (data[2*(i+j)+1] + ti);
+			}
+		}
+	}
+
+	// Split step with doubled intermediate values (2 * E_k, 2 * O_k) to keep the precision
+	aimath_q15_fft_headroom(data, length, shift);
+	temp = data[0];
+	data[0] = (int16_t) (temp + data[1]);
+	data[1] = (int16_t) (temp - data[1]);
+	for(k = 1; k <= complex_length / 2; k++)
+	{
+		j = complex_length - k;
+		er = data[2*k] + data[2*j];
+		ei = data[2*k+1] - data[2*j+1];
+		or = data[2*k+1] + data[2*j+1];
+		oi = data[2*j] - data[2*k];
+		wr = twiddle_data[2*k];
+		wi = -twiddle_data[2*k+1];
+		tr = (int32_t) aimath_q15_shift_round(wr * or - wi * oi, twiddle_shift);
+		ti = (int32_t) aimath_q15_shift_round(wr * oi + wi * or, twiddle_shift);
+		data[2*k] = (int16_t) aimath_q15_shift_round(er + tr, 1);
+		data[2*k+1] = (int16_t) aimath_q15_shift_round(ei + ti, 1);
+		if(j != k){
+			data[2*j] = (int16_t) aimath_q15_shift_round(er - tr, 1);
+			data[2*j+1] = (int16_t) aimath_q15_shift_round(ti - ei, 1);
+		}
+	}
+	return;
+}
+
+void aimath_q15_default_power_spectrum(const aitensor_t *x, aitensor_t *result)
+{
+	uint32_t k;
+	uint32_t complex_length = aimath_tensor_elements(x) / 2;
+	int16_t *x_data = (int16_t *) x->data;
+	int32_t *result_data = (int32_t *) result->data;
+
+	result_data[0] = (int32_t) aimath_q15_shift_round((int64_t) x_data[0] * x_data[0], 1);
+	result_data[complex_length] = (int32_t) aimath_q15_shift_round((int64_t) x_data[1] * x_data[1], 1);
+	for(k = 1; k < complex_length; k++)
+	{
+		result_data[k] = (int32_t) aimath_q15_shift_round((int64_t) x_data[2*k] * x_data[2*k] + (int64_t) x_data[2*k+1] * x_data[2*k+1], 1);
+	}
+	((aimath_q31_params_t *) result->tensor_params)->shift = 2 * ((aimath_q15_params_t *) x->tensor_params)->shift - 1;
+	return;
+}
+
+void aimath_q15_default_mel_filterbank(const aitensor_t *power, const int16_t *mel_index, const aitensor_t *mel_weights, aitensor_t *result)
+{
+	uint32_t k;
+	int16_t j;
+	int16_t mel_count = aimath_tensor_elements(result);
+	int32_t *power_data = (int32_t *) power->data;
+	int16_t *weights_data = (int16_t *) mel_weights->data;
+	int32_t *result_data = (int32_t *) result->data;
+	int16_t weights_shift = ((aimath_q15_params_t *) mel_weights->tensor_params)->shift;
+	int16_t shift = ((aimath_q31_params_t *) power->tensor_params)->shift + weights_shift;
+	int16_t shift_norm;
+	int64_t one = (int64_t) 1 << weights_shift;
+	int64_t sums[mel_count];
+	int64_t value;
+	uint64_t max_abs = 0;
+
+	for(j = 0; j < mel_count; j++)
+	{
+		sums[j] = 0;
+	}
+	for(k = 0; k < aimath_tensor_elements(power); k++)
+	{
+		j = mel_index[k];
+		if(j < 0) continue;
+		if(j < mel_count){
+			sums[j] += weights_data[k] * (int64_t) power_data[k];
+		}
+		if(j > 0){
+			sums[j - 1] += (one - weights_data[k]) * (int64_t) power_data[k];
+		}
+	}
+
+	for(j = 0; j < mel_count; j++)
+	{
+		if(aimath_q15_abs(sums[j]) > max_abs) max_abs = aimath_q15_abs(sums[j]);
+	}
+	shift_norm = max_abs == 0 ? shift : aimath_q15_bits(max_abs) - 31;
+	for(j = 0; j < mel_count; j++)
+	{
+		value = aimath_q15_shift_round(sums[j], shift_norm);
+		result_data[j] = (int32_t) (value > INT32_MAX ? INT32_MAX : value);
+	}
+	((aimath_q31_params_t *) result->tensor_params)->shift = shift - shift_norm;
+	return;
+}
+
+void aimath_q15_default_log(const aitensor_t *x, aitensor_t *result)
+{
+	uint32_t i;
+	uint16_t b;
+	uint32_t elements = aimath_tensor_elements(x);
+	int32_t *x_data = (int32_t *) x->data;
+	int16_t *result_data = (int16_t *) result->data;
+	int16_t shift = ((aimath_q31_params_t *) x->tensor_params)->shift;
+	int16_t shift_norm;
+	int16_t leading_bit;
+	int64_t values[elements];
+	uint64_t mantissa;
+	int64_t log2_value;
+	uint64_t max_abs = 0;
+
+	for(i = 0; i < elements; i++)
+	{
+		// x = mantissa * 2^leading_bit with mantissa in [1, 2) (Q30)
+		leading_bit = x_data[i] > 0 ? aimath_q15_bits(x_data[i]) - 1 : 0;
+		mantissa = (uint64_t) (x_data[i] > 0 ? x_data[i] : 1) << (30 - leading_bit);
+
+		// Fractional bits of log2(mantissa) by repeated squaring (Q16)
+		log2_value = leading_bit - shift;
+		for(b = 0; b < 16; b++)
+		{
+			mantissa = (mantissa * mantissa) >> 30;
+			// Multiplication instead of a left shift, the value is negative for x < 1
+			log2_value *= 2;
+			if(mantissa >= ((uint64_t) 1 << 31)){
+				mantissa >>= 1;
+				log2_value += 1;
+			}
+		}
+
+		// ln(x) = log2(x) * ln(2) (Q46)
+		values[i] = log2_value * AIMATH_Q15_LN2_Q30;
+		if(aimath_q15_abs(values[i]) > max_abs) max_abs = aimath_q15_abs(values[i]);
+	}
+
+	shift_norm = max_abs == 0 ? 46 : aimath_q15_normalize_shift(max_abs);
+	for(i = 0; i < elements; i++)
+	{
+		result_data[i] = aimath_q15_saturate(aimath_q15_shift_round(values[i], shift_norm));
+	}
+	((aimath_q15_params_t *) result->tensor_params)->shift = 46 - shift_norm;
+	return;
+}
+
+// Shift right with stochastic rounding (shift > 0) or shift left (shift < 0)
+static int64_t aimath_q15_shift_stochastic(int64_t value, int16_t shift)
+{
+	uint64_t random;
+
+	if(shift <= 0 || shift > 62){
+		return aimath_q15_shift_round(value, shift);
+	}
+	random = ((uint64_t) aimath_q15_random() << 32) | aimath_q15_random();
+	// The floor of (value + uniform random fraction) has the exact expected value
+	return (value + (int64_t) (random & (((uint64_t) 1 << shift) - 1))) >> shift;
+}
+
+void aimath_q15_default_scaled_sub_stochastic(const void *scalar, const aitensor_t *a, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(a);
+	int64_t value;
+	uint64_t max_abs = 0;
+	int16_t shift_norm;
+
+	const aiscalar_q15_t *scalar_q15 = (const aiscalar_q15_t *) scalar;
+	int16_t *a_data = (int16_t *) a->data;
+	int16_t *result_data = (int16_t *) result->data;
+	int16_t shift_result = ((aimath_q15_params_t *) result->tensor_params)->shift;
+	int16_t shift_product = scalar_q15->shift + ((aimath_q15_params_t *) a->tensor_params)->shift;
+	int16_t shift_common = aimath_q15_common_shift(shift_result, shift_product);
+
+	// The exact differences are calculated with the common shift and only the final result is rounded
+	for(i = 0; i < elements; i++)
+	{
+		value = aimath_q15_shift_round(result_data[i], shift_result - shift_common)
+				- aimath_q15_shift_round((int32_t) scalar_q15->value * (int32_t) a_data[i], shift_product - shift_common);
+		if(aimath_q15_abs(value) > max_abs) max_abs = aimath_q15_abs(value);
+	}
+
+	shift_norm = max_abs == 0 ? shift_common : aimath_q15_normalize_shift(max_abs);
+	for(i = 0; i < elements; i++)
+	{
+		value = aimath_q15_shift_round(result_data[i], shift_result - shift_common)
+				- aimath_q15_shift_round((int32_t) scalar_q15->value * (int32_t) a_data[i], shift_product - shift_common);
+		result_data[i] = aimath_q15_saturate(aimath_q15_shift_stochastic(value, shift_norm));
+	}
+	((aimath_q15_params_t *) result->tensor_params)->shift = shift_common - shift_norm;
+	return;
+}
+
+void aimath_q15_default_set_random_seed(uint32_t seed)
+{
+	aimath_q15_random_state = seed != 0 ? seed : 2463534242u;
+	return;
+}
@@ -0,0 +1,267 @@
+/**
+ * \file basic/default/aimath/aimath_q15_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Math functions for \link aimath_q15.h Q15 \endlink data type, default implementation
+ *
+ * These functions can be used when no hardware specific implementation is available.
+ * They only use integer arithmetic (except the conversion functions from and to F32), so they are suitable for
+ * microcontrollers without a floating point unit.
+ *
+ * The shifts of the results are calculated automatically (block floating point): The exact integer results are
+ * calculated with 32 bit (Q31) accumulators or 64 bit intermediate values and afterwards shifted to use the full
+ * 16 bit range of the result. The shift of the result tensor is written to its tensor_params.
+ * The tensor_params of the results must not be shared with the inputs.
+ *
+ * Because every result gets its own shift, a model with Q15 results should be evaluated with one sample per
+ * aialgo_inference_model() call (the output tensor has only one shift for all samples).
+ */
+
+#ifndef AIMATH_Q15_DEFAULT
+#define AIMATH_Q15_DEFAULT
+
+#include <stdint.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "basic/base/aimath/aimath_q15.h"
+#include "basic/base/aimath/aimath_q31.h"
+#include "basic/base/aimath/aimath_f32.h"
+
+/** @brief Converts a \link aimath_f32.h F32 \endlink tensor to \link aimath_q15.h Q15 \endlink
+ *
+ * The shift is chosen so that the maximum absolute value uses the full 16 bit range.
+ *
+ * @param *x        F32 tensor to convert
+ * @param *result   Q15 tensor with the same shape as x
+ */
+void aimath_q15_default_quantize_f32(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Converts a \link aimath_q15.h Q15 \endlink tensor to \link aimath_f32.h F32 \endlink
+ *
+ * @param *x        Q15 tensor to convert
+ * @param *result   F32 tensor with the same shape as x
+ */
+void aimath_q15_default_dequantize_f32(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Performs a matrix multiplication of \link aimath_q15.h Q15 \endlink matrices a and b and adds a vector c to each row
+ *
+ * @f[
+ *  result = a \cdot b + \left( \begin{array}{c} 1 \\ \vdots \\ 1 \\ \end{array}\right) \cdot c
+ * @f]
+ *
+ * The products are accumulated in 32 bit integers. To prevent an overflow, every product is shifted right by
+ * \f$ \lceil log_2(K + 1) \rceil \f$ bits (with rounding) before the accumulation.
+ * The function uses a temporary array of N * M 64 bit values on the stack.
+ *
+ * @param *a        Q15 matrix a (2D tensor of shape [N x K])
+ * @param *b        Q15 matrix b (2D tensor of shape [K x M])
+ * @param *c        Q15 vector c (2D tensor of shape [1 x M]) or 0 for no bias
+ * @param *result   Resulting Q15 matrix (2D tensor of shape [N x M])
+ */
+void aimath_q15_default_linear(const aitensor_t *a, const aitensor_t *b, const aitensor_t *c, aitensor_t *result);
+
+/** @brief Performs a matrix multiplication of \link aimath_q15.h Q15 \endlink matrices a and b
+ *
+ * @f[
+ *  result = a \cdot b
+ * @f]
+ *
+ * See aimath_q15_default_linear() for details.
+ *
+ * @param *a        Q15 matrix a (2D tensor of shape [N x K])
+ * @param *b        Q15 matrix b (2D tensor of shape [K x M])
+ * @param *result   Resulting Q15 matrix (2D tensor of shape [N x M])
+ */
+void aimath_q15_default_mat_mul(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
+
+/** @brief Performs an element wise addition of \link aimath_q15.h Q15 \endlink tensors a and b
+ *
+ * @f[
+ *  result = a + b
+ * @f]
+ *
+ * The values are aligned to the finer shift of both tensors. The result may be the same tensor as a or b.
+ *
+ * @param *a        Q15 tensor a
+ * @param *b        Q15 tensor b
+ * @param *result   Resulting Q15 tensor
+ */
+void aimath_q15_default_tensor_add(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
+
+/** @brief Performs an element wise subtraction of \link aimath_q15.h Q15 \endlink tensors a and b
+ *
+ * @f[
+ *  result = a - b
+ * @f]
+ *
+ * The values are aligned to the finer shift of both tensors. The result may be the same tensor as a or b.
+ *
+ * @param *a        Q15 tensor a
+ * @param *b        Q15 tensor b
+ * @param *result   Resulting Q15 tensor
+ */
+void aimath_q15_default_tensor_sub(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
+
+/** @brief Performs an element wise multiplication of \link aimath_q15.h Q15 \endlink tensors a and b (Hadamard product)
+ *
+ * @f[
+ *  result = a \circ b
+ * @f]
+ *
+ * The result may be the same tensor as a or b.
+ *
+ * @param *a        Q15 tensor a
+ * @param *b        Q15 tensor b
+ * @param *result   Resulting Q15 tensor
+ */
+void aimath_q15_default_multiply(const aitensor_t *a, const aitensor_t *b, aitensor_t *result);
+
+/** @brief Calculates the rectifier (ReLU) value of each element in a \link aimath_q15.h Q15 \endlink tensor
+ *
+ * @f[
+ *  result_{i} = max(0, x_{i})
+ * @f]
+ *
+ * @param *x        Q15 tensor to calculate the ReLU from
+ * @param *result   Resulting Q15 tensor (with the shift of x)
+ */
+void aimath_q15_default_relu(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Calculates the rectifier (ReLU) derivative of each element in a \link aimath_q15.h Q15 \endlink tensor
+ *
+ * @f[
+ *  result_{i} = \begin{cases} 0 & \text{if } x_i < 0\\ 1 & \text{if } x_i \geq 0 \end{cases}
+ * @f]
+ *
+ * @param *x        Q15 tensor to calculate the ReLU derivative from
+ * @param *result   Resulting Q15 tensor (with shift 14)
+ */
+void aimath_q15_default_d_relu(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Calculates the squared sum of all elements in a \link aimath_q15.h Q15 \endlink tensor
+ *
+ * @f[
+ *  result = \sum_i x_{i}^2
+ * @f]
+ *
+ * @param *x        Q15 tensor x
+ * @param *result   Scalar result (type aiscalar_q31_t)
+ */
+void aimath_q15_default_norm_squared(const aitensor_t *x, void *result);
+
+/** @brief Fills a \link aimath_q15.h Q15 \endlink tensor with zeros
+ *
+ * @param *tensor   Q15 tensor to set to zero
+ */
+void aimath_q15_default_zero_tensor(aitensor_t *tensor);
+
+/** @brief Converts a \link aimath_q15.h Q15 \endlink tensor to the fixed shift of the result tensor
+  *
+  * In contrast to the other functions, the shift of the result is not calculated but read from the tensor_params of
+  * the result. Values outside of the range of the result are saturated.
+  * This is used to store values from different calculations in one tensor (for example feature frames).
+  *
+  * @param *x        Q15 tensor to convert
+  * @param *result   Q15 tensor with the same number of elements and a given shift
+  */
+void aimath_q15_default_requantize(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Multiplies a \link aimath_q15.h Q15 \endlink signal frame element wise with a window function
+  *
+  * See aimath_f32_default_window() for details. The result is normalized to the full 16 bit range.
+  *
+  * @param *x           Q15 signal frame with at least L elements
+  * @param *window      Q15 window function with L elements
+  * @param *result      Resulting Q15 tensor with at least L elements (zero padded)
+  */
+void aimath_q15_default_window(const aitensor_t *x, const aitensor_t *window, aitensor_t *result);
+
+/** @brief Calculates the discrete Fourier transform of a real \link aimath_q15.h Q15 \endlink signal (in place)
+  *
+  * See aimath_f32_default_rfft() for the algorithm, the twiddle table and the packed result format.
+  *
+  * Before every butterfly stage, the values are scaled down if the butterflies could overflow
+  * (block floating point), and the shift of x is adjusted accordingly. The intermediate products are calculated
+  * with 32 bit integers.
+  *
+  * @param *x           Q15 signal with N elements, replaced by the packed transform
+  * @param *twiddles    Q15 twiddle factor table with N elements
+  */
+void aimath_q15_default_rfft(aitensor_t *x, const aitensor_t *twiddles);
+
+/** @brief Calculates the power spectrum of a packed real \link aimath_q15.h Q15 \endlink FFT result
+  *
+  * See aimath_f32_default_power_spectrum() for details. The squared magnitudes are stored as
+  * \link aimath_q31.h Q31 \endlink values (with one bit less precision to prevent an overflow).
+  *
+  * @param *x           Packed Q15 transform with N elements
+  * @param *result      Resulting Q31 power spectrum with N/2 + 1 elements
+  */
+void aimath_q15_default_power_spectrum(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Applies a triangular (mel) filterbank to a \link aimath_q31.h Q31 \endlink power spectrum
+  *
+  * See aimath_f32_default_mel_filterbank() for details. The weighted sums are calculated with 64 bit integers
+  * and normalized to the full 32 bit range.
+  *
+  * @param *power           Q31 power spectrum with K elements
+  * @param *mel_index       Index of the rising filter edge for every bin (K elements, -1 for unused bins)
+  * @param *mel_weights     Q15 weights of the rising filter edges with K elements
+  * @param *result          Resulting Q31 filterbank energies with M elements
+  */
+void aimath_q15_default_mel_filterbank(const aitensor_t *power, const int16_t *mel_index, const aitensor_t *mel_weights, aitensor_t *result);
+
+/** @brief Calculates the element wise natural logarithm of a \link aimath_q31.h Q31 \endlink tensor
+  *
+  * The binary logarithm is calculated with integer arithmetic (position of the leading bit and 16 fractional bits
+  * by repeated squaring) and converted to the natural logarithm. Values that are zero or negative are clamped to the
+  * smallest positive value of the tensor format.
+  *
+  * @param *x           Q31 tensor
+  * @param *result      Resulting Q15 tensor with the same number of elements
+  */
+void aimath_q15_default_log(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Subtracts a scaled \link aimath_q15.h Q15 \endlink tensor from the result with stochastic rounding
+ *
+ * @f[
+ *  result = result - scalar \cdot a
+ * @f]
+ *
+ * The products are rounded stochastically to the shift of the result, i.e. they are rounded up with a probability
+ * equal to the truncated fraction. So the expected value of the update is exact and small updates (like in the
+ * parameter update of an optimizer with a small learning rate) do not vanish.
+ *
+ * @param *scalar   Q15 scalar (type aiscalar_q15_t)
+ * @param *a        Q15 tensor a
+ * @param *result   Q15 tensor that is updated in place
+ */
+void aimath_q15_default_scaled_sub_stochastic(const void *scalar, const aitensor_t *a, aitensor_t *result);
+
+/** @brief Sets the seed of the pseudo random numbers used for the stochastic rounding
+ *
+ * @param seed  The seed (must not be 0)
+ */
+void aimath_q15_default_set_random_seed(uint32_t seed);
+
+#endif // AIMATH_Q15_DEFAULT
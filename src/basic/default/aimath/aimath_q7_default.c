@@ -0,0 +1,163 @@
+/**
+ * \file basic/default/aimath/aimath_q7_default.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aimath_q7_default.h for documentation.
+ * \details
+ */
+
+#include "basic/default/aimath/aimath_q7_default.h"
+
+
+void aimath_q7_default_quantize_f32(const aitensor_t *x, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	float *x_data = (float *) x->data;
+	int8_t *result_data = (int8_t *) result->data;
+	aimath_q7_params_t *params = (aimath_q7_params_t *) result->tensor_params;
+	float min_value = 0.0f, max_value = 0.0f;
+	float inv_scale;
+	int32_t q, zero_point;
+
+	for(i = 0; i < elements; i++)
+	{
+		if(x_data[i] < min_value) min_value = x_data[i];
+		if(x_data[i] > max_value) max_value = x_data[i];
+	}
+
+	if(max_value == min_value){
+		// All values are zero
+		params->scale = 1.0f;
+		params->zero_point = 0;
+	} else {
+		params->scale = (max_value - min_value) / 255.0f;
+		zero_point = -128 - (int32_t) roundf(min_value / params->scale);
+		params->zero_point = (int8_t) (zero_point < -128 ? -128 : (zero_point > 127 ? 127 : zero_point));
+	}
+
+	inv_scale = 1.0f / params->scale;
+	for(i = 0; i < elements; i++)
+	{
+		q = (int32_t) roundf(x_data[i] * inv_scale) + params->zero_point;
+		result_data[i] = (int8_t) (q < -128 ? -128 : (q > 127 ? 127 : q));
+	}
+	return;
+}
+
+void aimath_q7_default_dequantize_f32(const aitensor_t *x, aitensor_t *result)
+{
+	uint32_t i;
+	uint32_t elements = aimath_tensor_elements(x);
+	int8_t *x_data = (int8_t *) x->data;
+	float *result_data = (float *) result->data;
+	aimath_q7_params_t *params = (aimath_q7_params_t *) x->tensor_params;
+
+	for(i = 0; i < elements; i++)
+	{
+		result_data[i] = params->scale * (float) (x_data[i] - params->zero_point);
+	}
+	return;
+}
+
+void aimath_q7_default_quantize_channels_transposed_f32(const aitensor_t *w, aitensor_t *result, float *scales)
+{
+	uint16_t j, k;
+	uint16_t rows = w->shape[0];
+	uint16_t cols = w->shape[1];
+	float *w_data = (float *) w->data;
+	int8_t *result_data = (int8_t *) result->data;
+	float max_abs, inv_scale;
+	int32_t q;
+
+#ifdef SHAPE_CHECK
+	if(result->shape[0] != cols || result->shape[1] != rows)
+	{
+		LOG_E("Quantize channels output shape doesn't match.\n");
+		return;
+	}
+#endif
+
+	for(j = 0; j < cols; j++)
+	{
+		max_abs = 0.0f;
+		for(k = 0; k < rows; k++)
+		{
+			if(fabsf(w_data[k*cols + j]) > max_abs) max_abs = fabsf(w_data[k*cols + j]);
+		}
+		scales[j] = max_abs > 0.0f ? max_abs / 127.0f : 1.0f;
+
+		inv_scale = 1.0f / scales[j];
+		for(k = 0; k < rows; k++)
+		{
+			q = (int32_t) roundf(w_data[k*cols + j] * inv_scale);
+			result_data[j*rows + k] = (int8_t) (q < -127 ? -127 : (q > 127 ? 127 : q));
+		}
+	}
+	return;
+}
+
+void aimath_q7_default_linear_dequantize_f32(const aitensor_t *a, const aitensor_t *b, const float *b_scales, const aitensor_t *c, aitensor_t *result)
+{
+	uint16_t i, j, k;
+	uint16_t inputs = a->shape[1];
+	uint16_t neurons = b->shape[0];
+	int32_t sum;
+	const int8_t *a_row, *b_row;
+
+	int8_t *a_data = (int8_t *) a->data;
+	int8_t *b_data = (int8_t *) b->data;
+	float *c_data = c != 0 ? (float *) c->data : 0;
+	float *result_data = (float *) result->data;
+	aimath_q7_params_t *a_params = (aimath_q7_params_t *) a->tensor_params;
+	int32_t a_zero_point = a_params->zero_point;
+
+#ifdef SHAPE_CHECK
+	if(a->shape[1] != b->shape[1])
+	{
+		LOG_E("MatMul input shapes doesn't match.\n");
+		return;
+	}
+	if(a->shape[0] != result->shape[0] || b->shape[0] != result->shape[1])
+	{
+		LOG_E("MatMul output shape doesn't match.\n");
+		return;
+	}
+#endif
+
+	for(i = 0; i < a->shape[0]; i++)
+	{
+		a_row = &a_data[i*inputs];
+		for(j = 0; j < neurons; j++)
+		{
+			b_row = &b_data[j*inputs];
+			sum = 0;
+			for(k = 0; k < inputs; k++)
+			{
+				sum += ((int32_t) a_row[k] - a_zero_point) * (int32_t) b_row[k];
+			}
+			result_data[i*neurons + j] = a_params->scale * b_scales[j] * (float) sum;
+			if(c != 0){
+				// Bias add
+				result_data[i*neurons + j] += c_data[j];
+			}
+		}
+	}
+	return;
+}
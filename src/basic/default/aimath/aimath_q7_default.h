@@ -0,0 +1,96 @@
+/**
+ * \file basic/default/aimath/aimath_q7_default.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Math functions for \link aimath_q7.h Q7 \endlink data type, default implementation
+ *
+ * These functions can be used when no hardware specific implementation is available.
+ * The integer arithmetic uses 32 bit accumulators, so no overflow can occur for up to 2^16 summands.
+ */
+
+#ifndef AIMATH_Q7_DEFAULT
+#define AIMATH_Q7_DEFAULT
+
+#include <stdint.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "basic/base/aimath/aimath_q7.h"
+#include "basic/base/aimath/aimath_f32.h"
+
+/** @brief Quantize a \link aimath_f32.h F32 \endlink tensor to \link aimath_q7.h Q7 \endlink with parameters from the value range
+ *
+ * The minimum and maximum of the tensor (extended to include 0) are mapped to the range [-128, 127]:
+ * @f[
+ *  scale = \frac{max - min}{255}, \quad zero\_point = -128 - round \left( \frac{min}{scale} \right)
+ * @f]
+ *
+ * The quantization parameters are written to the tensor_params of the result tensor.
+ *
+ * @param *x        F32 tensor to quantize
+ * @param *result   Q7 tensor with the same shape as x (tensor_params must point to an aimath_q7_params_t)
+ */
+void aimath_q7_default_quantize_f32(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Convert a \link aimath_q7.h Q7 \endlink tensor to \link aimath_f32.h F32 \endlink
+ *
+ * @f[
+ *  result_i = scale \cdot (x_i - zero\_point)
+ * @f]
+ *
+ * @param *x        Q7 tensor to convert
+ * @param *result   F32 tensor with the same shape as x
+ */
+void aimath_q7_default_dequantize_f32(const aitensor_t *x, aitensor_t *result);
+
+/** @brief Quantize the columns of a \link aimath_f32.h F32 \endlink weight matrix symmetrically and transpose it
+ *
+ * Every column j of the weight matrix w gets its own scale (per output channel quantization):
+ * @f[
+ *  scale_j = \frac{max_k |w_{kj}|}{127}, \quad result_{jk} = round \left( \frac{w_{kj}}{scale_j} \right)
+ * @f]
+ *
+ * The result is stored transposed, so that the dot products of the linear transformation read consecutive memory.
+ *
+ * @param *w        F32 matrix (2D tensor of shape [K x M])
+ * @param *result   Q7 matrix (2D tensor of shape [M x K]), the tensor_params are not used
+ * @param *scales   Array with M elements for the scales of the columns
+ */
+void aimath_q7_default_quantize_channels_transposed_f32(const aitensor_t *w, aitensor_t *result, float *scales);
+
+/** @brief Performs a linear transformation of a \link aimath_q7.h Q7 \endlink matrix a and a per channel quantized
+ * Q7 matrix b and returns a \link aimath_f32.h F32 \endlink result
+ *
+ * The products are accumulated in 32 bit integers and dequantized afterwards:
+ * @f[
+ *  result_{ij} = scale_a \cdot scale_{b,j} \cdot \sum_k (a_{ik} - zero\_point_a) \cdot b_{jk} + c_j
+ * @f]
+ *
+ * @param *a        Q7 matrix a (2D tensor of shape [N x K]) with aimath_q7_params_t
+ * @param *b        Transposed Q7 matrix b (2D tensor of shape [M x K]), symmetrically quantized per row
+ * @param *b_scales Scales of the rows of b (M elements)
+ * @param *c        F32 vector c (2D tensor of shape [1 x M]) or 0 for no bias
+ * @param *result   Resulting F32 matrix (2D tensor of shape [N x M])
+ */
+void aimath_q7_default_linear_dequantize_f32(const aitensor_t *a, const aitensor_t *b, const float *b_scales, const aitensor_t *c, aitensor_t *result);
+
+#endif // AIMATH_Q7_DEFAULT
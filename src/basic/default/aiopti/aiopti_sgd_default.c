@@ -56,3 +56,35 @@ aiopti_t *aiopti_sgd_f32_default(aiopti_sgd_f32_t *opti)
 
 	return return_opti;
 }
+
+aiopti_t *aiopti_sgd_q15_default(aiopti_sgd_q15_t *opti)
+{
+    aiopti_t* return_opti;
+
+    opti->base.base.dtype = aiq15;
+
+	// Call "constructor" of base "class"
+    return_opti = aiopti_sgd(&opti->base);
+
+    return_opti->learning_rate = &(opti->learning_rate);
+    opti->base.momentum = &opti->momentum;
+
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+    if (opti->momentum.value != 0) {
+        LOG_E("SGD with momentum is not supported for Q15. The momentum is ignored.\n");
+    }
+#endif
+
+    return_opti->update_params = aiopti_sgd_update_params_scaled_sub;
+    return_opti->sizeof_optimem = aiopti_sgd_sizeof_optimem_without_momentum;
+    return_opti->init_optimem = aiopti_sgd_init_optimem_without_momentum;
+
+	// Set q15 math functions of sgd optimizer
+    opti->base.zero_tensor = aimath_q15_default_zero_tensor;
+	opti->base.tensor_add = aimath_q15_default_tensor_add;
+	opti->base.tensor_sub = aimath_q15_default_tensor_sub;
+	opti->base.scalar_mul = 0;
+	opti->base.scaled_sub = aimath_q15_default_scaled_sub_stochastic;
+
+	return return_opti;
+}
@@ -32,8 +32,10 @@
 #include "basic/base/aiopti/aiopti_sgd.h"
 
 #include "basic/default/aimath/aimath_f32_default.h"
+#include "basic/default/aimath/aimath_q15_default.h"
 
 typedef struct aiopti_sgd_f32 	aiopti_sgd_f32_t; /**< New data type name for code reduction. */
+typedef struct aiopti_sgd_q15 	aiopti_sgd_q15_t; /**< New data type name for code reduction. */
 
 /** @brief Data-type specific \link aiopti_sgd.h SGD optimizer \endlink struct for \link aimath_f32.h F32 \endlink
  *
@@ -72,4 +74,43 @@ struct aiopti_sgd_f32 {
  */
 aiopti_t *aiopti_sgd_f32_default(aiopti_sgd_f32_t *opti);
 
+/** @brief Data-type specific \link aiopti_sgd.h SGD optimizer \endlink struct for \link aimath_q15.h Q15 \endlink
+ *
+ * Adds data fields for the learning rate and the momentum in \link aimath_q15.h Q15 \endlink to the base implementation.
+ */
+struct aiopti_sgd_q15 {
+	aiopti_sgd_t base; /**< Inherited field members from general aiopti_sgd struct. */
+
+	aiscalar_q15_t learning_rate; /**< Storage for aiopti.learning_rate scalar in Q15 */
+
+	aiscalar_q15_t momentum; /**< Storage for aiopti_sgd.momentum scalar in Q15 (must be zero, a momentum is not supported) */
+};
+
+/** @brief Initializes a \link aiopti_sgd.h SGD optimizer \endlink with the \link aimath_q15.h Q15 \endlink default implementation
+ *
+ * The parameters are updated with aiopti_sgd_update_params_scaled_sub() using stochastic rounding
+ * (aimath_q15_default_scaled_sub_stochastic()), so the training works with integer arithmetic only.
+ * A momentum is not supported.
+ *
+ * Example: Create the optimizer structure (learning rate 0.03 = 983 * 2^-15):\n
+ * \code{.c}
+ * aiopti_sgd_q15_t sgd_optimizer = {
+ *     .learning_rate = {.value = 983, .shift = 15},
+ *
+ *     .momentum = {.value = 0, .shift = 0}
+ * };
+ * \endcode
+ *
+ * Example: Initialize the optimizer:\n
+ * \code{.c}
+ * aiopti_t *optimizer;
+ *
+ * optimizer = aiopti_sgd_q15_default(&sgd_optimizer);
+ * \endcode
+ *
+ * @param *opti    The optimizer structure to initialize.
+ * @return         The (successfully) initialized optimizer structure.
+ */
+aiopti_t *aiopti_sgd_q15_default(aiopti_sgd_q15_t *opti);
+
 #endif // AIOPTI_SGD_DEFAULT
@@ -0,0 +1,480 @@
+/**
+ * \file basic/posix/aialgo/aialgo_data_parallel.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aialgo_data_parallel.h for documentation.
+ * \details
+ */
+
+#include "basic/posix/aialgo/aialgo_data_parallel.h"
+
+#ifdef AIFES_WITH_POSIX
+
+#include <math.h>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+static uint32_t aialgo_data_parallel_align(uint32_t size)
+{
+	return (size + 63) & ~((uint32_t) 63);
+}
+
+// Copy the gradients of all layers to a flat array (to_model = FALSE) or back (to_model = TRUE)
+static void aialgo_data_parallel_copy_gradients(aimodel_t *model, float *flat, uint8_t to_model)
+{
+	uint16_t i, j;
+	uint32_t size;
+	ailayer_t *layer_ptr = model->input_layer;
+
+	for(i = 0; i < model->layer_count; i++)
+	{
+		for(j = 0; j < layer_ptr->trainable_params_count; j++){
+			size = aimath_tensor_elements(layer_ptr->gradients[j]);
+			if(to_model){
+				memcpy(layer_ptr->gradients[j]->data, flat, size * sizeof(float));
+			} else {
+				memcpy(flat, layer_ptr->gradients[j]->data, size * sizeof(float));
+			}
+			flat += size;
+		}
+		layer_ptr = layer_ptr->output_layer;
+	}
+	return;
+}
+
+// Returns the k-th largest value of x (x is reordered)
+static float aialgo_data_parallel_select(float *x, uint32_t count, uint32_t k)
+{
+	int32_t left = 0, right = count - 1, target = count - k;
+	int32_t i, j;
+	float pivot, temp;
+
+	// Quickselect with Hoare partition (robust against many equal values)
+	while(left < right)
+	{
+		pivot = x[target];
+		i = left;
+		j = right;
+		do {
+			while(x[i] < pivot) i++;
+			while(pivot < x[j]) j--;
+			if(i <= j){
+				temp = x[i];
+				x[i] = x[j];
+				x[j] = temp;
+				i++;
+				j--;
+			}
+		} while(i <= j);
+		if(j < target) left = i;
+		if(target < i) right = j;
+	}
+	return x[target];
+}
+
+// Compress x (with the residual added) into the slot and keep the compression error in the residual
+static void aialgo_data_parallel_compress(aialgo_data_parallel_t *data_parallel, float *x, float *residual, void *slot)
+{
+	uint32_t i, c, start, end, n;
+	uint32_t count = data_parallel->gradient_count;
+	float max_abs, scale, inv_scale, threshold;
+	int32_t q;
+
+	for(i = 0; i < count; i++)
+	{
+		x[i] += residual[i];
+	}
+
+	if(data_parallel->compression == AIALGO_DATA_PARALLEL_INT8){
+		float *scales = (float *) slot;
+		int8_t *values = (int8_t *) (scales + data_parallel->workers);
+
+		for(c = 0; c < data_parallel->workers; c++)
+		{
+			start = c * data_parallel->chunk_size;
+			end = start + data_parallel->chunk_size > count ? count : start + data_parallel->chunk_size;
+
+			max_abs = 0.0f;
+			for(i = start; i < end; i++)
+			{
+				if(fabsf(x[i]) > max_abs) max_abs = fabsf(x[i]);
+			}
+			scale = max_abs > 0.0f ? max_abs / 127.0f : 1.0f;
+			inv_scale = 1.0f / scale;
+			scales[c] = scale;
+			for(i = start; i < end; i++)
+			{
+				q = (int32_t) roundf(x[i] * inv_scale);
+				values[i] = (int8_t) (q < -127 ? -127 : (q > 127 ? 127 : q));
+				residual[i] = x[i] - scale * (float) values[i];
+			}
+		}
+	} else {
+		uint32_t k = data_parallel->topk_count;
+		uint32_t *indices = (uint32_t *) slot;
+		float *values = (float *) (indices + k);
+		float *abs_values = x + count;
+		uint32_t greater = 0;
+
+		for(i = 0; i < count; i++)
+		{
+			abs_values[i] = fabsf(x[i]);
+		}
+		threshold = aialgo_data_parallel_select(abs_values, count, k);
+		for(i = 0; i < count; i++)
+		{
+			if(fabsf(x[i]) > threshold) greater++;
+		}
+
+		// The entries are sorted by the index for the reduction
+		n = 0;
+		for(i = 0; i < count && n < k; i++)
+		{
+			if(fabsf(x[i]) > threshold || (fabsf(x[i]) == threshold && greater < k)){
+				if(fabsf(x[i]) == threshold) greater++;
+				indices[n] = i;
+				values[n] = x[i];
+				n++;
+				residual[i] = 0.0f;
+			} else {
+				residual[i] = x[i];
+			}
+		}
+		for(; i < count; i++)
+		{
+			residual[i] = x[i];
+		}
+	}
+	return;
+}
+
+// Sum the chunk of this process over the slots of all processes
+static void aialgo_data_parallel_reduce_chunk(aialgo_data_parallel_t *data_parallel)
+{
+	uint32_t i, w, n;
+	uint32_t count = data_parallel->gradient_count;
+	uint32_t start = data_parallel->rank * data_parallel->chunk_size;
+	uint32_t end = start + data_parallel->chunk_size > count ? count : start + data_parallel->chunk_size;
+	float *result = data_parallel->result;
+	void *slot;
+
+	for(i = start; i < end; i++)
+	{
+		result[i] = 0.0f;
+	}
+	for(w = 0; w < data_parallel->workers; w++)
+	{
+		slot = data_parallel->slots + w * data_parallel->slot_size;
+		if(data_parallel->compression == AIALGO_DATA_PARALLEL_NONE){
+			float *values = (float *) slot;
+			for(i = start; i < end; i++)
+			{
+				result[i] += values[i];
+			}
+		} else if(data_parallel->compression == AIALGO_DATA_PARALLEL_INT8){
+			float scale = ((float *) slot)[data_parallel->rank];
+			int8_t *values = (int8_t *) ((float *) slot + data_parallel->workers);
+			for(i = start; i < end; i++)
+			{
+				result[i] += scale * (float) values[i];
+			}
+		} else {
+			uint32_t k = data_parallel->topk_count;
+			uint32_t *indices = (uint32_t *) slot;
+			float *values = (float *) (indices + k);
+			uint32_t low = 0, high = k;
+
+			// First entry of the chunk (binary search)
+			while(low < high)
+			{
+				n = low + (high - low) / 2;
+				if(indices[n] < start) low = n + 1;
+				else high = n;
+			}
+			for(n = low; n < k && indices[n] < end; n++)
+			{
+				result[indices[n]] += values[n];
+			}
+		}
+	}
+	return;
+}
+
+uint8_t aialgo_init_data_parallel(aialgo_data_parallel_t *data_parallel, aimodel_t *model)
+{
+	uint16_t i, j;
+	uint32_t count = 0, offset;
+	ailayer_t *layer_ptr = model->input_layer;
+	pthread_barrierattr_t attributes;
+
+	for(i = 0; i < model->layer_count; i++)
+	{
+		for(j = 0; j < layer_ptr->trainable_params_count; j++){
+			if(layer_ptr->gradients[j]->dtype != aif32){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+				LOG_E("Data parallel training only supports F32 gradients.\n");
+#endif
+				return 1;
+			}
+			count += aimath_tensor_elements(layer_ptr->gradients[j]);
+		}
+		layer_ptr = layer_ptr->output_layer;
+	}
+	if(data_parallel->workers == 0 || data_parallel->workers > AIALGO_DATA_PARALLEL_MAX_WORKERS || count == 0){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("Invalid data parallel configuration.\n");
+#endif
+		return 1;
+	}
+
+	data_parallel->rank = 0;
+	data_parallel->gradient_count = count;
+	data_parallel->chunk_size = (count + data_parallel->workers - 1) / data_parallel->workers;
+	data_parallel->topk_count = (uint32_t) (data_parallel->topk_ratio * (float) count);
+	if(data_parallel->topk_count == 0) data_parallel->topk_count = 1;
+	if(data_parallel->topk_count > count) data_parallel->topk_count = count;
+
+	switch(data_parallel->compression){
+	case AIALGO_DATA_PARALLEL_INT8:
+		data_parallel->slot_size = aialgo_data_parallel_align(data_parallel->workers * sizeof(float) + count);
+		break;
+	case AIALGO_DATA_PARALLEL_TOPK:
+		data_parallel->slot_size = aialgo_data_parallel_align(data_parallel->topk_count * (sizeof(uint32_t) + sizeof(float)));
+		break;
+	default:
+		data_parallel->compression = AIALGO_DATA_PARALLEL_NONE;
+		data_parallel->slot_size = aialgo_data_parallel_align(count * sizeof(float));
+		break;
+	}
+
+	// Header, result, slots, residuals and scratch (values and absolute values for the top-k selection)
+	data_parallel->shared_memory_size = aialgo_data_parallel_align(sizeof(aialgo_data_parallel_shared_t))
+										+ aialgo_data_parallel_align(count * sizeof(float))
+										+ data_parallel->workers * data_parallel->slot_size;
+	if(data_parallel->compression != AIALGO_DATA_PARALLEL_NONE){
+		data_parallel->shared_memory_size += 3 * data_parallel->workers * aialgo_data_parallel_align(count * sizeof(float));
+	}
+
+	data_parallel->shared_memory = mmap(0, data_parallel->shared_memory_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if(data_parallel->shared_memory == MAP_FAILED){
+		data_parallel->shared_memory = 0;
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("Could not create the shared memory for the data parallel training.\n");
+#endif
+		return 1;
+	}
+
+	offset = 0;
+	data_parallel->shared = data_parallel->shared_memory;
+	offset += aialgo_data_parallel_align(sizeof(aialgo_data_parallel_shared_t));
+	data_parallel->result = data_parallel->shared_memory + offset;
+	offset += aialgo_data_parallel_align(count * sizeof(float));
+	data_parallel->slots = data_parallel->shared_memory + offset;
+	offset += data_parallel->workers * data_parallel->slot_size;
+	if(data_parallel->compression != AIALGO_DATA_PARALLEL_NONE){
+		data_parallel->residuals = data_parallel->shared_memory + offset;
+		offset += data_parallel->workers * aialgo_data_parallel_align(count * sizeof(float));
+		data_parallel->scratch = data_parallel->shared_memory + offset;
+	} else {
+		data_parallel->residuals = 0;
+		data_parallel->scratch = 0;
+	}
+
+	pthread_barrierattr_init(&attributes);
+	pthread_barrierattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+	pthread_barrier_init(&data_parallel->shared->barrier, &attributes, data_parallel->workers);
+	pthread_barrierattr_destroy(&attributes);
+	return 0;
+}
+
+uint8_t aialgo_fork_data_parallel(aialgo_data_parallel_t *data_parallel)
+{
+	uint16_t r, i;
+	pid_t pid;
+
+	// Flush the stdio buffers, otherwise the forked processes print them again
+	fflush(stdout);
+	fflush(stderr);
+
+	data_parallel->rank = 0;
+	for(r = 1; r < data_parallel->workers; r++)
+	{
+		pid = fork();
+		if(pid == 0){
+			data_parallel->rank = r;
+			return 0;
+		}
+		if(pid < 0){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+			LOG_E("Could not fork the data parallel processes.\n");
+#endif
+			// The started processes would wait at the barrier forever
+			for(i = 1; i < r; i++)
+			{
+				kill(data_parallel->pids[i], SIGKILL);
+				waitpid(data_parallel->pids[i], 0, 0);
+			}
+			return 1;
+		}
+		data_parallel->pids[r] = pid;
+	}
+	return 0;
+}
+
+void aialgo_reduce_gradients_data_parallel(aimodel_t *model, aialgo_data_parallel_t *data_parallel)
+{
+	uint32_t count = data_parallel->gradient_count;
+	uint32_t stride = aialgo_data_parallel_align(count * sizeof(float)) / sizeof(float);
+	void *slot = data_parallel->slots + data_parallel->rank * data_parallel->slot_size;
+	float *scratch;
+
+	if(data_parallel->compression == AIALGO_DATA_PARALLEL_NONE){
+		aialgo_data_parallel_copy_gradients(model, (float *) slot, FALSE);
+	} else {
+		scratch = data_parallel->scratch + 2 * data_parallel->rank * stride;
+		aialgo_data_parallel_copy_gradients(model, scratch, FALSE);
+		aialgo_data_parallel_compress(data_parallel, scratch, data_parallel->residuals + data_parallel->rank * stride, slot);
+	}
+
+	// Reduce-scatter
+	pthread_barrier_wait(&data_parallel->shared->barrier);
+	aialgo_data_parallel_reduce_chunk(data_parallel);
+
+	// All-gather
+	pthread_barrier_wait(&data_parallel->shared->barrier);
+	aialgo_data_parallel_copy_gradients(model, data_parallel->result, TRUE);
+	return;
+}
+
+void aialgo_train_model_data_parallel(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size, aialgo_data_parallel_t *data_parallel, float *loss)
+{
+	uint32_t i, batch, sample;
+	uint32_t local_batch_size = batch_size / data_parallel->workers;
+	uint32_t batch_count = (uint32_t) (input_tensor->shape[0] / batch_size);
+	float sample_loss, loss_sum = 0.0f;
+
+	if(local_batch_size == 0 || local_batch_size * data_parallel->workers != batch_size){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("The batch size has to be a multiple of the number of processes.\n");
+#endif
+		if(loss != 0) *loss = NAN;
+		return;
+	}
+
+	aitensor_t input_batch;
+	uint16_t input_batch_shape[input_tensor->dim];
+	input_batch.dtype = input_tensor->dtype;
+	input_batch.dim = input_tensor->dim;
+	input_batch.shape = input_batch_shape;
+	input_batch.tensor_params = input_tensor->tensor_params;
+	aitensor_t target_batch;
+	uint16_t target_batch_shape[target_tensor->dim];
+	target_batch.dtype = target_tensor->dtype;
+	target_batch.dim = target_tensor->dim;
+	target_batch.shape = target_batch_shape;
+	target_batch.tensor_params = target_tensor->tensor_params;
+
+	uint32_t input_multiplier = 1;
+	for(i = input_tensor->dim - 1; i > 0; i--)
+	{
+		input_multiplier *= input_tensor->shape[i];
+		input_batch_shape[i] = input_tensor->shape[i];
+	}
+	input_multiplier *= input_tensor->dtype->size;
+	input_batch_shape[0] = 1;
+	uint32_t target_multiplier = 1;
+	for(i = target_tensor->dim - 1; i > 0; i--)
+	{
+		target_multiplier *= target_tensor->shape[i];
+		target_batch_shape[i] = target_tensor->shape[i];
+	}
+	target_multiplier *= target_tensor->dtype->size;
+	target_batch_shape[0] = 1;
+
+	for(batch = 0; batch < batch_count; batch++)
+	{
+		aialgo_zero_gradients_model(model, optimizer);
+		for(i = 0; i < local_batch_size; i++)
+		{
+			// Consecutive part of the batch for every process
+			sample = batch * batch_size + data_parallel->rank * local_batch_size + i;
+			input_batch.data = input_tensor->data + sample * input_multiplier;
+			target_batch.data = target_tensor->data + sample * target_multiplier;
+
+			aialgo_forward_model(model, &input_batch);
+			if(loss != 0){
+				aialgo_backward_model_with_loss(model, &target_batch, &sample_loss);
+				loss_sum += sample_loss;
+			} else {
+				aialgo_backward_model(model, &target_batch);
+			}
+		}
+		aialgo_reduce_gradients_data_parallel(model, data_parallel);
+		aialgo_update_params_model(model, optimizer);
+	}
+
+	if(loss != 0){
+		data_parallel->shared->losses[data_parallel->rank] = loss_sum;
+		pthread_barrier_wait(&data_parallel->shared->barrier);
+		*loss = 0.0f;
+		for(i = 0; i < data_parallel->workers; i++)
+		{
+			*loss += data_parallel->shared->losses[i];
+		}
+		if(batch_count > 0){
+			*loss /= (float) (batch_count * batch_size);
+		}
+		pthread_barrier_wait(&data_parallel->shared->barrier);
+	}
+	return;
+}
+
+uint8_t aialgo_join_data_parallel(aialgo_data_parallel_t *data_parallel)
+{
+	uint16_t r;
+	int status;
+	uint8_t error = 0;
+
+	if(data_parallel->rank != 0){
+		fflush(stdout);
+		_exit(0);
+	}
+	for(r = 1; r < data_parallel->workers; r++)
+	{
+		if(waitpid(data_parallel->pids[r], &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0){
+			error = 1;
+		}
+	}
+	return error;
+}
+
+void aialgo_close_data_parallel(aialgo_data_parallel_t *data_parallel)
+{
+	if(data_parallel->shared_memory != 0){
+		pthread_barrier_destroy(&data_parallel->shared->barrier);
+		munmap(data_parallel->shared_memory, data_parallel->shared_memory_size);
+		data_parallel->shared_memory = 0;
+	}
+	return;
+}
+
+#endif // AIFES_WITH_POSIX
@@ -0,0 +1,203 @@
+/**
+ * \file basic/posix/aialgo/aialgo_data_parallel.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Multi-process data parallel training with shared memory gradient reduction on POSIX hosts
+ * \details The model is trained by multiple processes on one machine. Every batch is split into equal parts
+ * (data shards) and every process calculates the gradients of its part. The gradients are reduced in shared
+ * memory before the parameter update, so every process applies the same update and the models stay identical.
+ * The result is the same as aialgo_train_model() with the full batch size (except for the rounding of the sums).
+ *
+ * The reduction works like the reduce-scatter / all-gather pattern of a ring all-reduce, but without the ring hops,
+ * because every process can read the memory of the other processes directly:
+ * 1. Every process writes its gradients to its slot in the shared memory.
+ * 2. Process r sums the r-th chunk of all slots into the shared result (reduce-scatter).
+ * 3. Every process copies the complete result to its gradients (all-gather).
+ *
+ * So every process reads and writes about as much data as its own gradients, independent of the number of processes.
+ *
+ * The gradients can be compressed before the reduction to reduce the memory traffic:
+ * * AIALGO_DATA_PARALLEL_INT8: Symmetric 8 bit quantization with one scale per chunk (4 times smaller).
+ * * AIALGO_DATA_PARALLEL_TOPK: Only the aialgo_data_parallel.topk_ratio largest gradients (by absolute value) are sent
+ *   as index / value pairs.
+ *
+ * The compression error is kept in a residual and added to the gradients of the next step (error feedback), so no
+ * gradient information is lost over time.
+ *
+ * The processes are created with fork() after the model is initialized for training, so all processes start with
+ * the same parameters and optimizer state. The dataset is shared copy-on-write. After the training only the first
+ * process (rank 0) continues. In contrast to threads, the processes don't share the heap, the stdio buffers or
+ * other global state.
+ *
+ * Only F32 gradients are supported. Only available with AIFES_WITH_POSIX (requires fork() and process shared
+ * pthread barriers).
+ *
+ * Example:
+ * \code{.c}
+ * // Build the model, schedule the training memory and call aialgo_init_model_for_training() before
+ * aialgo_data_parallel_t data_parallel = {
+ *     .workers = 4,
+ *     .compression = AIALGO_DATA_PARALLEL_NONE
+ * };
+ *
+ * aialgo_init_data_parallel(&data_parallel, &model);
+ * aialgo_fork_data_parallel(&data_parallel);
+ *
+ * for(i = 0; i < epochs; i++)
+ * {
+ *     aialgo_train_model_data_parallel(&model, &input_tensor, &target_tensor, optimizer, batch_size, &data_parallel, &loss);
+ *     if(data_parallel.rank == 0) printf("Epoch %d: loss %f\n", i, loss);
+ * }
+ *
+ * aialgo_join_data_parallel(&data_parallel); // Only rank 0 returns
+ * aialgo_close_data_parallel(&data_parallel);
+ * \endcode
+ */
+
+#ifndef AIALGO_DATA_PARALLEL
+#define AIALGO_DATA_PARALLEL
+
+#include "../../../aifes.h"
+
+#ifdef AIFES_WITH_POSIX
+
+#include <pthread.h>
+#include <sys/types.h>
+
+#define AIALGO_DATA_PARALLEL_MAX_WORKERS    64 /**< Maximum number of processes */
+
+#define AIALGO_DATA_PARALLEL_NONE   0 /**< Gradient compression: Reduce the F32 gradients */
+#define AIALGO_DATA_PARALLEL_INT8   1 /**< Gradient compression: 8 bit quantization with one scale per chunk */
+#define AIALGO_DATA_PARALLEL_TOPK   2 /**< Gradient compression: Only the largest gradients as index / value pairs */
+
+typedef struct aialgo_data_parallel  aialgo_data_parallel_t;
+typedef struct aialgo_data_parallel_shared  aialgo_data_parallel_shared_t;
+
+/** @brief Header of the shared memory of the processes
+ *
+ */
+struct aialgo_data_parallel_shared {
+	pthread_barrier_t barrier; /**< Process shared barrier of all processes. */
+	float losses[AIALGO_DATA_PARALLEL_MAX_WORKERS]; /**< Loss sums of the processes. */
+};
+
+/** @brief Configuration and state of the data parallel training
+ *
+ */
+struct aialgo_data_parallel {
+	/** @name Configuration
+	 * @brief Required configuration parameters
+	 */
+	///@{
+	uint16_t workers; /**< Number of processes (including the calling process). */
+	uint8_t compression; /**< AIALGO_DATA_PARALLEL_NONE, AIALGO_DATA_PARALLEL_INT8 or AIALGO_DATA_PARALLEL_TOPK. */
+	float topk_ratio; /**< Ratio of the sent gradients for AIALGO_DATA_PARALLEL_TOPK (for example 0.01f). */
+	///@}
+
+	uint16_t rank; /**< Number of this process (0 for the calling process). Set by aialgo_fork_data_parallel(). */
+
+	/** @name Variables for internal use only
+	 */
+	///@{
+	uint32_t gradient_count; /**< Number of gradient values of the model. */
+	uint32_t chunk_size; /**< Number of gradient values reduced by one process. */
+	uint32_t topk_count; /**< Number of sent gradients per process for AIALGO_DATA_PARALLEL_TOPK. */
+	uint32_t slot_size; /**< Size of the slot of one process in bytes. */
+
+	void *shared_memory; /**< Shared memory mapping. */
+	uint32_t shared_memory_size; /**< Size of the shared memory mapping. */
+	aialgo_data_parallel_shared_t *shared; /**< Header of the shared memory. */
+	float *result; /**< Reduced gradients (shared). */
+	void *slots; /**< Compressed gradients of the processes (shared). */
+	float *residuals; /**< Compression errors of the processes (every process only uses its own part). */
+	float *scratch; /**< Working memory of the processes for the compression (every process only uses its own part). */
+
+	pid_t pids[AIALGO_DATA_PARALLEL_MAX_WORKERS]; /**< Process IDs of the forked processes. */
+	///@}
+};
+
+/** @brief Create the shared memory for the data parallel training
+ *
+ * The training memory of the model has to be scheduled before (see aialgo_schedule_training_memory()).
+ *
+ * @param *data_parallel    The data parallel configuration
+ * @param *model            The model to train
+ * @return                  0 if successful
+ */
+uint8_t aialgo_init_data_parallel(aialgo_data_parallel_t *data_parallel, aimodel_t *model);
+
+/** @brief Start the processes
+ *
+ * Creates aialgo_data_parallel.workers - 1 processes with fork(). Every process returns from this function with
+ * its own aialgo_data_parallel.rank. Initialize the model for the training before.
+ *
+ * @param *data_parallel    The initialized data parallel configuration
+ * @return                  0 if successful
+ */
+uint8_t aialgo_fork_data_parallel(aialgo_data_parallel_t *data_parallel);
+
+/** @brief Perform one data parallel training epoch
+ *
+ * Has to be called by all processes with the same arguments. Every batch of batch_size samples is split into
+ * aialgo_data_parallel.workers parts (batch_size has to be a multiple of the number of processes). Every process
+ * calculates the gradients of its part, then the gradients are reduced with aialgo_reduce_gradients_data_parallel()
+ * and the parameters are updated.
+ *
+ * @param *model            The model (same state in all processes)
+ * @param *input_tensor     The training inputs
+ * @param *target_tensor    The training targets
+ * @param *optimizer        The optimizer
+ * @param batch_size        The batch size of all processes together
+ * @param *data_parallel    The data parallel configuration after aialgo_fork_data_parallel()
+ * @param *loss             The mean loss of all trained samples (all processes) is written here (optional, may be 0).
+ *                          NaN if the batch size is not a multiple of the number of processes (nothing is trained).
+ */
+void aialgo_train_model_data_parallel(aimodel_t *model, aitensor_t *input_tensor, aitensor_t *target_tensor, aiopti_t *optimizer, uint32_t batch_size, aialgo_data_parallel_t *data_parallel, float *loss);
+
+/** @brief Sum the gradients of the model over all processes
+ *
+ * Has to be called by all processes. Afterwards the gradients of the model are the sum of the gradients of
+ * all processes (with the compression error if a compression is used). Can be used for custom training loops.
+ *
+ * @param *model            The model
+ * @param *data_parallel    The data parallel configuration after aialgo_fork_data_parallel()
+ */
+void aialgo_reduce_gradients_data_parallel(aimodel_t *model, aialgo_data_parallel_t *data_parallel);
+
+/** @brief End the forked processes
+ *
+ * The forked processes exit in this function, the calling process (rank 0) waits for them and continues with
+ * the trained model.
+ *
+ * @param *data_parallel    The data parallel configuration
+ * @return                  0 if all processes exited successfully
+ */
+uint8_t aialgo_join_data_parallel(aialgo_data_parallel_t *data_parallel);
+
+/** @brief Free the shared memory
+ *
+ * @param *data_parallel    The data parallel configuration
+ */
+void aialgo_close_data_parallel(aialgo_data_parallel_t *data_parallel);
+
+#endif // AIFES_WITH_POSIX
+
+#endif // AIALGO_DATA_PARALLEL
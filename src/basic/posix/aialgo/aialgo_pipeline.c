@@ -0,0 +1,404 @@
+/**
+ * \file basic/posix/aialgo/aialgo_pipeline.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aialgo_pipeline.h for documentation.
+ * \details
+ */
+
+#include "basic/posix/aialgo/aialgo_pipeline.h"
+
+#ifdef AIFES_WITH_POSIX
+
+#include <sched.h>
+#include <string.h>
+
+// Rough estimation of a desktop / application processor, used if no calibration is given.
+// Only the ratios matter for the balancing of the stages.
+static const aialgo_cost_calibration_t aialgo_pipeline_default_calibration = {
+	.ns_per_op = 0.5f,
+	.ns_per_special_op = 5.0f,
+	.ns_per_byte = 0.1f,
+	.ns_per_layer = 50.0f
+};
+
+static uint32_t aialgo_pipeline_align(uint32_t size)
+{
+	return (size + 3) & ~((uint32_t) 3);
+}
+
+// Split the layers 1 ... layer_count - 1 (without the input layer) into consecutive stages, so that the
+// estimated time of the slowest stage is minimal (linear partition problem, solved with dynamic programming).
+static void aialgo_pipeline_partition(aialgo_pipeline_t *pipeline, aimodel_t *model)
+{
+	uint16_t i, j, s, k;
+	uint16_t layer_count = model->layer_count - 1;
+	uint16_t stage_count = pipeline->stage_count;
+	aicore_layercost_t layer_costs[model->layer_count];
+	aicore_layercost_t total_cost;
+	const aialgo_cost_calibration_t *calibration;
+	float prefix[layer_count + 1];
+	float best[AIALGO_PIPELINE_MAX_STAGES + 1][layer_count + 1];
+	uint16_t split[AIALGO_PIPELINE_MAX_STAGES + 1][layer_count + 1];
+	float stage_latency, candidate;
+	ailayer_t *layer_ptr;
+
+	calibration = pipeline->calibration != 0 ? pipeline->calibration : &aialgo_pipeline_default_calibration;
+
+	if(stage_count > AIALGO_PIPELINE_MAX_STAGES) stage_count = AIALGO_PIPELINE_MAX_STAGES;
+	if(stage_count > layer_count) stage_count = layer_count;
+	if(stage_count == 0) stage_count = 1;
+	pipeline->stage_count = stage_count;
+
+	aialgo_estimate_cost(model, layer_costs, &total_cost);
+
+	prefix[0] = 0.0f;
+	for(i = 0; i < layer_count; i++)
+	{
+		prefix[i + 1] = prefix[i] + aialgo_predict_layer_latency_us(&layer_costs[i + 1], calibration);
+	}
+
+	// best[s][j]: Minimal time of the slowest stage if the first j layers are split into s stages
+	for(j = 0; j <= layer_count; j++)
+	{
+		best[1][j] = prefix[j];
+		split[1][j] = 0;
+	}
+	for(s = 2; s <= stage_count; s++)
+	{
+		for(j = s; j <= layer_count; j++)
+		{
+			best[s][j] = -1.0f;
+			for(k = s - 1; k < j; k++)
+			{
+				stage_latency = prefix[j] - prefix[k];
+				candidate = best[s - 1][k] > stage_latency ? best[s - 1][k] : stage_latency;
+				if(best[s][j] < 0.0f || candidate < best[s][j]){
+					best[s][j] = candidate;
+					split[s][j] = k;
+				}
+			}
+		}
+	}
+
+	// Backtrack the stage borders
+	j = layer_count;
+	for(s = stage_count; s > 0; s--)
+	{
+		k = split[s][j];
+		pipeline->stages[s - 1].layer_count = j - k;
+		pipeline->stages[s - 1].latency_us = prefix[j] - prefix[k];
+		j = k;
+	}
+
+	layer_ptr = model->input_layer->output_layer;
+	for(s = 0; s < stage_count; s++)
+	{
+		pipeline->stages[s].first_layer = layer_ptr;
+		for(i = 1; i < pipeline->stages[s].layer_count; i++)
+		{
+			layer_ptr = layer_ptr->output_layer;
+		}
+		pipeline->stages[s].last_layer = layer_ptr;
+		layer_ptr = layer_ptr->output_layer;
+	}
+	return;
+}
+
+// Size of one ping-pong buffer of the stage (largest result of the inner layers)
+static uint32_t aialgo_pipeline_sizeof_stage_buffer(const aialgo_pipeline_stage_t *stage)
+{
+	uint16_t i;
+	uint32_t size = 0, layer_size;
+	ailayer_t *layer_ptr = stage->first_layer;
+
+	for(i = 0; i < stage->layer_count - 1; i++)
+	{
+		layer_size = aialgo_pipeline_align(aimath_sizeof_tensor_data(&(layer_ptr->result)));
+		if(layer_size > size) size = layer_size;
+		layer_ptr = layer_ptr->output_layer;
+	}
+	return size;
+}
+
+// Size of one buffer of a queue with the tensor params
+static uint32_t aialgo_pipeline_sizeof_queue_buffer(const aitensor_t *tensor)
+{
+	return aialgo_pipeline_align(aimath_sizeof_tensor_data(tensor)) + aialgo_pipeline_align(aimath_sizeof_tensor_params(tensor));
+}
+
+uint32_t aialgo_sizeof_pipeline_memory(aialgo_pipeline_t *pipeline, aimodel_t *model)
+{
+	uint16_t s;
+	uint32_t memory = 0;
+
+	aialgo_pipeline_partition(pipeline, model);
+
+	// Queue buffers
+	memory += AIALGO_PIPELINE_SLOTS * aialgo_pipeline_sizeof_queue_buffer(&(model->input_layer->result));
+	for(s = 0; s < pipeline->stage_count; s++)
+	{
+		memory += AIALGO_PIPELINE_SLOTS * aialgo_pipeline_sizeof_queue_buffer(&(pipeline->stages[s].last_layer->result));
+		memory += 2 * aialgo_pipeline_sizeof_stage_buffer(&(pipeline->stages[s]));
+	}
+	return memory;
+}
+
+static void *aialgo_pipeline_init_queue(aialgo_pipeline_queue_t *queue, const aitensor_t *tensor, void *memory_ptr)
+{
+	uint8_t i;
+
+	queue->buffer_size = aimath_sizeof_tensor_data(tensor);
+	queue->params_size = aimath_sizeof_tensor_params(tensor);
+	for(i = 0; i < AIALGO_PIPELINE_SLOTS; i++)
+	{
+		queue->buffers[i] = memory_ptr;
+		memory_ptr += aialgo_pipeline_align(queue->buffer_size);
+		// Every buffer has its own tensor params, because the stages work on different samples at the same time
+		queue->params[i] = queue->params_size > 0 ? memory_ptr : 0;
+		memory_ptr += aialgo_pipeline_align(queue->params_size);
+	}
+	atomic_init(&queue->head, 0);
+	atomic_init(&queue->tail, 0);
+	return memory_ptr;
+}
+
+uint8_t aialgo_init_pipeline(aialgo_pipeline_t *pipeline, aimodel_t *model, void *memory_ptr, uint32_t memory_size)
+{
+	uint16_t s;
+	aialgo_pipeline_stage_t *stage;
+
+	if(memory_size < aialgo_sizeof_pipeline_memory(pipeline, model)){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("Not enough memory for the pipeline.\n");
+#endif
+		return 1;
+	}
+
+	pipeline->model = model;
+	atomic_init(&pipeline->running, FALSE);
+
+	memory_ptr = aialgo_pipeline_init_queue(&pipeline->queues[0], &(model->input_layer->result), memory_ptr);
+	for(s = 0; s < pipeline->stage_count; s++)
+	{
+		stage = &(pipeline->stages[s]);
+		stage->pipeline = pipeline;
+		stage->input_queue = &pipeline->queues[s];
+		stage->output_queue = &pipeline->queues[s + 1];
+		memory_ptr = aialgo_pipeline_init_queue(stage->output_queue, &(stage->last_layer->result), memory_ptr);
+
+		stage->working_memory_size = aialgo_pipeline_sizeof_stage_buffer(stage);
+		stage->working_memory = memory_ptr;
+		memory_ptr += 2 * stage->working_memory_size;
+
+		// The proxy has the result tensor of the previous layer but the data is read from the input queue
+		stage->original_input_layer = stage->first_layer->input_layer;
+		stage->original_result_params = stage->last_layer->result.tensor_params;
+		stage->input_proxy = *(stage->original_input_layer);
+	}
+	return 0;
+}
+
+// Connect the layers of the stage to the pipeline memory
+static void aialgo_pipeline_connect_stage(aialgo_pipeline_stage_t *stage)
+{
+	uint16_t i;
+	ailayer_t *layer_ptr = stage->first_layer;
+
+	// The inner layers alternate between the two buffers, the last layer writes to the output queue
+	for(i = 0; i < stage->layer_count - 1; i++)
+	{
+		layer_ptr->result.data = stage->working_memory + (i % 2) * stage->working_memory_size;
+		layer_ptr = layer_ptr->output_layer;
+	}
+
+	stage->input_proxy.result.data = stage->input_queue->buffers[0];
+	stage->first_layer->input_layer = &(stage->input_proxy);
+	return;
+}
+
+static void *aialgo_pipeline_run_stage(void *arg)
+{
+	uint16_t i;
+	uint32_t in_index, out_index;
+	aialgo_pipeline_stage_t *stage = (aialgo_pipeline_stage_t *) arg;
+	aialgo_pipeline_queue_t *input_queue = stage->input_queue;
+	aialgo_pipeline_queue_t *output_queue = stage->output_queue;
+	ailayer_t *layer_ptr;
+
+	while(atomic_load_explicit(&stage->pipeline->running, memory_order_relaxed))
+	{
+		// Wait for an input
+		in_index = atomic_load_explicit(&input_queue->tail, memory_order_relaxed);
+		if(atomic_load_explicit(&input_queue->head, memory_order_acquire) == in_index){
+			sched_yield();
+			continue;
+		}
+		// Wait for a free output buffer
+		out_index = atomic_load_explicit(&output_queue->head, memory_order_relaxed);
+		while(out_index - atomic_load_explicit(&output_queue->tail, memory_order_acquire) >= AIALGO_PIPELINE_SLOTS){
+			if(!atomic_load_explicit(&stage->pipeline->running, memory_order_relaxed)){
+				return 0;
+			}
+			sched_yield();
+		}
+
+		stage->input_proxy.result.data = input_queue->buffers[in_index % AIALGO_PIPELINE_SLOTS];
+		stage->last_layer->result.data = output_queue->buffers[out_index % AIALGO_PIPELINE_SLOTS];
+		if(input_queue->params_size > 0){
+			stage->input_proxy.result.tensor_params = input_queue->params[in_index % AIALGO_PIPELINE_SLOTS];
+		}
+		if(output_queue->params_size > 0){
+			stage->last_layer->result.tensor_params = output_queue->params[out_index % AIALGO_PIPELINE_SLOTS];
+		}
+
+		layer_ptr = stage->first_layer;
+		for(i = 0; i < stage->layer_count; i++)
+		{
+			layer_ptr->forward(layer_ptr);
+			layer_ptr = layer_ptr->output_layer;
+		}
+
+		// Publish the result and release the input buffer
+		atomic_store_explicit(&output_queue->head, out_index + 1, memory_order_release);
+		atomic_store_explicit(&input_queue->tail, in_index + 1, memory_order_release);
+	}
+	return 0;
+}
+
+uint8_t aialgo_start_pipeline(aialgo_pipeline_t *pipeline)
+{
+	uint16_t s, i;
+
+	if(pipeline->model == 0){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("The pipeline is not initialized.\n");
+#endif
+		return 1;
+	}
+
+	// Also needed after aialgo_stop_pipeline(), which restores the connections of the model
+	for(s = 0; s < pipeline->stage_count; s++)
+	{
+		aialgo_pipeline_connect_stage(&(pipeline->stages[s]));
+	}
+
+	atomic_store(&pipeline->running, TRUE);
+	for(s = 0; s < pipeline->stage_count; s++)
+	{
+		if(pthread_create(&(pipeline->stages[s].thread), 0, aialgo_pipeline_run_stage, &(pipeline->stages[s])) != 0){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+			LOG_E("Could not create the thread of a pipeline stage.\n");
+#endif
+			atomic_store(&pipeline->running, FALSE);
+			for(i = 0; i < s; i++)
+			{
+				pthread_join(pipeline->stages[i].thread, 0);
+			}
+			for(i = 0; i < pipeline->stage_count; i++)
+			{
+				pipeline->stages[i].first_layer->input_layer = pipeline->stages[i].original_input_layer;
+				pipeline->stages[i].last_layer->result.tensor_params = pipeline->stages[i].original_result_params;
+			}
+			return 1;
+		}
+	}
+	return 0;
+}
+
+void aialgo_stop_pipeline(aialgo_pipeline_t *pipeline)
+{
+	uint16_t s;
+
+	atomic_store(&pipeline->running, FALSE);
+	for(s = 0; s < pipeline->stage_count; s++)
+	{
+		pthread_join(pipeline->stages[s].thread, 0);
+		pipeline->stages[s].first_layer->input_layer = pipeline->stages[s].original_input_layer;
+		pipeline->stages[s].last_layer->result.tensor_params = pipeline->stages[s].original_result_params;
+	}
+	for(s = 0; s <= pipeline->stage_count; s++)
+	{
+		atomic_store(&pipeline->queues[s].head, 0);
+		atomic_store(&pipeline->queues[s].tail, 0);
+	}
+	return;
+}
+
+uint8_t aialgo_push_pipeline(aialgo_pipeline_t *pipeline, const aitensor_t *input_data)
+{
+	aialgo_pipeline_queue_t *queue = &pipeline->queues[0];
+	uint32_t index = atomic_load_explicit(&queue->head, memory_order_relaxed);
+
+	while(index - atomic_load_explicit(&queue->tail, memory_order_acquire) >= AIALGO_PIPELINE_SLOTS){
+		if(!atomic_load_explicit(&pipeline->running, memory_order_relaxed)){
+			return 1;
+		}
+		sched_yield();
+	}
+	memcpy(queue->buffers[index % AIALGO_PIPELINE_SLOTS], input_data->data, queue->buffer_size);
+	if(queue->params_size > 0){
+		memcpy(queue->params[index % AIALGO_PIPELINE_SLOTS], input_data->tensor_params, queue->params_size);
+	}
+	atomic_store_explicit(&queue->head, index + 1, memory_order_release);
+	return 0;
+}
+
+uint8_t aialgo_pop_pipeline(aialgo_pipeline_t *pipeline, aitensor_t *output_data)
+{
+	aialgo_pipeline_queue_t *queue = &pipeline->queues[pipeline->stage_count];
+	uint32_t index = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+
+	while(atomic_load_explicit(&queue->head, memory_order_acquire) == index){
+		if(!atomic_load_explicit(&pipeline->running, memory_order_relaxed)){
+			return 1;
+		}
+		sched_yield();
+	}
+	memcpy(output_data->data, queue->buffers[index % AIALGO_PIPELINE_SLOTS], queue->buffer_size);
+	if(output_data->tensor_params != 0 && queue->params_size > 0){
+		memcpy(output_data->tensor_params, queue->params[index % AIALGO_PIPELINE_SLOTS], queue->params_size);
+	}
+	atomic_store_explicit(&queue->tail, index + 1, memory_order_release);
+	return 0;
+}
+
+void aialgo_print_pipeline(const aialgo_pipeline_t *pipeline, int (*print)(const char *format, ...))
+{
+	uint16_t s, i;
+	ailayer_t *layer_ptr;
+	const char *name;
+
+	print("Pipeline with %d stages:\n", (int) pipeline->stage_count);
+	for(s = 0; s < pipeline->stage_count; s++)
+	{
+		print("Stage %d (%.1f us):", (int) s, pipeline->stages[s].latency_us);
+		layer_ptr = pipeline->stages[s].first_layer;
+		for(i = 0; i < pipeline->stages[s].layer_count; i++)
+		{
+			name = (layer_ptr->layer_type != 0 && layer_ptr->layer_type->name != 0) ? layer_ptr->layer_type->name : "Layer";
+			print(" %s", name);
+			layer_ptr = layer_ptr->output_layer;
+		}
+		print("\n");
+	}
+	return;
+}
+
+#endif // AIFES_WITH_POSIX
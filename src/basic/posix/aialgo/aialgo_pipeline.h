@@ -0,0 +1,210 @@
+/**
+ * \file basic/posix/aialgo/aialgo_pipeline.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Pipeline parallel streaming inference on multi-core POSIX hosts
+ * \details The layers of a sequential model are split into consecutive stages and every stage is executed by its own
+ * thread. While stage 2 calculates sample n, stage 1 already calculates sample n + 1. This increases the throughput
+ * of continuous data streams with batch size 1, where the single layers are too small to be split over multiple cores.
+ * The latency of a single sample stays the same (plus the handoff between the threads).
+ *
+ * The stages are balanced with the cost model (see aialgo_cost_model.h): The layers are partitioned so that the
+ * estimated time of the slowest stage is minimal.
+ *
+ * Between two stages there is a lock-free single producer / single consumer queue with AIALGO_PIPELINE_SLOTS result
+ * buffers (double buffering): The producing stage writes the results of its last layer to a free buffer while the
+ * consuming stage still reads the previous one. The input samples are copied to the first queue by
+ * aialgo_push_pipeline() and the results are copied from the last queue by aialgo_pop_pipeline().
+ *
+ * Only available with AIFES_WITH_POSIX (requires pthreads and C11 atomics).
+ *
+ * Example:
+ * \code{.c}
+ * aialgo_pipeline_t pipeline = {
+ *     .stage_count = 4,
+ *     .calibration = 0
+ * };
+ *
+ * uint32_t pipeline_memory_size = aialgo_sizeof_pipeline_memory(&pipeline, &model);
+ * void *pipeline_memory = malloc(pipeline_memory_size);
+ * aialgo_init_pipeline(&pipeline, &model, pipeline_memory, pipeline_memory_size);
+ * aialgo_start_pipeline(&pipeline);
+ *
+ * // Producer thread
+ * aialgo_push_pipeline(&pipeline, &input_sample);
+ *
+ * // Consumer thread
+ * aialgo_pop_pipeline(&pipeline, &output_sample);
+ *
+ * aialgo_stop_pipeline(&pipeline);
+ * \endcode
+ */
+
+#ifndef AIALGO_PIPELINE
+#define AIALGO_PIPELINE
+
+#include "../../../aifes.h"
+
+#ifdef AIFES_WITH_POSIX
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "basic/base/aialgo/aialgo_cost_model.h"
+
+#define AIALGO_PIPELINE_MAX_STAGES  8 /**< Maximum number of stages (threads) of a pipeline */
+#define AIALGO_PIPELINE_SLOTS       2 /**< Number of buffers in the queue between two stages */
+
+typedef struct aialgo_pipeline  aialgo_pipeline_t;
+typedef struct aialgo_pipeline_queue  aialgo_pipeline_queue_t;
+typedef struct aialgo_pipeline_stage  aialgo_pipeline_stage_t;
+
+/** @brief Lock-free single producer / single consumer queue of result buffers
+ *
+ * The buffer (head % AIALGO_PIPELINE_SLOTS) is written next by the producer, the buffer (tail % AIALGO_PIPELINE_SLOTS)
+ * is read next by the consumer. The queue is empty if head == tail and full if head - tail == AIALGO_PIPELINE_SLOTS.
+ */
+struct aialgo_pipeline_queue {
+	void *buffers[AIALGO_PIPELINE_SLOTS]; /**< Memory of the buffers. */
+	uint32_t buffer_size; /**< Size of one buffer in bytes. */
+	void *params[AIALGO_PIPELINE_SLOTS]; /**< Tensor params (for example the Q15 shift) of the buffers (0 for data types without params). */
+	uint32_t params_size; /**< Size of the tensor params of one buffer in bytes. */
+	atomic_uint head; /**< Number of buffers published by the producer. */
+	atomic_uint tail; /**< Number of buffers released by the consumer. */
+};
+
+/** @brief Consecutive layers of the model that are executed by one thread
+ *
+ */
+struct aialgo_pipeline_stage {
+	ailayer_t *first_layer; /**< First layer of the stage. */
+	ailayer_t *last_layer; /**< Last layer of the stage (writes to the output queue). */
+	uint16_t layer_count; /**< Number of layers in the stage. */
+	float latency_us; /**< Estimated time of the stage in microseconds. */
+
+	ailayer_t *original_input_layer; /**< Input layer of the first layer in the model (restored by aialgo_stop_pipeline()). */
+	void *original_result_params; /**< Tensor params of the result of the last layer (restored by aialgo_stop_pipeline()). */
+	ailayer_t input_proxy; /**< Replaces the input layer of the first layer, points to the current buffer of the input queue. */
+	aialgo_pipeline_queue_t *input_queue; /**< Queue with the inputs of the stage. */
+	aialgo_pipeline_queue_t *output_queue; /**< Queue for the results of the stage. */
+	void *working_memory; /**< Ping-pong buffers for the results of the inner layers of the stage. */
+	uint32_t working_memory_size; /**< Size of one ping-pong buffer in bytes. */
+
+	aialgo_pipeline_t *pipeline; /**< Back-link to the pipeline. */
+	pthread_t thread; /**< Thread that executes the stage. */
+};
+
+/** @brief Configuration and state of a pipeline
+ *
+ */
+struct aialgo_pipeline {
+	/** @name Configuration
+	 * @brief Required configuration parameters
+	 */
+	///@{
+	uint16_t stage_count; /**< Number of stages / threads (at most AIALGO_PIPELINE_MAX_STAGES, reduced to the number of layers). */
+	const aialgo_cost_calibration_t *calibration; /**< Calibration of the platform for the balancing (0 for a default estimation). */
+	///@}
+
+	/** @name Variables for internal use only
+	 */
+	///@{
+	aimodel_t *model; /**< The model. */
+	aialgo_pipeline_stage_t stages[AIALGO_PIPELINE_MAX_STAGES]; /**< The stages. */
+	aialgo_pipeline_queue_t queues[AIALGO_PIPELINE_MAX_STAGES + 1]; /**< Queue i is the input of stage i, the last queue holds the results. */
+	atomic_uint running; /**< TRUE while the threads are running. */
+	///@}
+};
+
+/** @brief Partition the model into stages and calculate the memory size for the pipeline
+ *
+ * The memory contains the buffers of the queues (with their own tensor params) and the ping-pong buffers of the stages.
+ * The model must be compiled and the parameters must be set.
+ *
+ * @param *pipeline The pipeline configuration
+ * @param *model    The model
+ * @return          Required memory size in bytes
+ */
+uint32_t aialgo_sizeof_pipeline_memory(aialgo_pipeline_t *pipeline, aimodel_t *model);
+
+/** @brief Partition the model into stages and assign the memory to the pipeline
+ *
+ * The result memory of the layers is replaced by the pipeline memory and the first layer of every stage gets a proxy
+ * input layer. Do not use the model with other algorithms until aialgo_stop_pipeline() was called
+ * (and the inference memory was scheduled again).
+ *
+ * @param *pipeline     The pipeline
+ * @param *model        The model
+ * @param *memory_ptr   Pointer to the memory block
+ * @param memory_size   Size of the memory block (see aialgo_sizeof_pipeline_memory())
+ * @return              0 if successful
+ */
+uint8_t aialgo_init_pipeline(aialgo_pipeline_t *pipeline, aimodel_t *model, void *memory_ptr, uint32_t memory_size);
+
+/** @brief Start one thread per stage
+ *
+ * Connects the stages to the pipeline memory again, so the pipeline can be restarted after aialgo_stop_pipeline()
+ * without a new initialization.
+ *
+ * @param *pipeline The initialized pipeline
+ * @return          0 if successful, 1 if a thread could not be created (the started threads are stopped again)
+ */
+uint8_t aialgo_start_pipeline(aialgo_pipeline_t *pipeline);
+
+/** @brief Stop the threads and restore the connections of the layers
+ *
+ * Samples that are still in the pipeline are discarded.
+ *
+ * @param *pipeline The running pipeline
+ */
+void aialgo_stop_pipeline(aialgo_pipeline_t *pipeline);
+
+/** @brief Copy an input sample into the pipeline
+ *
+ * Waits until a buffer of the first queue is free. Must only be called from one thread (single producer).
+ *
+ * @param *pipeline     The running pipeline
+ * @param *input_data   Input sample with the shape of the input layer of the model
+ * @return              0 if successful, 1 if the pipeline is not running
+ */
+uint8_t aialgo_push_pipeline(aialgo_pipeline_t *pipeline, const aitensor_t *input_data);
+
+/** @brief Copy the result of the next sample from the pipeline
+ *
+ * Waits until the result is available. The results are returned in the order of the inputs.
+ * Must only be called from one thread (single consumer).
+ *
+ * @param *pipeline     The running pipeline
+ * @param *output_data  Tensor with the shape of the output layer of the model for the result
+ * @return              0 if successful, 1 if the pipeline is not running
+ */
+uint8_t aialgo_pop_pipeline(aialgo_pipeline_t *pipeline, aitensor_t *output_data);
+
+/** @brief Print the stages with their layers and estimated times
+ *
+ * @param *pipeline The initialized pipeline
+ * @param *print    A function for printing (for example printf)
+ */
+void aialgo_print_pipeline(const aialgo_pipeline_t *pipeline, int (*print)(const char *format, ...));
+
+#endif // AIFES_WITH_POSIX
+
+#endif // AIALGO_PIPELINE
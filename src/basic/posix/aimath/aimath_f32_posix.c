@@ -0,0 +1,184 @@
+/**
+ * \file basic/posix/aimath/aimath_f32_posix.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aimath_f32_posix.h for documentation.
+ * \details
+ */
+
+#include "basic/posix/aimath/aimath_f32_posix.h"
+
+#ifdef AIFES_WITH_POSIX
+
+#include <pthread.h>
+
+typedef struct aimath_f32_posix_job  aimath_f32_posix_job_t;
+
+// Part of a calculation that is executed by one thread
+struct aimath_f32_posix_job {
+	const float *data; // Elements of a full reduction
+	uint32_t count;
+	float center; // Center of the squared sum
+	uint8_t squared;
+	float result;
+
+	aitensor_t x; // Views of a reduction along an axis
+	aitensor_t reduced;
+	uint16_t x_shape[8];
+	uint16_t reduced_shape[8];
+	uint8_t axis;
+};
+
+static uint16_t aimath_f32_posix_thread_count(uint32_t elements, uint32_t max_parts)
+{
+	uint32_t threads = elements / AIMATH_POSIX_MIN_ELEMENTS;
+
+	if(threads > AIMATH_POSIX_THREADS) threads = AIMATH_POSIX_THREADS;
+	if(threads > max_parts) threads = max_parts;
+	return threads < 1 ? 1 : threads;
+}
+
+// Run the jobs 1 ... count - 1 in new threads and job 0 in the calling thread
+static void aimath_f32_posix_run(void *(*function)(void *), aimath_f32_posix_job_t *jobs, uint16_t count)
+{
+	uint16_t i;
+	pthread_t threads[AIMATH_POSIX_THREADS];
+	uint8_t started[AIMATH_POSIX_THREADS];
+
+	for(i = 1; i < count; i++)
+	{
+		started[i] = pthread_create(&threads[i], 0, function, &jobs[i]) == 0;
+		if(!started[i]){
+			// Calculate the job in the calling thread
+			function(&jobs[i]);
+		}
+	}
+	function(&jobs[0]);
+	for(i = 1; i < count; i++)
+	{
+		if(started[i]){
+			pthread_join(threads[i], 0);
+		}
+	}
+	return;
+}
+
+static void *aimath_f32_posix_sum_job(void *arg)
+{
+	aimath_f32_posix_job_t *job = (aimath_f32_posix_job_t *) arg;
+
+	if(job->squared){
+		job->result = aimath_f32_default_pairwise_sum_squares(job->data, job->count, job->center);
+	} else {
+		job->result = aimath_f32_default_pairwise_sum(job->data, job->count);
+	}
+	return 0;
+}
+
+static float aimath_f32_posix_full_reduction(const aitensor_t *x, uint8_t squared)
+{
+	uint16_t i, count;
+	uint32_t elements = aimath_tensor_elements(x);
+	uint32_t part, begin = 0;
+	aimath_f32_posix_job_t jobs[AIMATH_POSIX_THREADS];
+	float partial[AIMATH_POSIX_THREADS];
+
+	count = aimath_f32_posix_thread_count(elements, AIMATH_POSIX_THREADS);
+	// Parts with a multiple of AIMATH_F32_REDUCE_LANES elements, the last part gets the rest
+	part = (elements / count) & ~((uint32_t) AIMATH_F32_REDUCE_LANES - 1);
+	for(i = 0; i < count; i++)
+	{
+		jobs[i].data = (const float *) x->data + begin;
+		jobs[i].count = i == count - 1 ? elements - begin : part;
+		jobs[i].center = 0.0f;
+		jobs[i].squared = squared;
+		begin += part;
+	}
+	aimath_f32_posix_run(aimath_f32_posix_sum_job, jobs, count);
+
+	for(i = 0; i < count; i++)
+	{
+		partial[i] = jobs[i].result;
+	}
+	return aimath_f32_default_pairwise_sum(partial, count);
+}
+
+void aimath_f32_posix_sum(const aitensor_t *x, void *result)
+{
+	*((float *) result) = aimath_f32_posix_full_reduction(x, FALSE);
+	return;
+}
+
+void aimath_f32_posix_norm_squared(const aitensor_t *x, void *result)
+{
+	*((float *) result) = aimath_f32_posix_full_reduction(x, TRUE);
+	return;
+}
+
+static void *aimath_f32_posix_reduce_sum_job(void *arg)
+{
+	aimath_f32_posix_job_t *job = (aimath_f32_posix_job_t *) arg;
+
+	aimath_f32_default_reduce_sum(&job->x, job->axis, &job->reduced);
+	return 0;
+}
+
+void aimath_f32_posix_reduce_sum(const aitensor_t *x, uint8_t axis, aitensor_t *result)
+{
+	uint8_t d;
+	uint16_t i, count;
+	uint16_t rows = x->shape[0];
+	uint16_t part, begin = 0;
+	uint32_t x_row_elements, result_row_elements;
+	aimath_f32_posix_job_t jobs[AIMATH_POSIX_THREADS];
+
+	count = axis == 0 || x->dim > 8 ? 1 : aimath_f32_posix_thread_count(aimath_tensor_elements(x), rows);
+	if(count == 1){
+		aimath_f32_default_reduce_sum(x, axis, result);
+		return;
+	}
+
+	x_row_elements = aimath_tensor_elements(x) / rows;
+	result_row_elements = aimath_tensor_elements(result) / rows;
+	part = rows / count;
+	for(i = 0; i < count; i++)
+	{
+		// View of the rows begin ... begin + part - 1 of the first dimension
+		for(d = 0; d < x->dim; d++)
+		{
+			jobs[i].x_shape[d] = x->shape[d];
+			jobs[i].reduced_shape[d] = result->shape[d];
+		}
+		jobs[i].x_shape[0] = i == count - 1 ? rows - begin : part;
+		jobs[i].reduced_shape[0] = jobs[i].x_shape[0];
+
+		jobs[i].x = *x;
+		jobs[i].x.shape = jobs[i].x_shape;
+		jobs[i].x.data = (float *) x->data + begin * x_row_elements;
+		jobs[i].reduced = *result;
+		jobs[i].reduced.shape = jobs[i].reduced_shape;
+		jobs[i].reduced.data = (float *) result->data + begin * result_row_elements;
+		jobs[i].axis = axis;
+		begin += part;
+	}
+	aimath_f32_posix_run(aimath_f32_posix_reduce_sum_job, jobs, count);
+	return;
+}
+
+#endif // AIFES_WITH_POSIX
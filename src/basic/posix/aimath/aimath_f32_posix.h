@@ -0,0 +1,81 @@
+/**
+ * \file basic/posix/aimath/aimath_f32_posix.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Multi-threaded math functions for \link aimath_f32.h F32 \endlink data type on POSIX hosts
+ * \details The functions have the same interface as the default implementations, so they can replace them in the
+ * math function pointers of the layers, losses and optimizers (for example ailoss_mse.norm_squared).
+ *
+ * A tensor is split into up to AIMATH_POSIX_THREADS parts that are calculated in parallel with the default
+ * implementation. Tensors with less than AIMATH_POSIX_MIN_ELEMENTS elements per thread are calculated in the calling
+ * thread, because the start of the threads would take longer than the calculation.
+ * The partial results are combined in a fixed order, so the results do not depend on the scheduling of the threads.
+ *
+ * Only available with AIFES_WITH_POSIX.
+ */
+
+#ifndef AIMATH_F32_POSIX
+#define AIMATH_F32_POSIX
+
+#include "../../../aifes.h"
+
+#ifdef AIFES_WITH_POSIX
+
+#ifndef AIMATH_POSIX_THREADS
+#define AIMATH_POSIX_THREADS        4 /**< Maximum number of threads of a calculation (including the calling thread) */
+#endif
+
+#ifndef AIMATH_POSIX_MIN_ELEMENTS
+#define AIMATH_POSIX_MIN_ELEMENTS   32768 /**< Minimum number of elements per thread */
+#endif
+
+/** @brief Calculates the sum of all elements in a \link aimath_f32.h F32 \endlink tensor with multiple threads
+  *
+  * See aimath_f32_default_sum().
+  *
+  * @param *x       F32 tensor x (N-D tensor)
+  * @param *result  Scalar result (type aiscalar_f32_t / float)
+  */
+void aimath_f32_posix_sum(const aitensor_t *x, void *result);
+
+/** @brief Calculates the squared sum of all elements in a \link aimath_f32.h F32 \endlink tensor with multiple threads
+  *
+  * See aimath_f32_default_norm_squared().
+  *
+  * @param *x       F32 tensor x (N-D tensor)
+  * @param *result  Scalar result (type aiscalar_f32_t / float)
+  */
+void aimath_f32_posix_norm_squared(const aitensor_t *x, void *result);
+
+/** @brief Calculates the sum of a \link aimath_f32.h F32 \endlink tensor along an axis with multiple threads
+  *
+  * See aimath_f32_default_reduce_sum(). The first dimension (for example the batch) is split between the threads,
+  * so the reduction of axis 0 is calculated in the calling thread.
+  *
+  * @param *x       F32 tensor x (N-D tensor)
+  * @param axis     Axis to reduce (0 ... x->dim - 1)
+  * @param *result  Resulting F32 tensor (N-D tensor with shape[axis] = 1)
+  */
+void aimath_f32_posix_reduce_sum(const aitensor_t *x, uint8_t axis, aitensor_t *result);
+
+#endif // AIFES_WITH_POSIX
+
+#endif // AIMATH_F32_POSIX
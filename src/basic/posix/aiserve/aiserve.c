@@ -0,0 +1,608 @@
+/**
+ * \file basic/posix/aiserve/aiserve.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aiserve.h for documentation.
+ * \details
+ */
+
+#include "basic/posix/aiserve/aiserve.h"
+
+#ifdef AIFES_WITH_POSIX
+
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#define AISERVE_IDLE_TIMEOUT_US 100000 // Maximal time until aiserve_stop() is noticed
+
+static uint64_t aiserve_time_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t) ts.tv_sec * 1000000 + (uint64_t) ts.tv_nsec / 1000;
+}
+
+static uint32_t aiserve_align(uint32_t size)
+{
+	return (size + 63) & ~((uint32_t) 63);
+}
+
+// Set the batch dimension of the input layer and update the result shapes of all layers
+static void aiserve_set_batch_size(aimodel_t *model, uint16_t batch_size)
+{
+	uint16_t i;
+	ailayer_t *layer_ptr = model->input_layer;
+
+	model->input_layer->result.shape[0] = batch_size;
+	for(i = 0; i < model->layer_count; i++)
+	{
+		layer_ptr->calc_result_shape(layer_ptr);
+		layer_ptr = layer_ptr->output_layer;
+	}
+	return;
+}
+
+static void aiserve_read_stats(const aiserve_shm_header_t *header, aiserve_stats_t *stats)
+{
+	unsigned int sequence;
+
+	do {
+		sequence = atomic_load_explicit((atomic_uint *) &header->stats_sequence, memory_order_acquire);
+		*stats = header->stats;
+		atomic_thread_fence(memory_order_acquire);
+	} while((sequence & 1) || sequence != atomic_load_explicit((atomic_uint *) &header->stats_sequence, memory_order_relaxed));
+	return;
+}
+
+uint32_t aiserve_sizeof_memory(aiserve_t *server, aimodel_t *model)
+{
+	uint32_t memory = 0;
+	uint16_t batch_dim_size = model->input_layer->result.shape[0];
+	uint16_t max_batch = server->max_batch > AISERVE_MAX_CLIENTS ? AISERVE_MAX_CLIENTS : server->max_batch;
+
+	aiserve_set_batch_size(model, max_batch);
+	memory += aiserve_align(aialgo_sizeof_inference_memory(model));
+	memory += aiserve_align(aimath_sizeof_tensor_data(&(model->input_layer->result)));
+	memory += aiserve_align(aimath_sizeof_tensor_data(&(model->output_layer->result)));
+	aiserve_set_batch_size(model, batch_dim_size);
+	return memory;
+}
+
+uint8_t aiserve_init(aiserve_t *server, aimodel_t *model, void *memory_ptr, uint32_t memory_size)
+{
+	uint16_t i;
+	int fd = -1;
+	struct sockaddr_un address;
+	aiserve_shm_header_t *header;
+
+	if(model->input_layer->result.dtype != aif32 || model->output_layer->result.dtype != aif32
+	   || model->input_layer->result.dim > AISERVE_MAX_DIM || model->output_layer->result.dim > AISERVE_MAX_DIM){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("The server only supports F32 inputs and outputs with up to AISERVE_MAX_DIM dimensions.\n");
+#endif
+		return 1;
+	}
+	if(strlen(server->socket_path) >= sizeof(address.sun_path) || strlen(server->shm_name) >= AISERVE_SHM_NAME_LENGTH){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("The socket path or shared memory name of the server is too long.\n");
+#endif
+		return 1;
+	}
+	if(server->max_batch == 0 || server->max_batch > AISERVE_MAX_CLIENTS){
+		server->max_batch = AISERVE_MAX_CLIENTS;
+	}
+	if(memory_size < aiserve_sizeof_memory(server, model)){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("Not enough memory for the server.\n");
+#endif
+		return 1;
+	}
+
+	server->model = model;
+	server->listen_fd = -1;
+	server->shm = 0;
+	server->pending_count = 0;
+	for(i = 0; i < AISERVE_MAX_CLIENTS; i++)
+	{
+		server->client_fds[i] = -1;
+	}
+	atomic_init(&server->running, FALSE);
+	server->start_time_us = aiserve_time_us();
+
+	// Sample sizes
+	server->batch_dim_size = model->input_layer->result.shape[0];
+	aiserve_set_batch_size(model, 1);
+	server->input_size = aimath_sizeof_tensor_data(&(model->input_layer->result));
+	server->output_size = aimath_sizeof_tensor_data(&(model->output_layer->result));
+
+	// Memory for batches with max_batch samples
+	aiserve_set_batch_size(model, server->max_batch);
+	server->inference_memory_size = aialgo_sizeof_inference_memory(model);
+	server->inference_memory = memory_ptr;
+	memory_ptr += aiserve_align(server->inference_memory_size);
+	server->staging_input = memory_ptr;
+	memory_ptr += aiserve_align(server->max_batch * server->input_size);
+	server->staging_output = memory_ptr;
+	aialgo_schedule_inference_memory(model, server->inference_memory, server->inference_memory_size);
+
+	// Shared memory: Header, input samples of all slots, output samples of all slots
+	server->input_offset = aiserve_align(sizeof(aiserve_shm_header_t));
+	server->output_offset = server->input_offset + aiserve_align(AISERVE_MAX_CLIENTS * server->input_size);
+	server->shm_size = server->output_offset + aiserve_align(AISERVE_MAX_CLIENTS * server->output_size);
+
+	shm_unlink(server->shm_name);
+	fd = shm_open(server->shm_name, O_CREAT | O_RDWR, 0600);
+	if(fd < 0 || ftruncate(fd, server->shm_size) != 0){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("Could not create the shared memory of the server.\n");
+#endif
+		goto error;
+	}
+	server->shm = mmap(0, server->shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	fd = -1;
+	if(server->shm == MAP_FAILED){
+		server->shm = 0;
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("Could not map the shared memory of the server.\n");
+#endif
+		goto error;
+	}
+	header = (aiserve_shm_header_t *) server->shm;
+	atomic_init(&header->stats_sequence, 0);
+	memset(&header->stats, 0, sizeof(aiserve_stats_t));
+
+	// Listening socket
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strcpy(address.sun_path, server->socket_path);
+	unlink(server->socket_path);
+	server->listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if(server->listen_fd < 0
+	   || bind(server->listen_fd, (struct sockaddr *) &address, sizeof(address)) != 0
+	   || listen(server->listen_fd, AISERVE_MAX_CLIENTS) != 0){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("Could not create the socket of the server.\n");
+#endif
+		goto error;
+	}
+	return 0;
+
+error:
+	// Release everything that was created before the error
+	if(fd >= 0){
+		close(fd);
+	}
+	if(server->listen_fd >= 0){
+		close(server->listen_fd);
+		server->listen_fd = -1;
+		unlink(server->socket_path);
+	}
+	if(server->shm != 0){
+		munmap(server->shm, server->shm_size);
+		server->shm = 0;
+	}
+	shm_unlink(server->shm_name);
+	aiserve_set_batch_size(model, server->batch_dim_size);
+	return 1;
+}
+
+static void aiserve_accept(aiserve_t *server)
+{
+	uint16_t i, slot;
+	int fd;
+	aiserve_hello_t hello;
+	aitensor_t *input = &(server->model->input_layer->result);
+	aitensor_t *output = &(server->model->output_layer->result);
+
+	fd = accept(server->listen_fd, 0, 0);
+	if(fd < 0) return;
+
+	for(slot = 0; slot < AISERVE_MAX_CLIENTS && server->client_fds[slot] >= 0; slot++);
+	if(slot == AISERVE_MAX_CLIENTS){
+		// No free slot
+		close(fd);
+		return;
+	}
+
+	memset(&hello, 0, sizeof(hello));
+	hello.slot = slot;
+	hello.shm_size = server->shm_size;
+	hello.input_offset = server->input_offset + slot * server->input_size;
+	hello.output_offset = server->output_offset + slot * server->output_size;
+	hello.input_dim = input->dim;
+	hello.output_dim = output->dim;
+	for(i = 0; i < input->dim; i++)
+	{
+		hello.input_shape[i] = input->shape[i];
+	}
+	for(i = 0; i < output->dim; i++)
+	{
+		hello.output_shape[i] = output->shape[i];
+	}
+	hello.input_shape[0] = 1;
+	hello.output_shape[0] = 1;
+	strcpy(hello.shm_name, server->shm_name);
+
+	if(send(fd, &hello, sizeof(hello), MSG_NOSIGNAL) != sizeof(hello)){
+		close(fd);
+		return;
+	}
+	server->client_fds[slot] = fd;
+	return;
+}
+
+static void aiserve_remove_client(aiserve_t *server, uint16_t slot)
+{
+	uint16_t i, j;
+
+	close(server->client_fds[slot]);
+	server->client_fds[slot] = -1;
+	for(i = 0, j = 0; i < server->pending_count; i++)
+	{
+		if(server->pending[i] != slot){
+			server->pending[j++] = server->pending[i];
+		}
+	}
+	server->pending_count = j;
+	return;
+}
+
+static void aiserve_receive(aiserve_t *server, uint16_t slot)
+{
+	uint16_t i;
+	aiserve_message_t message;
+
+	if(recv(server->client_fds[slot], &message, sizeof(message), MSG_WAITALL) != sizeof(message)){
+		aiserve_remove_client(server, slot);
+		return;
+	}
+	// Only one request per client can be in progress
+	for(i = 0; i < server->pending_count; i++)
+	{
+		if(server->pending[i] == slot) return;
+	}
+	server->requests[slot] = message;
+	server->request_time_us[slot] = aiserve_time_us();
+	server->pending[server->pending_count++] = slot;
+	return;
+}
+
+static void aiserve_run_batch(aiserve_t *server)
+{
+	uint16_t i, j, batch_size, slot;
+	uint8_t slots[AISERVE_MAX_CLIENTS];
+	uint8_t zero_copy = TRUE;
+	uint16_t input_shape[AISERVE_MAX_DIM];
+	uint64_t start_us, end_us, latency_us;
+	aimodel_t *model = server->model;
+	aitensor_t *output;
+	void *output_data = 0;
+	aitensor_t input;
+	aiserve_message_t response;
+	aiserve_shm_header_t *header = (aiserve_shm_header_t *) server->shm;
+
+	// Take the oldest requests and sort them by slot
+	batch_size = server->pending_count < server->max_batch ? server->pending_count : server->max_batch;
+	for(i = 0; i < batch_size; i++)
+	{
+		slot = server->pending[i];
+		for(j = i; j > 0 && slots[j - 1] > slot; j--)
+		{
+			slots[j] = slots[j - 1];
+		}
+		slots[j] = slot;
+	}
+	server->pending_count -= batch_size;
+	memmove(server->pending, &server->pending[batch_size], server->pending_count);
+
+	for(i = 1; i < batch_size; i++)
+	{
+		if(slots[i] != slots[i - 1] + 1) zero_copy = FALSE;
+	}
+
+	aiserve_set_batch_size(model, batch_size);
+	output = &(model->output_layer->result);
+	for(i = 0; i < model->input_layer->result.dim; i++)
+	{
+		input_shape[i] = model->input_layer->result.shape[i];
+	}
+	input.dtype = aif32;
+	input.dim = model->input_layer->result.dim;
+	input.shape = input_shape;
+	input.tensor_params = 0;
+
+	if(zero_copy){
+		// Calculate directly on the shared memory
+		input.data = server->shm + server->input_offset + slots[0] * server->input_size;
+		output_data = output->data;
+		output->data = server->shm + server->output_offset + slots[0] * server->output_size;
+	} else {
+		input.data = server->staging_input;
+		for(i = 0; i < batch_size; i++)
+		{
+			memcpy(server->staging_input + i * server->input_size, server->shm + server->input_offset + slots[i] * server->input_size, server->input_size);
+		}
+	}
+
+	start_us = aiserve_time_us();
+	aialgo_forward_model(model, &input);
+	end_us = aiserve_time_us();
+
+	if(zero_copy){
+		output->data = output_data;
+	} else {
+		for(i = 0; i < batch_size; i++)
+		{
+			memcpy(server->shm + server->output_offset + slots[i] * server->output_size, output->data + i * server->output_size, server->output_size);
+		}
+	}
+
+	// Update the statistics (sequence lock)
+	atomic_fetch_add_explicit(&header->stats_sequence, 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+	header->stats.requests += batch_size;
+	header->stats.batches++;
+	header->stats.zero_copy_batches += zero_copy;
+	header->stats.compute_us += end_us - start_us;
+	for(i = 0; i < batch_size; i++)
+	{
+		latency_us = end_us - server->request_time_us[slots[i]];
+		header->stats.latency_sum_us += latency_us;
+		if(latency_us > header->stats.latency_max_us) header->stats.latency_max_us = (uint32_t) latency_us;
+	}
+	header->stats.uptime_us = end_us - server->start_time_us;
+	atomic_fetch_add_explicit(&header->stats_sequence, 1, memory_order_release);
+
+	// Responses
+	for(i = 0; i < batch_size; i++)
+	{
+		response.sequence = server->requests[slots[i]].sequence;
+		response.status = 0;
+		response.latency_us = (uint32_t) (aiserve_time_us() - server->request_time_us[slots[i]]);
+		if(send(server->client_fds[slots[i]], &response, sizeof(response), MSG_NOSIGNAL) != sizeof(response)){
+			aiserve_remove_client(server, slots[i]);
+		}
+	}
+	return;
+}
+
+uint8_t aiserve_run(aiserve_t *server)
+{
+	uint16_t slot;
+	int max_fd;
+	uint64_t now_us, timeout_us, waited_us;
+	fd_set read_fds;
+	struct timeval timeout;
+
+	atomic_store(&server->running, TRUE);
+	while(atomic_load(&server->running))
+	{
+		// Wait for new requests at most until the batch timeout of the oldest request
+		timeout_us = AISERVE_IDLE_TIMEOUT_US;
+		if(server->pending_count > 0){
+			waited_us = aiserve_time_us() - server->request_time_us[server->pending[0]];
+			timeout_us = waited_us < server->batch_timeout_us ? server->batch_timeout_us - waited_us : 0;
+		}
+		timeout.tv_sec = timeout_us / 1000000;
+		timeout.tv_usec = timeout_us % 1000000;
+
+		FD_ZERO(&read_fds);
+		FD_SET(server->listen_fd, &read_fds);
+		max_fd = server->listen_fd;
+		for(slot = 0; slot < AISERVE_MAX_CLIENTS; slot++)
+		{
+			if(server->client_fds[slot] >= 0){
+				FD_SET(server->client_fds[slot], &read_fds);
+				if(server->client_fds[slot] > max_fd) max_fd = server->client_fds[slot];
+			}
+		}
+
+		if(select(max_fd + 1, &read_fds, 0, 0, &timeout) < 0){
+			if(errno == EINTR) continue;
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+			LOG_E("Waiting for the clients of the server failed.\n");
+#endif
+			return 1;
+		}
+
+		if(FD_ISSET(server->listen_fd, &read_fds)){
+			aiserve_accept(server);
+		}
+		for(slot = 0; slot < AISERVE_MAX_CLIENTS; slot++)
+		{
+			if(server->client_fds[slot] >= 0 && FD_ISSET(server->client_fds[slot], &read_fds)){
+				aiserve_receive(server, slot);
+			}
+		}
+
+		// Dynamic batching
+		now_us = aiserve_time_us();
+		while(server->pending_count >= server->max_batch
+		      || (server->pending_count > 0 && now_us - server->request_time_us[server->pending[0]] >= server->batch_timeout_us))
+		{
+			aiserve_run_batch(server);
+		}
+	}
+	return 0;
+}
+
+void aiserve_stop(aiserve_t *server)
+{
+	atomic_store(&server->running, FALSE);
+	return;
+}
+
+void aiserve_close(aiserve_t *server)
+{
+	uint16_t slot;
+
+	for(slot = 0; slot < AISERVE_MAX_CLIENTS; slot++)
+	{
+		if(server->client_fds[slot] >= 0){
+			close(server->client_fds[slot]);
+			server->client_fds[slot] = -1;
+		}
+	}
+	server->pending_count = 0;
+	if(server->listen_fd >= 0){
+		close(server->listen_fd);
+		server->listen_fd = -1;
+		unlink(server->socket_path);
+	}
+	if(server->shm != 0){
+		munmap(server->shm, server->shm_size);
+		server->shm = 0;
+		shm_unlink(server->shm_name);
+	}
+	aiserve_set_batch_size(server->model, server->batch_dim_size);
+	return;
+}
+
+void aiserve_server_stats(const aiserve_t *server, aiserve_stats_t *stats)
+{
+	aiserve_read_stats((const aiserve_shm_header_t *) server->shm, stats);
+	return;
+}
+
+uint8_t aiserve_connect(aiserve_client_t *client, const char *socket_path)
+{
+	uint8_t i;
+	int fd;
+	struct sockaddr_un address;
+	aiserve_hello_t hello;
+
+	client->shm = 0;
+	client->sequence = 0;
+
+	memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	strncpy(address.sun_path, socket_path, sizeof(address.sun_path) - 1);
+	client->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if(client->fd < 0){
+		return 1;
+	}
+	if(connect(client->fd, (struct sockaddr *) &address, sizeof(address)) != 0
+	   || recv(client->fd, &hello, sizeof(hello), MSG_WAITALL) != sizeof(hello)){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("Could not connect to the server.\n");
+#endif
+		close(client->fd);
+		client->fd = -1;
+		return 1;
+	}
+	hello.shm_name[AISERVE_SHM_NAME_LENGTH - 1] = 0;
+
+	fd = shm_open(hello.shm_name, O_RDWR, 0);
+	if(fd >= 0){
+		client->shm = mmap(0, hello.shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		close(fd);
+	}
+	if(fd < 0 || client->shm == MAP_FAILED){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("Could not map the shared memory of the server.\n");
+#endif
+		client->shm = 0;
+		close(client->fd);
+		client->fd = -1;
+		return 1;
+	}
+	client->shm_size = hello.shm_size;
+	client->slot = hello.slot;
+
+	for(i = 0; i < AISERVE_MAX_DIM; i++)
+	{
+		client->input_shape[i] = hello.input_shape[i];
+		client->output_shape[i] = hello.output_shape[i];
+	}
+	client->input.dtype = aif32;
+	client->input.dim = hello.input_dim;
+	client->input.shape = client->input_shape;
+	client->input.tensor_params = 0;
+	client->input.data = client->shm + hello.input_offset;
+
+	client->output.dtype = aif32;
+	client->output.dim = hello.output_dim;
+	client->output.shape = client->output_shape;
+	client->output.tensor_params = 0;
+	client->output.data = client->shm + hello.output_offset;
+	return 0;
+}
+
+uint8_t aiserve_infer(aiserve_client_t *client)
+{
+	aiserve_message_t message;
+
+	message.sequence = client->sequence++;
+	message.status = 0;
+	message.latency_us = 0;
+	if(send(client->fd, &message, sizeof(message), MSG_NOSIGNAL) != sizeof(message)){
+		return 1;
+	}
+	do {
+		if(recv(client->fd, &message, sizeof(message), MSG_WAITALL) != sizeof(message)){
+			return 1;
+		}
+	} while(message.sequence != client->sequence - 1);
+	return message.status != 0;
+}
+
+void aiserve_client_stats(const aiserve_client_t *client, aiserve_stats_t *stats)
+{
+	aiserve_read_stats((const aiserve_shm_header_t *) client->shm, stats);
+	return;
+}
+
+void aiserve_disconnect(aiserve_client_t *client)
+{
+	if(client->fd >= 0){
+		close(client->fd);
+		client->fd = -1;
+	}
+	if(client->shm != 0){
+		munmap(client->shm, client->shm_size);
+		client->shm = 0;
+	}
+	return;
+}
+
+void aiserve_print_stats(const aiserve_stats_t *stats, int (*print)(const char *format, ...))
+{
+	float mean_batch = stats->batches > 0 ? (float) stats->requests / (float) stats->batches : 0.0f;
+	float mean_latency = stats->requests > 0 ? (float) stats->latency_sum_us / (float) stats->requests : 0.0f;
+	float throughput = stats->uptime_us > 0 ? (float) stats->requests * 1000000.0f / (float) stats->uptime_us : 0.0f;
+
+	print("Requests: %lu; batches: %lu (%lu zero-copy); mean batch size: %.2f\n",
+	      (unsigned long) stats->requests, (unsigned long) stats->batches, (unsigned long) stats->zero_copy_batches, mean_batch);
+	print("Latency: mean %.1f us; max %lu us; compute %lu us\n",
+	      mean_latency, (unsigned long) stats->latency_max_us, (unsigned long) stats->compute_us);
+	print("Throughput: %.1f requests/s\n", throughput);
+	return;
+}
+
+#endif // AIFES_WITH_POSIX
@@ -0,0 +1,306 @@
+/**
+ * \file basic/posix/aiserve/aiserve.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Local inference server with shared memory tensors and dynamic batching
+ * \details If many processes on one host use the same model, every process would hold its own copy of the parameters
+ * and run its own batch 1 inferences. With this module one server process loads the model once and the other processes
+ * send their requests over a Unix domain socket.
+ *
+ * The tensors are never sent over the socket. Every connected client gets a slot in a POSIX shared memory region
+ * with space for one input and one output sample. The client writes its input directly into the slot, sends a small
+ * request message and reads the result from the slot when the response message arrives.
+ *
+ * The server collects the requests of different clients and calculates them together in one aialgo_forward_model()
+ * call (dynamic batching). A batch is started when AISERVE_MAX_BATCH (aiserve.max_batch) requests are waiting or the
+ * oldest request waited aiserve.batch_timeout_us. If the slots of a batch are consecutive, the model reads the inputs
+ * from and writes the results to the shared memory without any copy. Otherwise the samples are gathered in a staging
+ * buffer.
+ *
+ * The server counts the requests, batches and latencies. The statistics are stored in the shared memory too, so every
+ * client can read them with aiserve_client_stats().
+ *
+ * Only available with AIFES_WITH_POSIX. The model must have \link aimath_f32.h F32 \endlink inputs and outputs and the
+ * first dimension of the input layer shape must be the batch dimension.
+ *
+ * Example of a server process:
+ * \code{.c}
+ * aiserve_t server = {
+ *     .socket_path = "/tmp/aifes.sock",
+ *     .shm_name = "/aifes_shm",
+ *     .max_batch = 16,
+ *     .batch_timeout_us = 500
+ * };
+ *
+ * // Build the model and load the parameters ...
+ *
+ * uint32_t memory_size = aiserve_sizeof_memory(&server, &model);
+ * void *memory_ptr = malloc(memory_size);
+ * if(aiserve_init(&server, &model, memory_ptr, memory_size) == 0){
+ *     aiserve_run(&server); // Returns after aiserve_stop() was called (for example from a signal handler)
+ * }
+ * aiserve_close(&server);
+ * \endcode
+ *
+ * Example of a client process:
+ * \code{.c}
+ * aiserve_client_t client;
+ *
+ * aiserve_connect(&client, "/tmp/aifes.sock");
+ *
+ * memcpy(client.input.data, features, aimath_sizeof_tensor_data(&client.input));
+ * aiserve_infer(&client);
+ * print_aitensor(&client.output);
+ *
+ * aiserve_disconnect(&client);
+ * \endcode
+ */
+
+#ifndef AISERVE
+#define AISERVE
+
+#include "../../../aifes.h"
+
+#ifdef AIFES_WITH_POSIX
+
+#include <stdatomic.h>
+
+#define AISERVE_MAX_CLIENTS     32 /**< Maximum number of connected clients (shared memory slots) */
+#define AISERVE_MAX_DIM         4 /**< Maximum dimension of the input and output tensors */
+#define AISERVE_SHM_NAME_LENGTH 64 /**< Maximum length of the shared memory name (including the terminating zero) */
+
+typedef struct aiserve  aiserve_t;
+typedef struct aiserve_client  aiserve_client_t;
+typedef struct aiserve_stats  aiserve_stats_t;
+typedef struct aiserve_shm_header  aiserve_shm_header_t;
+typedef struct aiserve_hello  aiserve_hello_t;
+typedef struct aiserve_message  aiserve_message_t;
+
+/** @brief Statistics of the server
+ *
+ * The mean batch size is requests / batches, the throughput is requests / uptime_us and the
+ * mean latency is latency_sum_us / requests.
+ */
+struct aiserve_stats {
+	uint64_t requests; /**< Number of calculated requests. */
+	uint64_t batches; /**< Number of aialgo_forward_model() calls. */
+	uint64_t zero_copy_batches; /**< Number of batches that were calculated directly on the shared memory. */
+	uint64_t compute_us; /**< Summed up time of the forward passes in microseconds. */
+	uint64_t latency_sum_us; /**< Summed up time from the receipt of a request until the response in microseconds. */
+	uint32_t latency_max_us; /**< Maximal latency of a request in microseconds. */
+	uint64_t uptime_us; /**< Time since aiserve_init() in microseconds (updated after every batch). */
+};
+
+/** @brief Header of the shared memory region
+ *
+ * The statistics are written by the server and read by the clients. The sequence counter is odd while the server
+ * writes the statistics (sequence lock).
+ */
+struct aiserve_shm_header {
+	atomic_uint stats_sequence; /**< Sequence counter of the statistics. */
+	aiserve_stats_t stats; /**< Statistics of the server. */
+};
+
+/** @brief First message of the server to a new client
+ *
+ */
+struct aiserve_hello {
+	uint32_t slot; /**< Slot of the client in the shared memory. */
+	uint32_t shm_size; /**< Size of the shared memory region. */
+	uint32_t input_offset; /**< Offset of the input sample of the slot in the shared memory. */
+	uint32_t output_offset; /**< Offset of the output sample of the slot in the shared memory. */
+	uint8_t input_dim; /**< Dimension of the input tensor. */
+	uint8_t output_dim; /**< Dimension of the output tensor. */
+	uint16_t input_shape[AISERVE_MAX_DIM]; /**< Shape of the input tensor (batch size 1). */
+	uint16_t output_shape[AISERVE_MAX_DIM]; /**< Shape of the output tensor (batch size 1). */
+	char shm_name[AISERVE_SHM_NAME_LENGTH]; /**< Name of the shared memory region. */
+};
+
+/** @brief Request (client to server) and response (server to client) message
+ *
+ */
+struct aiserve_message {
+	uint32_t sequence; /**< Number of the request, the response has the same number. */
+	int32_t status; /**< 0 if the result was calculated (only used in the response). */
+	uint32_t latency_us; /**< Time from the receipt of the request until the response (only used in the response). */
+};
+
+/** @brief Configuration and state of the server
+ *
+ */
+struct aiserve {
+	/** @name Configuration
+	 * @brief Required configuration parameters
+	 */
+	///@{
+	const char *socket_path; /**< File system path of the Unix domain socket. */
+	const char *shm_name; /**< Name of the POSIX shared memory region (starts with '/'). */
+	uint16_t max_batch; /**< Maximal number of requests per forward pass (at most AISERVE_MAX_CLIENTS). */
+	uint32_t batch_timeout_us; /**< Maximal time a request waits for other requests before its batch is started. */
+	///@}
+
+	/** @name Variables for internal use only
+	 */
+	///@{
+	aimodel_t *model; /**< The served model. */
+	int listen_fd; /**< Listening socket. */
+	int client_fds[AISERVE_MAX_CLIENTS]; /**< Socket of the client in each slot (-1 for a free slot). */
+	uint8_t pending[AISERVE_MAX_CLIENTS]; /**< Slots with a request in the order of arrival. */
+	uint16_t pending_count; /**< Number of waiting requests. */
+	aiserve_message_t requests[AISERVE_MAX_CLIENTS]; /**< Last request of each slot. */
+	uint64_t request_time_us[AISERVE_MAX_CLIENTS]; /**< Receipt time of the last request of each slot. */
+	uint64_t start_time_us; /**< Time of aiserve_init(). */
+
+	void *shm; /**< Mapped shared memory region. */
+	uint32_t shm_size; /**< Size of the shared memory region. */
+	uint32_t input_offset; /**< Offset of the input samples in the shared memory. */
+	uint32_t output_offset; /**< Offset of the output samples in the shared memory. */
+	uint32_t input_size; /**< Size of one input sample in bytes. */
+	uint32_t output_size; /**< Size of one output sample in bytes. */
+	uint16_t batch_dim_size; /**< Original batch size of the input layer (restored by aiserve_close()). */
+
+	void *inference_memory; /**< Inference memory of the model for max_batch samples. */
+	uint32_t inference_memory_size; /**< Size of the inference memory. */
+	void *staging_input; /**< Buffer to gather the inputs of non consecutive slots. */
+	void *staging_output; /**< Buffer for the results of non consecutive slots. */
+
+	atomic_uint running; /**< TRUE while aiserve_run() should continue. */
+	///@}
+};
+
+/** @brief Connection of a client process to the server
+ *
+ * The data of the input and output tensors is located in the shared memory.
+ */
+struct aiserve_client {
+	aitensor_t input; /**< Input sample, write the input here before aiserve_infer(). */
+	aitensor_t output; /**< Output sample, contains the result after aiserve_infer(). */
+
+	/** @name Variables for internal use only
+	 */
+	///@{
+	uint16_t input_shape[AISERVE_MAX_DIM]; /**< Shape of the input tensor. */
+	uint16_t output_shape[AISERVE_MAX_DIM]; /**< Shape of the output tensor. */
+	int fd; /**< Socket of the connection. */
+	void *shm; /**< Mapped shared memory region. */
+	uint32_t shm_size; /**< Size of the shared memory region. */
+	uint32_t slot; /**< Slot of the client. */
+	uint32_t sequence; /**< Number of the next request. */
+	///@}
+};
+
+/** @brief Calculate the memory size for the server
+ *
+ * The memory contains the inference memory for a batch of aiserve.max_batch samples and the staging buffers.
+ * The model must be compiled and the parameters must be set.
+ *
+ * @param *server   The server configuration
+ * @param *model    The model to serve
+ * @return          Required memory size in bytes
+ */
+uint32_t aiserve_sizeof_memory(aiserve_t *server, aimodel_t *model);
+
+/** @brief Create the shared memory region and the listening socket
+ *
+ * The inference memory of the model is scheduled in the given memory. Existing files with the same socket path
+ * and shared memory name are replaced.
+ *
+ * @param *server       The server configuration
+ * @param *model        The model to serve
+ * @param *memory_ptr   Pointer to the memory block
+ * @param memory_size   Size of the memory block (see aiserve_sizeof_memory())
+ * @return              0 if successful
+ */
+uint8_t aiserve_init(aiserve_t *server, aimodel_t *model, void *memory_ptr, uint32_t memory_size);
+
+/** @brief Accept clients and answer requests until aiserve_stop() is called
+ *
+ * Runs in the calling thread.
+ *
+ * @param *server   The initialized server
+ * @return          0 if stopped with aiserve_stop(), 1 on a socket error
+ */
+uint8_t aiserve_run(aiserve_t *server);
+
+/** @brief Let aiserve_run() return
+ *
+ * Can be called from another thread or a signal handler. aiserve_run() returns within 100 ms.
+ *
+ * @param *server   The running server
+ */
+void aiserve_stop(aiserve_t *server);
+
+/** @brief Close all connections and remove the socket and the shared memory region
+ *
+ * @param *server   The server
+ */
+void aiserve_close(aiserve_t *server);
+
+/** @brief Read the statistics of the server
+ *
+ * @param *server   The server
+ * @param *stats    The statistics are written here
+ */
+void aiserve_server_stats(const aiserve_t *server, aiserve_stats_t *stats);
+
+/** @brief Connect to a server and map the shared memory region
+ *
+ * Sets the shape and data of aiserve_client.input and aiserve_client.output.
+ *
+ * @param *client       The client
+ * @param *socket_path  File system path of the Unix domain socket of the server
+ * @return              0 if successful, 1 if no connection or no free slot
+ */
+uint8_t aiserve_connect(aiserve_client_t *client, const char *socket_path);
+
+/** @brief Calculate the output for the current input of the client
+ *
+ * Sends a request and waits for the response. The input must be written to aiserve_client.input before
+ * and must not be changed until the function returns.
+ *
+ * @param *client   The connected client
+ * @return          0 if successful, 1 if the connection is lost
+ */
+uint8_t aiserve_infer(aiserve_client_t *client);
+
+/** @brief Read the statistics of the server over the shared memory
+ *
+ * @param *client   The connected client
+ * @param *stats    The statistics are written here
+ */
+void aiserve_client_stats(const aiserve_client_t *client, aiserve_stats_t *stats);
+
+/** @brief Close the connection and unmap the shared memory region
+ *
+ * @param *client   The connected client
+ */
+void aiserve_disconnect(aiserve_client_t *client);
+
+/** @brief Print the statistics (requests, mean batch size, latency and throughput)
+ *
+ * @param *stats    The statistics
+ * @param *print    A function for printing (for example printf)
+ */
+void aiserve_print_stats(const aiserve_stats_t *stats, int (*print)(const char *format, ...));
+
+#endif // AIFES_WITH_POSIX
+
+#endif // AISERVE
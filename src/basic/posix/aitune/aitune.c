@@ -0,0 +1,374 @@
+/**
+ * \file basic/posix/aitune/aitune.c
+ * \version 2.0alpha
+ * \date 18.10.2026
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief See aitune.h for documentation.
+ * \details
+ */
+
+#include "basic/posix/aitune/aitune.h"
+
+#ifdef AIFES_WITH_POSIX
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t aitune_align(uint32_t size)
+{
+	return (size + 7) & ~((uint32_t) 7);
+}
+
+static uint32_t aitune_random(uint32_t *state)
+{
+	// xorshift32, independent of the global rand() state
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+static uint64_t aitune_grid_size(const aitune_t *tune)
+{
+	uint8_t p;
+	uint64_t size = 1;
+
+	for(p = 0; p < tune->param_count; p++)
+	{
+		size *= tune->params[p].count;
+	}
+	return size;
+}
+
+static void aitune_set_values(const aitune_t *tune, aitune_trial_t *trial, uint64_t grid_index)
+{
+	uint8_t p;
+
+	for(p = 0; p < tune->param_count; p++)
+	{
+		trial->values[p] = tune->params[p].values[grid_index % tune->params[p].count];
+		grid_index /= tune->params[p].count;
+	}
+	return;
+}
+
+// Full grid or trial_count distinct random grid points
+static void aitune_sample_trials(aitune_t *tune)
+{
+	uint16_t i, j;
+	uint64_t grid_size = aitune_grid_size(tune);
+	uint64_t grid_indices[tune->trial_count];
+	uint32_t random_state = tune->seed != 0 ? tune->seed : 0x9E3779B9;
+
+	for(i = 0; i < tune->trial_count; i++)
+	{
+		if(grid_size <= tune->trial_count){
+			grid_indices[i] = i;
+		} else {
+			do {
+				grid_indices[i] = (((uint64_t) aitune_random(&random_state) << 32) | aitune_random(&random_state)) % grid_size;
+				for(j = 0; j < i; j++){
+					if(grid_indices[j] == grid_indices[i]) break;
+				}
+			} while(j < i);
+		}
+		aitune_set_values(tune, &(tune->trials[i]), grid_indices[i]);
+	}
+	return;
+}
+
+// Trials that reached more epochs first, then by the loss
+static uint8_t aitune_is_better(const aitune_trial_t *a, const aitune_trial_t *b)
+{
+	if((a->state == AITUNE_TRIAL_FAILED) != (b->state == AITUNE_TRIAL_FAILED)) return b->state == AITUNE_TRIAL_FAILED;
+	if(a->epochs != b->epochs) return a->epochs > b->epochs;
+	return a->loss < b->loss;
+}
+
+static void aitune_sort(const aitune_t *tune, uint16_t *indices, uint16_t count)
+{
+	uint16_t i, j, index;
+
+	// Insertion sort (stable, the trial counts are small)
+	for(i = 1; i < count; i++)
+	{
+		index = indices[i];
+		for(j = i; j > 0 && aitune_is_better(&(tune->trials[index]), &(tune->trials[indices[j - 1]])); j--)
+		{
+			indices[j] = indices[j - 1];
+		}
+		indices[j] = index;
+	}
+	return;
+}
+
+static void aitune_train_trial(aitune_t *tune, aitune_trial_t *trial)
+{
+	float loss;
+	aitensor_t *input = tune->validation_input != 0 ? tune->validation_input : tune->train_input;
+	aitensor_t *target = tune->validation_input != 0 ? tune->validation_target : tune->train_target;
+
+	while(trial->epochs < tune->target_epochs)
+	{
+		aialgo_train_model_with_loss_f32(trial->model, tune->train_input, tune->train_target, trial->optimizer, tune->batch_size, &trial->train_loss);
+		trial->epochs++;
+	}
+
+	aialgo_calc_loss_model_f32(trial->model, input, target, &loss);
+	loss /= (float) input->shape[0];
+	// Diverged trials are ranked last
+	trial->loss = isnan(loss) ? INFINITY : loss;
+	return;
+}
+
+static void *aitune_worker(void *arg)
+{
+	aitune_t *tune = (aitune_t *) arg;
+	aitune_trial_t *trial;
+
+	pthread_mutex_lock(&tune->mutex);
+	while(1)
+	{
+		while(!tune->shutdown && tune->next_job >= tune->job_count)
+		{
+			pthread_cond_wait(&tune->work_available, &tune->mutex);
+		}
+		if(tune->shutdown) break;
+
+		trial = &(tune->trials[tune->jobs[tune->next_job]]);
+		tune->next_job++;
+		pthread_mutex_unlock(&tune->mutex);
+
+		aitune_train_trial(tune, trial);
+
+		pthread_mutex_lock(&tune->mutex);
+		tune->done_count++;
+		if(tune->done_count == tune->job_count){
+			pthread_cond_signal(&tune->work_done);
+		}
+	}
+	pthread_mutex_unlock(&tune->mutex);
+	return 0;
+}
+
+// Train the trials in tune->jobs in the worker threads up to target_epochs
+static void aitune_run_rung(aitune_t *tune, uint16_t job_count, uint16_t target_epochs)
+{
+	pthread_mutex_lock(&tune->mutex);
+	tune->target_epochs = target_epochs;
+	tune->next_job = 0;
+	tune->done_count = 0;
+	tune->job_count = job_count;
+	pthread_cond_broadcast(&tune->work_available);
+	while(tune->done_count < tune->job_count)
+	{
+		pthread_cond_wait(&tune->work_done, &tune->mutex);
+	}
+	tune->job_count = 0;
+	pthread_mutex_unlock(&tune->mutex);
+	return;
+}
+
+uint32_t aitune_sizeof_memory(aitune_t *tune)
+{
+	uint64_t grid_size = aitune_grid_size(tune);
+
+	if(tune->trial_count == 0 || tune->trial_count > grid_size){
+		tune->trial_count = grid_size > 0xFFFF ? 0xFFFF : (uint16_t) grid_size;
+	}
+
+	return aitune_align(tune->trial_count * sizeof(aitune_trial_t))
+		   + aitune_align(2 * tune->trial_count * sizeof(uint16_t))
+		   + tune->trial_count * aitune_align(tune->arena_size);
+}
+
+void *aitune_alloc(aitune_trial_t *trial, uint32_t size)
+{
+	void *ptr;
+
+	size = aitune_align(size);
+	if(trial->arena_used + size > trial->arena_size){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("The arena of the trial is too small.\n");
+#endif
+		return 0;
+	}
+	ptr = trial->arena + trial->arena_used;
+	trial->arena_used += size;
+	return ptr;
+}
+
+uint8_t aitune_run(aitune_t *tune, void *memory_ptr, uint32_t memory_size)
+{
+	uint16_t i, t, alive, keep;
+	uint16_t threads, epochs;
+	uint8_t reduction_factor;
+	pthread_t workers[AITUNE_MAX_THREADS];
+	aitune_trial_t *trial;
+
+	if(tune->param_count > AITUNE_MAX_PARAMS || tune->build == 0 || tune->min_epochs == 0){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("Invalid search configuration.\n");
+#endif
+		return 1;
+	}
+	if(memory_size < aitune_sizeof_memory(tune)){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("Not enough memory for the search.\n");
+#endif
+		return 1;
+	}
+
+	tune->trials = memory_ptr;
+	memory_ptr += aitune_align(tune->trial_count * sizeof(aitune_trial_t));
+	tune->ranking = memory_ptr;
+	tune->jobs = tune->ranking + tune->trial_count;
+	memory_ptr += aitune_align(2 * tune->trial_count * sizeof(uint16_t));
+	tune->rungs = 0;
+
+	memset(tune->trials, 0, tune->trial_count * sizeof(aitune_trial_t));
+	aitune_sample_trials(tune);
+
+	// The build callbacks run in this thread because they may use rand() for the initialization
+	alive = 0;
+	for(i = 0; i < tune->trial_count; i++)
+	{
+		trial = &(tune->trials[i]);
+		trial->id = i;
+		trial->arena = memory_ptr;
+		trial->arena_size = tune->arena_size;
+		trial->loss = INFINITY;
+		trial->train_loss = INFINITY;
+		memory_ptr += aitune_align(tune->arena_size);
+
+		srand(tune->seed + i);
+		if(tune->build(trial, tune->user_data) != 0 || trial->model == 0 || trial->optimizer == 0){
+			trial->state = AITUNE_TRIAL_FAILED;
+		} else {
+			trial->state = AITUNE_TRIAL_RUNNING;
+			tune->jobs[alive++] = i;
+		}
+		tune->ranking[i] = i;
+	}
+
+	threads = tune->threads;
+	if(threads > AITUNE_MAX_THREADS) threads = AITUNE_MAX_THREADS;
+	if(threads > alive) threads = alive;
+	if(threads == 0) threads = 1;
+	reduction_factor = tune->reduction_factor < 2 ? 2 : tune->reduction_factor;
+	epochs = tune->min_epochs;
+	if(tune->max_epochs < epochs) tune->max_epochs = epochs;
+
+	pthread_mutex_init(&tune->mutex, 0);
+	pthread_cond_init(&tune->work_available, 0);
+	pthread_cond_init(&tune->work_done, 0);
+	tune->job_count = 0;
+	tune->shutdown = FALSE;
+	for(t = 0; t < threads; t++)
+	{
+		if(pthread_create(&workers[t], 0, aitune_worker, tune) != 0){
+			break;
+		}
+	}
+	threads = t;
+
+	while(alive > 0 && threads > 0)
+	{
+		aitune_run_rung(tune, alive, epochs);
+		tune->rungs++;
+
+		if(epochs >= tune->max_epochs || alive == 1){
+			for(i = 0; i < alive; i++)
+			{
+				tune->trials[tune->jobs[i]].state = AITUNE_TRIAL_FINISHED;
+			}
+			break;
+		}
+
+		// Successive halving: Only the best 1 / reduction_factor of the trials reach the next rung
+		aitune_sort(tune, tune->jobs, alive);
+		keep = alive / reduction_factor;
+		if(keep == 0) keep = 1;
+		for(i = keep; i < alive; i++)
+		{
+			tune->trials[tune->jobs[i]].state = AITUNE_TRIAL_STOPPED;
+		}
+		alive = keep;
+		epochs = (uint32_t) epochs * reduction_factor > tune->max_epochs ? tune->max_epochs : epochs * reduction_factor;
+	}
+
+	pthread_mutex_lock(&tune->mutex);
+	tune->shutdown = TRUE;
+	pthread_cond_broadcast(&tune->work_available);
+	pthread_mutex_unlock(&tune->mutex);
+	for(t = 0; t < threads; t++)
+	{
+		pthread_join(workers[t], 0);
+	}
+	pthread_cond_destroy(&tune->work_done);
+	pthread_cond_destroy(&tune->work_available);
+	pthread_mutex_destroy(&tune->mutex);
+
+	aitune_sort(tune, tune->ranking, tune->trial_count);
+
+	if(threads == 0){
+#ifdef AIDEBUG_PRINT_ERROR_MESSAGES
+		LOG_E("Could not create the worker threads of the search.\n");
+#endif
+		return 1;
+	}
+	return 0;
+}
+
+aitune_trial_t *aitune_best_trial(const aitune_t *tune)
+{
+	if(tune->trial_count == 0 || tune->trials[tune->ranking[0]].state == AITUNE_TRIAL_FAILED){
+		return 0;
+	}
+	return &(tune->trials[tune->ranking[0]]);
+}
+
+void aitune_print_results(const aitune_t *tune, int (*print)(const char *format, ...))
+{
+	uint16_t i;
+	uint8_t p;
+	const aitune_trial_t *trial;
+	static const char *state_names[] = {"running", "stopped", "finished", "failed"};
+
+	print("Hyperparameter search: %u trials, %u rungs\n", (unsigned int) tune->trial_count, (unsigned int) tune->rungs);
+	print("rank; trial; ");
+	for(p = 0; p < tune->param_count; p++)
+	{
+		print("%s; ", tune->params[p].name);
+	}
+	print("epochs; loss; state\n");
+	for(i = 0; i < tune->trial_count; i++)
+	{
+		trial = &(tune->trials[tune->ranking[i]]);
+		print("%u; %u; ", (unsigned int) i + 1, (unsigned int) trial->id);
+		for(p = 0; p < tune->param_count; p++)
+		{
+			print("%g; ", trial->values[p]);
+		}
+		print("%u; %.6f; %s\n", (unsigned int) trial->epochs, trial->loss, state_names[trial->state]);
+	}
+	return;
+}
+
+#endif // AIFES_WITH_POSIX
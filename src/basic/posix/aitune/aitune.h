@@ -0,0 +1,248 @@
+/**
+ * \file basic/posix/aitune/aitune.h
+ * \internal
+ * \date 18.10.2026
+ * \endinternal
+ * \version 2.0alpha
+ * \copyright  Copyright (C) 2020-2021  Fraunhofer Institute for Microelectronic Circuits and Systems.
+    All rights reserved.
+
+    AIfES is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * \brief Parallel hyperparameter search with successive halving on multi-core POSIX hosts
+ * \details The runner samples trials (combinations of hyperparameter values) from a search space, trains them in a
+ * pool of threads and stops unpromising trials early:
+ *
+ * 1. All trials are trained for aitune.min_epochs epochs and evaluated on the validation data.
+ * 2. Only the best 1 / aitune.reduction_factor of the trials are kept and trained further until they have
+ *    reduction_factor times more epochs (successive halving for reduction_factor = 2).
+ * 3. Step 2 is repeated until aitune.max_epochs is reached or only one trial is left.
+ *
+ * Most of the training time is spent for the good trials, so more configurations can be tested in the same time.
+ *
+ * Every trial has its own memory arena for the layers, the parameters and the training memory. The model is created
+ * in the arena by a user callback (aitune.build) that reads the hyperparameters of the trial. The training and
+ * validation data is shared by all trials and is only read.
+ *
+ * The callbacks are executed one after another in the calling thread (with srand(seed + trial id) before,
+ * so the random initialization is reproducible). The training runs in parallel; it must not use global state
+ * (for example AIDEBUG_TRACE or the random number generator).
+ *
+ * Only available with AIFES_WITH_POSIX.
+ *
+ * Example:
+ * \code{.c}
+ * const float learning_rates[] = {0.001f, 0.003f, 0.01f, 0.03f};
+ * const float neurons[] = {8.0f, 16.0f, 32.0f};
+ * const aitune_param_t params[] = {
+ *     {.name = "lr", .count = 4, .values = learning_rates},
+ *     {.name = "neurons", .count = 3, .values = neurons}
+ * };
+ *
+ * uint8_t build(aitune_trial_t *trial, void *user_data)
+ * {
+ *     my_model_t *m = aitune_alloc(trial, sizeof(my_model_t));
+ *     // Create the layers with (uint16_t) trial->values[1] neurons, the parameter memory, an optimizer with
+ *     // learning rate trial->values[0] and the training memory from aitune_alloc(), initialize the parameters
+ *     // and call aialgo_init_model_for_training()
+ *     trial->model = &m->model;
+ *     trial->optimizer = m->optimizer;
+ *     return 0;
+ * }
+ *
+ * aitune_t tune = {
+ *     .params = params, .param_count = 2,
+ *     .trial_count = 12,
+ *     .threads = 8,
+ *     .arena_size = 16384,
+ *     .min_epochs = 10, .max_epochs = 270, .reduction_factor = 3,
+ *     .batch_size = 32,
+ *     .train_input = &x_train, .train_target = &y_train,
+ *     .validation_input = &x_val, .validation_target = &y_val,
+ *     .build = build,
+ *     .seed = 1
+ * };
+ *
+ * uint32_t memory_size = aitune_sizeof_memory(&tune);
+ * void *memory_ptr = malloc(memory_size);
+ * aitune_run(&tune, memory_ptr, memory_size);
+ * aitune_print_results(&tune, printf);
+ * \endcode
+ */
+
+#ifndef AITUNE
+#define AITUNE
+
+#include "../../../aifes.h"
+
+#ifdef AIFES_WITH_POSIX
+
+#include <pthread.h>
+
+#define AITUNE_MAX_PARAMS   8 /**< Maximum number of hyperparameters in the search space */
+#define AITUNE_MAX_THREADS  64 /**< Maximum number of worker threads */
+
+#define AITUNE_TRIAL_RUNNING    0 /**< Trial state: Still in the search */
+#define AITUNE_TRIAL_STOPPED    1 /**< Trial state: Stopped early by successive halving */
+#define AITUNE_TRIAL_FINISHED   2 /**< Trial state: Reached the last rung */
+#define AITUNE_TRIAL_FAILED     3 /**< Trial state: The build callback failed */
+
+typedef struct aitune  aitune_t;
+typedef struct aitune_param  aitune_param_t;
+typedef struct aitune_trial  aitune_trial_t;
+
+/** @brief Hyperparameter of the search space with a list of possible values
+ *
+ * Integer or categorical hyperparameters (for example the number of neurons or the optimizer) are given as
+ * float values too and converted in the build callback.
+ */
+struct aitune_param {
+	const char *name; /**< Name of the hyperparameter (for the print functions). */
+	uint8_t count; /**< Number of values. */
+	const float *values; /**< Possible values. */
+};
+
+/** @brief Trial of the search (one combination of hyperparameter values)
+ *
+ */
+struct aitune_trial {
+	uint16_t id; /**< Number of the trial. */
+	float values[AITUNE_MAX_PARAMS]; /**< Values of the hyperparameters (same order as aitune.params). */
+
+	aimodel_t *model; /**< The model, must be set by the build callback. */
+	aiopti_t *optimizer; /**< The optimizer, must be set by the build callback. */
+	void *user_data; /**< Free to use by the build callback. */
+
+	uint8_t state; /**< AITUNE_TRIAL_RUNNING, AITUNE_TRIAL_STOPPED, AITUNE_TRIAL_FINISHED or AITUNE_TRIAL_FAILED. */
+	uint16_t epochs; /**< Number of trained epochs. */
+	float loss; /**< Mean validation loss per sample after the last rung of the trial. */
+	float train_loss; /**< Running mean training loss of the last epoch. */
+
+	/** @name Variables for internal use only
+	 */
+	///@{
+	void *arena; /**< Memory arena of the trial. */
+	uint32_t arena_size; /**< Size of the arena. */
+	uint32_t arena_used; /**< Used bytes of the arena. */
+	///@}
+};
+
+/** @brief Configuration and state of the hyperparameter search
+ *
+ */
+struct aitune {
+	/** @name Configuration
+	 * @brief Required configuration parameters
+	 */
+	///@{
+	const aitune_param_t *params; /**< The search space. */
+	uint8_t param_count; /**< Number of hyperparameters (at most AITUNE_MAX_PARAMS). */
+	uint16_t trial_count; /**< Number of trials (0 for all combinations of the search space). */
+	uint16_t threads; /**< Number of worker threads (at most AITUNE_MAX_THREADS). */
+	uint32_t arena_size; /**< Memory arena size of every trial in bytes. */
+
+	uint16_t min_epochs; /**< Epochs of the first rung. */
+	uint16_t max_epochs; /**< Maximum number of epochs of a trial. */
+	uint8_t reduction_factor; /**< Only 1 / reduction_factor of the trials reach the next rung, which has reduction_factor times more epochs (at least 2). */
+
+	aitensor_t *train_input; /**< Shared training inputs. */
+	aitensor_t *train_target; /**< Shared training targets. */
+	aitensor_t *validation_input; /**< Shared validation inputs (0 to evaluate on the training data). */
+	aitensor_t *validation_target; /**< Shared validation targets. */
+	uint32_t batch_size; /**< Batch size of the training. */
+
+	/** @brief Create the model and the optimizer of a trial
+	 *
+	 * Allocate all memory with aitune_alloc(), set aitune_trial.model and aitune_trial.optimizer and prepare the
+	 * model for the training (parameter initialization, training memory and aialgo_init_model_for_training()).
+	 *
+	 * @param *trial        The trial with the hyperparameter values
+	 * @param *user_data    aitune.user_data
+	 * @return              0 if successful
+	 */
+	uint8_t (*build)(aitune_trial_t *trial, void *user_data);
+	void *user_data; /**< Passed to the build callback. */
+	uint32_t seed; /**< Seed for the sampling of the trials and the initialization. */
+	///@}
+
+	/** @name Results
+	 */
+	///@{
+	aitune_trial_t *trials; /**< All trials (trial_count elements). */
+	uint16_t *ranking; /**< Indices of the trials sorted by the loss (best first), failed trials at the end. */
+	uint16_t rungs; /**< Number of calculated rungs. */
+	///@}
+
+	/** @name Variables for internal use only
+	 */
+	///@{
+	pthread_mutex_t mutex; /**< Protects the job variables. */
+	pthread_cond_t work_available; /**< Signals new jobs to the workers. */
+	pthread_cond_t work_done; /**< Signals the end of the last job of a rung. */
+	uint16_t *jobs; /**< Trials of the current rung. */
+	uint16_t job_count; /**< Number of trials of the current rung. */
+	uint16_t next_job; /**< Next trial to train. */
+	uint16_t done_count; /**< Number of trained trials of the current rung. */
+	uint16_t target_epochs; /**< Epochs of the current rung. */
+	uint8_t shutdown; /**< TRUE to end the workers. */
+	///@}
+};
+
+/** @brief Calculate the memory size for the search
+ *
+ * The memory contains the trials with their arenas.
+ *
+ * @param *tune The search configuration (trial_count is set if 0)
+ * @return      Required memory size in bytes
+ */
+uint32_t aitune_sizeof_memory(aitune_t *tune);
+
+/** @brief Run the search
+ *
+ * Samples and builds the trials, trains them with successive halving in aitune.threads threads and ranks them.
+ *
+ * @param *tune         The search configuration
+ * @param *memory_ptr   Pointer to the memory block
+ * @param memory_size   Size of the memory block (see aitune_sizeof_memory())
+ * @return              0 if successful
+ */
+uint8_t aitune_run(aitune_t *tune, void *memory_ptr, uint32_t memory_size);
+
+/** @brief Allocate memory from the arena of a trial
+ *
+ * Only for use in the build callback. The memory is aligned to 8 bytes.
+ *
+ * @param *trial    The trial
+ * @param size      Size in bytes
+ * @return          Pointer to the memory or 0 if the arena is full
+ */
+void *aitune_alloc(aitune_trial_t *trial, uint32_t size);
+
+/** @brief Get the best trial of the search
+ *
+ * @param *tune The finished search
+ * @return      The trial with the lowest loss of the last rung
+ */
+aitune_trial_t *aitune_best_trial(const aitune_t *tune);
+
+/** @brief Print the trials ranked by the loss
+ *
+ * @param *tune     The finished search
+ * @param *print    A function for printing (for example printf)
+ */
+void aitune_print_results(const aitune_t *tune, int (*print)(const char *format, ...));
+
+#endif // AIFES_WITH_POSIX
+
+#endif // AITUNE
@@ -51,6 +51,22 @@ typedef struct aicore_layertype aicore_layertype_t;
 typedef struct aicore_losstype aicore_losstype_t;
 typedef struct aicore_optitype aicore_optitype_t;
 
+typedef struct aicore_layercost aicore_layercost_t;
+
+/** @brief Static computational cost of a layer for one forward pass
+ *
+ * The values are calculated from the result shapes of the layer (see aicore_layertype.calc_cost).
+ * Operations are counted in elements of the data type of the layer (a multiply-accumulate counts as two operations).
+ */
+struct aicore_layercost {
+	uint32_t ops; /**< Number of basic arithmetic operations (add, multiply, compare). */
+	uint32_t special_ops; /**< Number of expensive operations (exp, division, square root). */
+	uint32_t bytes_read; /**< Number of bytes read from the inputs and the parameters. */
+	uint32_t bytes_written; /**< Number of bytes written to the result. */
+	uint32_t parameter_bytes; /**< Size of the parameters (like weights and bias) in bytes. */
+	uint32_t activation_bytes; /**< Size of the result tensor in bytes. */
+};
+
 
 /** @brief Type indicator of the layer
  *
@@ -61,11 +77,12 @@ typedef struct aicore_optitype aicore_optitype_t;
  * const aicore_layertype_t ailayer_dense_type_s = {
  * #ifdef AIDEBUG_PRINT_MODULE_SPECS
  *     .name = "Dense",
- *     .print_specs = ailayer_dense_print_specs
+ *     .print_specs = ailayer_dense_print_specs,
  * #else
  *     .name = 0,
- *     .print_specs = 0
+ *     .print_specs = 0,
  * #endif
+ *     .calc_cost = ailayer_dense_calc_cost
  * };
  * const aicore_layertype_t *ailayer_dense_type = &ailayer_dense_type_s;
  * \endcode
@@ -89,6 +106,16 @@ struct aicore_layertype {
 	* @param *print         A function for printing (for example printf)
 	*/
 	void (*print_specs)(const ailayer_t *self, int (*print)(const char *format, ...));
+
+    /** @brief Set a function to calculate the static cost of a forward pass of the layer (for example FLOPs and memory accesses)
+    *
+    * The result shape of the layer has to be calculated before (ailayer.calc_result_shape).
+    * Set to NULL if not available. The cost is used by the cost model (see aialgo_cost_model.h).
+    *
+	* @param self           The layer
+	* @param *cost          The calculated cost is written here
+	*/
+	void (*calc_cost)(const ailayer_t *self, aicore_layercost_t *cost);
 };
 
 /** @brief Type indicator of the loss to check for the loss type
@@ -307,6 +334,14 @@ struct ailayer {
 
 	aitensor_t deltas; /**< The result of the backward function is stored here. */
 
+	/** @brief Result overwrites the result of the input layer during training (TRUE / FALSE)
+	*
+	* Layers that do not need their inputs in the backward pass (e.g. ReLU with a stored sign mask) can set this flag.
+	* The training memory scheduler then assigns no own result memory to the layer, the forward pass
+	* writes the result over the result of the input layer. Not applied if the input layer is the model input.
+	*/
+	uint8_t result_in_place;
+
 	/** @name Training memory API
 	* @brief Makes the memory of the trainable params, the gradients and optimizer stuff accessible.
 	*
@@ -325,6 +360,16 @@ struct ailayer {
 	*/
 	void (*backward)(ailayer_t *self);
 
+	/** @brief Calculate the backward pass and apply a plain SGD update to the parameters in the same pass (optional).
+	*
+	* Used by aialgo_train_model_fused_sgd() instead of ailayer.backward. The deltas for the previous layer are
+	* calculated with the parameters before the update. No gradient memory is needed. Set to NULL if not supported.
+	*
+	* @param self           The layer
+	* @param learning_rate  Learning rate of the SGD optimizer (aiscalar of the parameter type)
+	*/
+	void (*backward_sgd)(ailayer_t *self, const void *learning_rate);
+
 	/** @name Parameter memory
 	* @brief Calculate the size and set the memory for the parameter.
 	*
@@ -377,6 +422,17 @@ struct ailoss {
 	* @param target_data    Tensor containing the target data / labels
 	*/
 	void (*calc_delta)(ailoss_t *self, const aitensor_t *target_data);
+
+    /** @brief Calculate the error on the target data and the loss in the same pass (optional)
+    *
+    * Writes the deltas like ailoss.calc_delta and the loss on the current result of the output layer like ailoss.calc_loss,
+    * without an additional forward pass. Set to NULL if not available (ailoss.calc_loss and ailoss.calc_delta are used instead).
+    *
+	* @param self           The layer
+	* @param target_data    Tensor containing the target data / labels
+	* @param result         Scalar in which the loss can be written (aiscalar of same type as layer type).
+	*/
+	void (*calc_delta_and_loss)(ailoss_t *self, const aitensor_t *target_data, void *result);
 };
 
 
@@ -38,6 +38,8 @@
 #define DEBUG_CHECKS /**< Functions may printf some error messages and do usage checks of possible */
 #define AIDEBUG_PRINT_MODULE_SPECS  /**< Functions may printf some Layer info  */
 #define AIDEBUG_PRINT_ERROR_MESSAGES /**< Functions may printf some error messages */
+//#define AIDEBUG_TRACE /**< Record timeline trace events of the model execution (see aidebug_trace.h) */
+//#define AIDEBUG_MEMORY /**< Record memory high-water marks and the stack usage of the layers (see aidebug_memory.h) */
 
 /** Logging function */
 #define LOG_E(M)	printf(M)